@@ -897,11 +897,11 @@ nm_utils_match_connection(NMConnection *const   *connections,
 /*****************************************************************************/
 
 int
-nm_match_spec_device_by_pllink(const NMPlatformLink *pllink,
-                               const char           *match_device_type,
-                               const char           *match_dhcp_plugin,
-                               const GSList         *specs,
-                               int                   no_match_value)
+nm_match_spec_device_by_pllink(const NMPlatformLink           *pllink,
+                               const char                     *match_device_type,
+                               const char                     *match_dhcp_plugin,
+                               const NMMatchSpecDeviceMatcher *matcher,
+                               int                             no_match_value)
 {
     NMMatchSpecMatchType m;
 
@@ -910,14 +910,14 @@ nm_match_spec_device_by_pllink(const NMPlatformLink *pllink,
      *
      * It's still useful because of specs like "*" and "except:interface-name:eth0",
      * which match even in that case. */
-    m = nm_match_spec_device(specs,
-                             pllink ? pllink->name : NULL,
-                             match_device_type,
-                             pllink ? pllink->driver : NULL,
-                             NULL,
-                             NULL,
-                             NULL,
-                             match_dhcp_plugin);
+    m = nm_match_spec_device_matcher_match(matcher,
+                                           pllink ? pllink->name : NULL,
+                                           match_device_type,
+                                           pllink ? pllink->driver : NULL,
+                                           NULL,
+                                           NULL,
+                                           NULL,
+                                           match_dhcp_plugin);
 
     switch (m) {
     case NM_MATCH_SPEC_MATCH:
@@ -933,6 +933,79 @@ nm_match_spec_device_by_pllink(const NMPlatformLink *pllink,
 
 /*****************************************************************************/
 
+/**
+ * nm_utils_ignored_links_check:
+ * @ignored_links: a hash table mapping the ifindex to the interface name of
+ *   the ignored links.
+ * @matcher: (nullable): the matcher for main.ignore-devices.
+ * @plink: the platform link.
+ *
+ * Checks whether @plink matches main.ignore-devices. Links are matched by
+ * interface name, MAC address and driver. The ignored links are remembered
+ * in @ignored_links, so that a rename can be detected with
+ * nm_utils_ignored_links_renamed().
+ *
+ * Returns: %TRUE if no device should be created for @plink.
+ */
+gboolean
+nm_utils_ignored_links_check(GHashTable                     *ignored_links,
+                             const NMMatchSpecDeviceMatcher *matcher,
+                             const NMPlatformLink           *plink)
+{
+    char        hwaddr_buf[_NM_UTILS_HWADDR_LEN_MAX * 3];
+    const char *hwaddr = NULL;
+
+    if (matcher) {
+        if (plink->l_address.len > 0) {
+            hwaddr = _nm_utils_hwaddr_ntoa(plink->l_address.data,
+                                           plink->l_address.len,
+                                           TRUE,
+                                           hwaddr_buf,
+                                           sizeof(hwaddr_buf));
+        }
+
+        if (nm_match_spec_device_matcher_match(matcher,
+                                               plink->name,
+                                               NULL,
+                                               plink->driver,
+                                               NULL,
+                                               hwaddr,
+                                               NULL,
+                                               NULL)
+            == NM_MATCH_SPEC_MATCH) {
+            g_hash_table_insert(ignored_links,
+                                GINT_TO_POINTER(plink->ifindex),
+                                g_strdup(plink->name));
+            return TRUE;
+        }
+    }
+
+    g_hash_table_remove(ignored_links, GINT_TO_POINTER(plink->ifindex));
+    return FALSE;
+}
+
+/**
+ * nm_utils_ignored_links_renamed:
+ * @ignored_links: the hash table of nm_utils_ignored_links_check().
+ * @plink: the platform link.
+ *
+ * A link can be renamed after it was ignored, for example udev renames
+ * it right after the kernel created it. Then main.ignore-devices must be
+ * checked again with the new name.
+ *
+ * Returns: %TRUE if @plink was ignored under a different name.
+ */
+gboolean
+nm_utils_ignored_links_renamed(GHashTable *ignored_links, const NMPlatformLink *plink)
+{
+    const char *name;
+
+    name = g_hash_table_lookup(ignored_links, GINT_TO_POINTER(plink->ifindex));
+    return name && !nm_streq(name, plink->name);
+}
+
+/*****************************************************************************/
+
 NMPlatformRoutingRule *
 nm_ip_routing_rule_to_platform(const NMIPRoutingRule *rule, NMPlatformRoutingRule *out_pl)
 {
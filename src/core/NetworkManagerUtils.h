@@ -89,11 +89,17 @@ NMConnection *nm_utils_match_connection(NMConnection *const   *connections,
                                         NMUtilsMatchFilterFunc match_filter_func,
                                         gpointer               match_filter_data);
 
-int nm_match_spec_device_by_pllink(const NMPlatformLink *pllink,
-                                   const char           *match_device_type,
-                                   const char           *match_dhcp_plugin,
-                                   const GSList         *specs,
-                                   int                   no_match_value);
+int nm_match_spec_device_by_pllink(const NMPlatformLink           *pllink,
+                                   const char                     *match_device_type,
+                                   const char                     *match_dhcp_plugin,
+                                   const NMMatchSpecDeviceMatcher *matcher,
+                                   int                             no_match_value);
+
+gboolean nm_utils_ignored_links_check(GHashTable                     *ignored_links,
+                                      const NMMatchSpecDeviceMatcher *matcher,
+                                      const NMPlatformLink           *plink);
+
+gboolean nm_utils_ignored_links_renamed(GHashTable *ignored_links, const NMPlatformLink *plink);
 
 /*****************************************************************************/
 
@@ -138,6 +138,8 @@ typedef struct {
     GCancellable           *cancellable;
     NMPlatformAsyncCallback callback;
     gpointer                callback_data;
+    NMPlatformVF          **vfs; /* VFs to configure after setting @num_vfs */
+    gint64                  start_msec;
     guint                   num_vfs;
     NMOptionBool            autoprobe;
 } SriovOp;
@@ -307,6 +309,50 @@ typedef struct {
     NMEthtoolPauseState    *pause;
 } EthtoolState;
 
+typedef enum {
+    ETHTOOL_RESULT_NONE = 0,
+    ETHTOOL_RESULT_SUCCESS,
+    ETHTOOL_RESULT_FAILURE_READ,
+    ETHTOOL_RESULT_FAILURE,
+} EthtoolResult;
+
+typedef enum {
+    ETHTOOL_GROUP_FEATURES,
+    ETHTOOL_GROUP_COALESCE,
+    ETHTOOL_GROUP_RING,
+    ETHTOOL_GROUP_PAUSE,
+    _ETHTOOL_GROUP_NUM,
+} EthtoolGroup;
+
+typedef enum {
+    ETHTOOL_JOB_STATE_PENDING,
+    ETHTOOL_JOB_STATE_RUNNING,
+    ETHTOOL_JOB_STATE_DONE,
+} EthtoolJobState;
+
+/* Some drivers take long for the ethtool ioctls (changing the ring size may
+ * reset the NIC), so they run in a worker thread. The results are logged once
+ * the job is back on the main thread.
+ *
+ * If the activation goes away while a job sets the options, the main thread
+ * sets @aborted. The worker then skips the job if it did not start yet, or
+ * reverts the options right after setting them. That way the revert happens
+ * before any job that gets queued for the interface later. @lock protects
+ * @state and @aborted. */
+typedef struct {
+    NMDevice         *self;
+    NMPlatform       *platform;
+    NMSettingEthtool *s_ethtool; /* a private copy, or NULL to reset @ethtool_state */
+    EthtoolState     *ethtool_state;
+    EthtoolResult     results[_ETHTOOL_GROUP_NUM];
+    EthtoolResult     results_revert[_ETHTOOL_GROUP_NUM];
+    GMutex            lock;
+    GCond             cond;
+    EthtoolJobState   state;
+    bool              aborted;
+    bool              reverted;
+} EthtoolJob;
+
 typedef enum {
     RESOLVER_WAIT_ADDRESS = 0,
     RESOLVER_IN_PROGRESS,
@@ -384,6 +430,15 @@ NM_GOBJECT_PROPERTIES_DEFINE(NMDevice,
                              PROP_STATISTICS_REFRESH_RATE_MS,
                              PROP_STATISTICS_TX_BYTES,
                              PROP_STATISTICS_RX_BYTES,
+                             PROP_LINK_STATISTICS_RX_PACKETS,
+                             PROP_LINK_STATISTICS_TX_PACKETS,
+                             PROP_LINK_STATISTICS_RX_ERRORS,
+                             PROP_LINK_STATISTICS_TX_ERRORS,
+                             PROP_LINK_STATISTICS_RX_DROPPED,
+                             PROP_LINK_STATISTICS_TX_DROPPED,
+                             PROP_LINK_STATISTICS_MULTICAST,
+                             PROP_LINK_STATISTICS_COLLISIONS,
+                             PROP_LINK_STATISTICS_RX_NOHANDLER,
                              PROP_IP4_CONNECTIVITY,
                              PROP_IP6_CONNECTIVITY,
                              PROP_INTERFACE_FLAGS,
@@ -397,6 +452,17 @@ typedef struct _NMDevicePrivate {
 
     NMDeviceState       state;
     NMDeviceStateReason state_reason;
+
+    struct {
+        gint64 start_msec;
+        gint64 state_enter_msec;
+
+        /* milliseconds spent in the states from "prepare" up to "secondaries",
+         * indexed by _activation_timing_idx(). */
+        guint32 state_msec[6];
+        guint8  visited;
+    } activation_timing;
+
     struct {
         guint id;
 
@@ -597,6 +663,7 @@ typedef struct _NMDevicePrivate {
     bool tc_committed : 1;
 
     NMDeviceStageState stage1_sriov_state : 3;
+    NMDeviceStageState stage2_ethtool_state : 3;
 
     char *current_stable_id;
 
@@ -699,6 +766,7 @@ typedef struct _NMDevicePrivate {
     GHashTable *ip6_saved_properties;
 
     EthtoolState *ethtool_state;
+    EthtoolJob   *ethtool_job;
 
     /* master interface for bridge/bond/team slave */
     NMDevice *master;
@@ -747,10 +815,16 @@ typedef struct _NMDevicePrivate {
     guint sriov_reset_pending;
 
     struct {
-        GSource *timeout_source;
-        guint    refresh_rate_ms;
-        guint64  tx_bytes;
-        guint64  rx_bytes;
+        struct _StatsPoller *poller;
+        CList                poller_lst;
+        NMDevice            *poller_device; /* back-pointer for the poller */
+        guint                refresh_rate_ms;
+        guint64              tx_bytes;
+        guint64              rx_bytes;
+
+        /* the extended counters, only updated via RTM_GETSTATS while polling.
+         * The ifindex field is unused. */
+        NMPlatformLinkStats link;
     } stats;
 
     bool mtu_force_set_done : 1;
@@ -962,6 +1036,9 @@ update_prop_ip_iface(NMDevice *self)
     const char      *ip_iface = NULL;
     gs_free char    *to_free  = NULL;
 
+    if (priv->manager)
+        nm_manager_device_ip_iface_updated(priv->manager, self);
+
     if (nm_device_get_ip_ifindex(self) > 0
         && (priv->state == NM_DEVICE_STATE_UNMANAGED
             || (priv->state >= NM_DEVICE_STATE_IP_CHECK
@@ -2345,76 +2422,82 @@ _prop_get_x_generate_mac_address_mask(NMDevice *self, NMConnection *connection,
 /*****************************************************************************/
 
 static void
-_ethtool_features_reset(NMDevice *self, NMPlatform *platform, EthtoolState *ethtool_state)
+_ethtool_state_free(EthtoolState *ethtool_state)
+{
+    g_free(ethtool_state->features);
+    g_free(ethtool_state->coalesce);
+    g_free(ethtool_state->ring);
+    g_free(ethtool_state->pause);
+    g_free(ethtool_state);
+}
+
+static EthtoolResult
+_ethtool_features_reset(NMPlatform *platform, EthtoolState *ethtool_state)
 {
     gs_free NMEthtoolFeatureStates *features = NULL;
 
     features = g_steal_pointer(&ethtool_state->features);
+    if (!features)
+        return ETHTOOL_RESULT_NONE;
 
     if (!nm_platform_ethtool_set_features(platform,
                                           ethtool_state->ifindex,
                                           features,
                                           ethtool_state->requested,
                                           FALSE))
-        _LOGW(LOGD_DEVICE, "ethtool: failure resetting one or more offload features");
-    else
-        _LOGD(LOGD_DEVICE, "ethtool: offload features successfully reset");
+        return ETHTOOL_RESULT_FAILURE;
+
+    return ETHTOOL_RESULT_SUCCESS;
 }
 
-static void
-_ethtool_features_set(NMDevice         *self,
-                      NMPlatform       *platform,
+static EthtoolResult
+_ethtool_features_set(NMPlatform       *platform,
                       EthtoolState     *ethtool_state,
                       NMSettingEthtool *s_ethtool)
 {
     gs_free NMEthtoolFeatureStates *features = NULL;
+    gboolean                        success;
 
-    if (ethtool_state->features)
-        _ethtool_features_reset(self, platform, ethtool_state);
+    nm_assert(!ethtool_state->features);
 
     if (nm_setting_ethtool_init_features(s_ethtool, ethtool_state->requested) == 0)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     features = nm_platform_ethtool_get_link_features(platform, ethtool_state->ifindex);
-    if (!features) {
-        _LOGW(LOGD_DEVICE, "ethtool: failure setting offload features (cannot read features)");
-        return;
-    }
+    if (!features)
+        return ETHTOOL_RESULT_FAILURE_READ;
 
-    if (!nm_platform_ethtool_set_features(platform,
-                                          ethtool_state->ifindex,
-                                          features,
-                                          ethtool_state->requested,
-                                          TRUE))
-        _LOGW(LOGD_DEVICE, "ethtool: failure setting one or more offload features");
-    else
-        _LOGD(LOGD_DEVICE, "ethtool: offload features successfully set");
+    success = nm_platform_ethtool_set_features(platform,
+                                               ethtool_state->ifindex,
+                                               features,
+                                               ethtool_state->requested,
+                                               TRUE);
 
     ethtool_state->features = g_steal_pointer(&features);
+
+    return success ? ETHTOOL_RESULT_SUCCESS : ETHTOOL_RESULT_FAILURE;
 }
 
-static void
-_ethtool_coalesce_reset(NMDevice *self, NMPlatform *platform, EthtoolState *ethtool_state)
+static EthtoolResult
+_ethtool_coalesce_reset(NMPlatform *platform, EthtoolState *ethtool_state)
 {
     gs_free NMEthtoolCoalesceState *coalesce = NULL;
 
-    nm_assert(NM_IS_DEVICE(self));
     nm_assert(NM_IS_PLATFORM(platform));
     nm_assert(ethtool_state);
 
     coalesce = g_steal_pointer(&ethtool_state->coalesce);
     if (!coalesce)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     if (!nm_platform_ethtool_set_coalesce(platform, ethtool_state->ifindex, coalesce))
-        _LOGW(LOGD_DEVICE, "ethtool: failure resetting one or more coalesce settings");
-    else
-        _LOGD(LOGD_DEVICE, "ethtool: coalesce settings successfully reset");
+        return ETHTOOL_RESULT_FAILURE;
+
+    return ETHTOOL_RESULT_SUCCESS;
 }
 
-static void
-_ethtool_coalesce_set(NMDevice         *self,
-                      NMPlatform       *platform,
+static EthtoolResult
+_ethtool_coalesce_set(NMPlatform       *platform,
                       EthtoolState     *ethtool_state,
                       NMSettingEthtool *s_ethtool)
 {
@@ -2426,7 +2509,6 @@ _ethtool_coalesce_set(NMDevice         *self,
     const char            *name;
     GVariant              *variant;
 
-    nm_assert(NM_IS_DEVICE(self));
     nm_assert(NM_IS_PLATFORM(platform));
     nm_assert(NM_IS_SETTING_ETHTOOL(s_ethtool));
     nm_assert(ethtool_state);
@@ -2434,7 +2516,7 @@ _ethtool_coalesce_set(NMDevice         *self,
 
     hash = _nm_setting_option_hash(NM_SETTING(s_ethtool), FALSE);
     if (!hash)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     g_hash_table_iter_init(&iter, hash);
     while (g_hash_table_iter_next(&iter, (gpointer *) &name, (gpointer *) &variant)) {
@@ -2446,10 +2528,8 @@ _ethtool_coalesce_set(NMDevice         *self,
         if (!has_old) {
             if (!nm_platform_ethtool_get_link_coalesce(platform,
                                                        ethtool_state->ifindex,
-                                                       &coalesce_old)) {
-                _LOGW(LOGD_DEVICE, "ethtool: failure getting coalesce settings (cannot read)");
-                return;
-            }
+                                                       &coalesce_old))
+                return ETHTOOL_RESULT_FAILURE_READ;
             has_old      = TRUE;
             coalesce_new = coalesce_old;
         }
@@ -2459,42 +2539,36 @@ _ethtool_coalesce_set(NMDevice         *self,
     }
 
     if (!has_old)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     ethtool_state->coalesce = nm_memdup(&coalesce_old, sizeof(coalesce_old));
 
-    if (!nm_platform_ethtool_set_coalesce(platform, ethtool_state->ifindex, &coalesce_new)) {
-        _LOGW(LOGD_DEVICE, "ethtool: failure setting coalesce settings");
-        return;
-    }
+    if (!nm_platform_ethtool_set_coalesce(platform, ethtool_state->ifindex, &coalesce_new))
+        return ETHTOOL_RESULT_FAILURE;
 
-    _LOGD(LOGD_DEVICE, "ethtool: coalesce settings successfully set");
+    return ETHTOOL_RESULT_SUCCESS;
 }
 
-static void
-_ethtool_ring_reset(NMDevice *self, NMPlatform *platform, EthtoolState *ethtool_state)
+static EthtoolResult
+_ethtool_ring_reset(NMPlatform *platform, EthtoolState *ethtool_state)
 {
     gs_free NMEthtoolRingState *ring = NULL;
 
-    nm_assert(NM_IS_DEVICE(self));
     nm_assert(NM_IS_PLATFORM(platform));
     nm_assert(ethtool_state);
 
     ring = g_steal_pointer(&ethtool_state->ring);
     if (!ring)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     if (!nm_platform_ethtool_set_ring(platform, ethtool_state->ifindex, ring))
-        _LOGW(LOGD_DEVICE, "ethtool: failure resetting one or more ring settings");
-    else
-        _LOGD(LOGD_DEVICE, "ethtool: ring settings successfully reset");
+        return ETHTOOL_RESULT_FAILURE;
+
+    return ETHTOOL_RESULT_SUCCESS;
 }
 
-static void
-_ethtool_ring_set(NMDevice         *self,
-                  NMPlatform       *platform,
-                  EthtoolState     *ethtool_state,
-                  NMSettingEthtool *s_ethtool)
+static EthtoolResult
+_ethtool_ring_set(NMPlatform *platform, EthtoolState *ethtool_state, NMSettingEthtool *s_ethtool)
 {
     NMEthtoolRingState ring_old;
     NMEthtoolRingState ring_new;
@@ -2504,7 +2578,6 @@ _ethtool_ring_set(NMDevice         *self,
     GVariant          *variant;
     gboolean           has_old = FALSE;
 
-    nm_assert(NM_IS_DEVICE(self));
     nm_assert(NM_IS_PLATFORM(platform));
     nm_assert(NM_IS_SETTING_ETHTOOL(s_ethtool));
     nm_assert(ethtool_state);
@@ -2512,7 +2585,7 @@ _ethtool_ring_set(NMDevice         *self,
 
     hash = _nm_setting_option_hash(NM_SETTING(s_ethtool), FALSE);
     if (!hash)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     g_hash_table_iter_init(&iter, hash);
     while (g_hash_table_iter_next(&iter, (gpointer *) &name, (gpointer *) &variant)) {
@@ -2525,11 +2598,8 @@ _ethtool_ring_set(NMDevice         *self,
         nm_assert(g_variant_is_of_type(variant, G_VARIANT_TYPE_UINT32));
 
         if (!has_old) {
-            if (!nm_platform_ethtool_get_link_ring(platform, ethtool_state->ifindex, &ring_old)) {
-                _LOGW(LOGD_DEVICE,
-                      "ethtool: failure setting ring options (cannot read existing setting)");
-                return;
-            }
+            if (!nm_platform_ethtool_get_link_ring(platform, ethtool_state->ifindex, &ring_old))
+                return ETHTOOL_RESULT_FAILURE_READ;
             has_old  = TRUE;
             ring_new = ring_old;
         }
@@ -2555,42 +2625,36 @@ _ethtool_ring_set(NMDevice         *self,
     }
 
     if (!has_old)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     ethtool_state->ring = nm_memdup(&ring_old, sizeof(ring_old));
 
-    if (!nm_platform_ethtool_set_ring(platform, ethtool_state->ifindex, &ring_new)) {
-        _LOGW(LOGD_DEVICE, "ethtool: failure setting ring settings");
-        return;
-    }
+    if (!nm_platform_ethtool_set_ring(platform, ethtool_state->ifindex, &ring_new))
+        return ETHTOOL_RESULT_FAILURE;
 
-    _LOGD(LOGD_DEVICE, "ethtool: ring settings successfully set");
+    return ETHTOOL_RESULT_SUCCESS;
 }
 
-static void
-_ethtool_pause_reset(NMDevice *self, NMPlatform *platform, EthtoolState *ethtool_state)
+static EthtoolResult
+_ethtool_pause_reset(NMPlatform *platform, EthtoolState *ethtool_state)
 {
     gs_free NMEthtoolPauseState *pause = NULL;
 
-    nm_assert(NM_IS_DEVICE(self));
     nm_assert(NM_IS_PLATFORM(platform));
     nm_assert(ethtool_state);
 
     pause = g_steal_pointer(&ethtool_state->pause);
     if (!pause)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     if (!nm_platform_ethtool_set_pause(platform, ethtool_state->ifindex, pause))
-        _LOGW(LOGD_DEVICE, "ethtool: failure resetting one or more pause settings");
-    else
-        _LOGD(LOGD_DEVICE, "ethtool: pause settings successfully reset");
+        return ETHTOOL_RESULT_FAILURE;
+
+    return ETHTOOL_RESULT_SUCCESS;
 }
 
-static void
-_ethtool_pause_set(NMDevice         *self,
-                   NMPlatform       *platform,
-                   EthtoolState     *ethtool_state,
-                   NMSettingEthtool *s_ethtool)
+static EthtoolResult
+_ethtool_pause_set(NMPlatform *platform, EthtoolState *ethtool_state, NMSettingEthtool *s_ethtool)
 {
     NMEthtoolPauseState pause_old;
     NMEthtoolPauseState pause_new;
@@ -2603,7 +2667,6 @@ _ethtool_pause_set(NMDevice         *self,
     NMTernary           pause_rx      = NM_TERNARY_DEFAULT;
     NMTernary           pause_tx      = NM_TERNARY_DEFAULT;
 
-    nm_assert(NM_IS_DEVICE(self));
     nm_assert(NM_IS_PLATFORM(platform));
     nm_assert(NM_IS_SETTING_ETHTOOL(s_ethtool));
     nm_assert(ethtool_state);
@@ -2611,7 +2674,7 @@ _ethtool_pause_set(NMDevice         *self,
 
     hash = _nm_setting_option_hash(NM_SETTING(s_ethtool), FALSE);
     if (!hash)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     g_hash_table_iter_init(&iter, hash);
     while (g_hash_table_iter_next(&iter, (gpointer *) &name, (gpointer *) &variant)) {
@@ -2623,12 +2686,8 @@ _ethtool_pause_set(NMDevice         *self,
         nm_assert(g_variant_is_of_type(variant, G_VARIANT_TYPE_BOOLEAN));
 
         if (!has_old) {
-            if (!nm_platform_ethtool_get_link_pause(platform, ethtool_state->ifindex, &pause_old)) {
-                _LOGW(LOGD_DEVICE,
-                      "ethtool: failure setting pause options (cannot read "
-                      "existing setting)");
-                return;
-            }
+            if (!nm_platform_ethtool_get_link_pause(platform, ethtool_state->ifindex, &pause_old))
+                return ETHTOOL_RESULT_FAILURE_READ;
             has_old = TRUE;
         }
 
@@ -2648,7 +2707,7 @@ _ethtool_pause_set(NMDevice         *self,
     }
 
     if (!has_old)
-        return;
+        return ETHTOOL_RESULT_NONE;
 
     if (pause_rx != NM_TERNARY_DEFAULT || pause_tx != NM_TERNARY_DEFAULT) {
         /* this implies to explicitly disable autoneg. */
@@ -2666,70 +2725,316 @@ _ethtool_pause_set(NMDevice         *self,
 
     ethtool_state->pause = nm_memdup(&pause_old, sizeof(pause_old));
 
-    if (!nm_platform_ethtool_set_pause(platform, ethtool_state->ifindex, &pause_new)) {
-        _LOGW(LOGD_DEVICE, "ethtool: failure setting pause settings");
+    if (!nm_platform_ethtool_set_pause(platform, ethtool_state->ifindex, &pause_new))
+        return ETHTOOL_RESULT_FAILURE;
+
+    return ETHTOOL_RESULT_SUCCESS;
+}
+
+/* Runs in a worker thread (or, when quitting, on the main thread). It must
+ * only access @job. */
+static void
+_ethtool_state_reset_all(NMPlatform    *platform,
+                         EthtoolState  *ethtool_state,
+                         EthtoolResult *results)
+{
+    results[ETHTOOL_GROUP_FEATURES] = _ethtool_features_reset(platform, ethtool_state);
+    results[ETHTOOL_GROUP_COALESCE] = _ethtool_coalesce_reset(platform, ethtool_state);
+    results[ETHTOOL_GROUP_RING]     = _ethtool_ring_reset(platform, ethtool_state);
+    results[ETHTOOL_GROUP_PAUSE]    = _ethtool_pause_reset(platform, ethtool_state);
+}
+
+static void
+_ethtool_job_run(EthtoolJob *job)
+{
+    NMPlatform   *platform      = job->platform;
+    EthtoolState *ethtool_state = job->ethtool_state;
+
+    if (!job->s_ethtool) {
+        _ethtool_state_reset_all(platform, ethtool_state, job->results);
         return;
     }
 
-    _LOGD(LOGD_DEVICE, "ethtool: pause settings successfully set");
+    job->results[ETHTOOL_GROUP_FEATURES] =
+        _ethtool_features_set(platform, ethtool_state, job->s_ethtool);
+    job->results[ETHTOOL_GROUP_COALESCE] =
+        _ethtool_coalesce_set(platform, ethtool_state, job->s_ethtool);
+    job->results[ETHTOOL_GROUP_RING]  = _ethtool_ring_set(platform, ethtool_state, job->s_ethtool);
+    job->results[ETHTOOL_GROUP_PAUSE] = _ethtool_pause_set(platform, ethtool_state, job->s_ethtool);
+}
+
+static void
+_ethtool_results_log(NMDevice *self, const EthtoolResult *results, gboolean is_reset)
+{
+    static const char *const group_names[_ETHTOOL_GROUP_NUM] = {
+        [ETHTOOL_GROUP_FEATURES] = "offload features",
+        [ETHTOOL_GROUP_COALESCE] = "coalesce settings",
+        [ETHTOOL_GROUP_RING]     = "ring settings",
+        [ETHTOOL_GROUP_PAUSE]    = "pause settings",
+    };
+    guint i;
+
+    for (i = 0; i < _ETHTOOL_GROUP_NUM; i++) {
+        switch (results[i]) {
+        case ETHTOOL_RESULT_NONE:
+            break;
+        case ETHTOOL_RESULT_SUCCESS:
+            _LOGD(LOGD_DEVICE,
+                  "ethtool: %s successfully %s",
+                  group_names[i],
+                  is_reset ? "reset" : "set");
+            break;
+        case ETHTOOL_RESULT_FAILURE_READ:
+            _LOGW(LOGD_DEVICE,
+                  "ethtool: failure setting %s (cannot read existing settings)",
+                  group_names[i]);
+            break;
+        case ETHTOOL_RESULT_FAILURE:
+            _LOGW(LOGD_DEVICE,
+                  "ethtool: failure %s one or more %s",
+                  is_reset ? "resetting" : "setting",
+                  group_names[i]);
+            break;
+        }
+    }
+}
+
+static void
+_ethtool_job_log(EthtoolJob *job)
+{
+    NMDevice *self = job->self;
+
+    _ethtool_results_log(self, job->results, !job->s_ethtool);
+
+    if (job->reverted) {
+        _LOGD(LOGD_DEVICE, "ethtool: activation aborted while setting options, revert them");
+        _ethtool_results_log(self, job->results_revert, TRUE);
+    }
+}
+
+static void
+_ethtool_job_free(EthtoolJob *job)
+{
+    if (job->ethtool_state)
+        _ethtool_state_free(job->ethtool_state);
+    nm_g_object_unref(job->s_ethtool);
+    g_object_unref(job->platform);
+    g_object_unref(job->self);
+    g_mutex_clear(&job->lock);
+    g_cond_clear(&job->cond);
+    nm_g_slice_free(job);
+}
+
+static void
+_ethtool_job_thread_fn(GTask        *task,
+                       gpointer      source_object,
+                       gpointer      task_data,
+                       GCancellable *cancellable)
+{
+    EthtoolJob *job = task_data;
+
+    if (!job->s_ethtool) {
+        _ethtool_job_run(job);
+        goto out;
+    }
+
+    g_mutex_lock(&job->lock);
+    if (job->aborted) {
+        /* aborted before it was our turn. Nothing was set, nothing to revert. */
+        job->state = ETHTOOL_JOB_STATE_DONE;
+        g_mutex_unlock(&job->lock);
+        goto out;
+    }
+    job->state = ETHTOOL_JOB_STATE_RUNNING;
+    g_mutex_unlock(&job->lock);
+
+    _ethtool_job_run(job);
+
+    g_mutex_lock(&job->lock);
+    if (job->aborted) {
+        /* Revert without holding the lock, the main thread must not block
+         * on it. A quitting main thread waits for ETHTOOL_JOB_STATE_DONE. */
+        g_mutex_unlock(&job->lock);
+        _ethtool_state_reset_all(job->platform, job->ethtool_state, job->results_revert);
+        g_mutex_lock(&job->lock);
+        job->reverted = TRUE;
+    }
+    job->state = ETHTOOL_JOB_STATE_DONE;
+    g_cond_broadcast(&job->cond);
+    g_mutex_unlock(&job->lock);
+
+out:
+    g_task_return_boolean(task, TRUE);
+}
+
+/* Called on the main thread when the activation that started the set-job @job
+ * goes away. If @wait, block until a worker that is currently setting the
+ * options reverted them again.
+ *
+ * Returns: (transfer full): the state to revert, if the worker completed
+ *   before the abort and can no longer revert the options by itself. */
+static EthtoolState *
+_ethtool_job_abort(EthtoolJob *job, gboolean wait)
+{
+    EthtoolState *ethtool_state = NULL;
+
+    nm_assert(job->s_ethtool);
+
+    g_mutex_lock(&job->lock);
+    if (job->state == ETHTOOL_JOB_STATE_DONE) {
+        /* _ethtool_job_cb() did not run yet, but the worker won't touch
+         * the job anymore. */
+        ethtool_state = g_steal_pointer(&job->ethtool_state);
+    } else {
+        job->aborted = TRUE;
+        while (wait && job->state == ETHTOOL_JOB_STATE_RUNNING)
+            g_cond_wait(&job->cond, &job->lock);
+    }
+    g_mutex_unlock(&job->lock);
+
+    return ethtool_state;
+}
+
+static void
+_ethtool_job_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    EthtoolJob      *job  = g_task_get_task_data(G_TASK(result));
+    NMDevice        *self = job->self;
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+    EthtoolState    *ethtool_state;
+
+    _ethtool_job_log(job);
+
+    /* If the job was aborted, _ethtool_job_abort() or the worker already took
+     * care of reverting the options. */
+    if (job->s_ethtool && priv->ethtool_job == job) {
+        priv->ethtool_job = NULL;
+
+        ethtool_state = g_steal_pointer(&job->ethtool_state);
+        if (!ethtool_state->features && !ethtool_state->coalesce && !ethtool_state->ring
+            && !ethtool_state->pause)
+            nm_clear_pointer(&ethtool_state, _ethtool_state_free);
+
+        nm_assert(!priv->ethtool_state);
+        priv->ethtool_state = ethtool_state;
+
+        if (priv->stage2_ethtool_state == NM_DEVICE_STAGE_STATE_PENDING) {
+            priv->stage2_ethtool_state = NM_DEVICE_STAGE_STATE_COMPLETED;
+            nm_device_activate_schedule_stage2_device_config(self, FALSE);
+        }
+    }
+
+    _ethtool_job_free(job);
+}
+
+static EthtoolJob *
+_ethtool_job_start(NMDevice *self, EthtoolState *ethtool_state, NMSettingEthtool *s_ethtool)
+{
+    gs_unref_object GTask *task = NULL;
+    EthtoolJob            *job;
+
+    job  = g_slice_new(EthtoolJob);
+    *job = (EthtoolJob){
+        .self          = g_object_ref(self),
+        .platform      = g_object_ref(nm_device_get_platform(self)),
+        .s_ethtool     = s_ethtool,
+        .ethtool_state = ethtool_state,
+        .state         = ETHTOOL_JOB_STATE_PENDING,
+    };
+    g_mutex_init(&job->lock);
+    g_cond_init(&job->cond);
+
+    /* The job is freed by _ethtool_job_cb() on the main thread, as it holds
+     * a reference to the device. */
+    task = nm_g_task_new(NULL, NULL, _ethtool_job_start, _ethtool_job_cb, NULL);
+    g_task_set_task_data(task, job, NULL);
+
+    /* Jobs for the same interface run in order, so that a reset never
+     * overtakes the set it reverts. */
+    nmp_utils_worker_run_task_serialized(task,
+                                         NMP_UTILS_WORKER_POOL_DEFAULT,
+                                         _ethtool_job_thread_fn,
+                                         ethtool_state->ifindex);
+    return job;
 }
 
 static void
 _ethtool_state_reset(NMDevice *self)
 {
-    NMPlatform           *platform      = nm_device_get_platform(self);
-    NMDevicePrivate      *priv          = NM_DEVICE_GET_PRIVATE(self);
-    gs_free EthtoolState *ethtool_state = g_steal_pointer(&priv->ethtool_state);
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+    EthtoolState    *ethtool_state;
+    EthtoolJob      *job;
+    gboolean         quitting;
+
+    quitting = !!nm_device_get_unmanaged_flags(self, NM_UNMANAGED_QUITTING);
+
+    job = g_steal_pointer(&priv->ethtool_job);
+    if (job) {
+        /* A job is still setting the options. Either it reverts them itself,
+         * or we queue the revert now, so that it runs before any later job for
+         * the interface. When quitting, the worker might not get its turn
+         * after we are gone, so wait for a running one. */
+        nm_assert(!priv->ethtool_state);
+        priv->ethtool_state = _ethtool_job_abort(job, quitting);
+    }
 
+    ethtool_state = g_steal_pointer(&priv->ethtool_state);
     if (!ethtool_state)
         return;
 
-    if (ethtool_state->features)
-        _ethtool_features_reset(self, platform, ethtool_state);
-    if (ethtool_state->coalesce)
-        _ethtool_coalesce_reset(self, platform, ethtool_state);
-    if (ethtool_state->ring)
-        _ethtool_ring_reset(self, platform, ethtool_state);
-    if (ethtool_state->pause)
-        _ethtool_pause_reset(self, platform, ethtool_state);
+    if (quitting) {
+        EthtoolJob job_sync = {
+            .self          = self,
+            .platform      = nm_device_get_platform(self),
+            .ethtool_state = ethtool_state,
+        };
+
+        /* We are about to exit and a worker might not get its turn. It's OK
+         * to block here. */
+        _ethtool_job_run(&job_sync);
+        _ethtool_job_log(&job_sync);
+        _ethtool_state_free(ethtool_state);
+        return;
+    }
+
+    _ethtool_job_start(self, ethtool_state, NULL);
 }
 
-static void
+/* Returns: %TRUE if a job was started to set the ethtool options. Stage2
+ * then waits for it to complete. */
+static gboolean
 _ethtool_state_set(NMDevice *self)
 {
-    int                   ifindex;
-    NMPlatform           *platform;
-    NMConnection         *connection;
-    NMSettingEthtool     *s_ethtool;
-    gs_free EthtoolState *ethtool_state = NULL;
-    NMDevicePrivate      *priv          = NM_DEVICE_GET_PRIVATE(self);
+    int               ifindex;
+    NMConnection     *connection;
+    NMSettingEthtool *s_ethtool;
+    EthtoolState     *ethtool_state;
+    NMDevicePrivate  *priv = NM_DEVICE_GET_PRIVATE(self);
 
     ifindex = nm_device_get_ip_ifindex(self);
     if (ifindex <= 0)
-        return;
-
-    platform = nm_device_get_platform(self);
-    nm_assert(platform);
+        return FALSE;
 
     connection = nm_device_get_applied_connection(self);
     if (!connection)
-        return;
+        return FALSE;
 
     s_ethtool = NM_SETTING_ETHTOOL(nm_connection_get_setting(connection, NM_TYPE_SETTING_ETHTOOL));
     if (!s_ethtool)
-        return;
+        return FALSE;
+
+    nm_assert(!priv->ethtool_job);
+    nm_assert(!priv->ethtool_state);
 
     ethtool_state          = g_new0(EthtoolState, 1);
     ethtool_state->ifindex = ifindex;
 
-    _ethtool_features_set(self, platform, ethtool_state, s_ethtool);
-    _ethtool_coalesce_set(self, platform, ethtool_state, s_ethtool);
-    _ethtool_ring_set(self, platform, ethtool_state, s_ethtool);
-    _ethtool_pause_set(self, platform, ethtool_state, s_ethtool);
-
-    if (ethtool_state->features || ethtool_state->coalesce || ethtool_state->ring
-        || ethtool_state->pause)
-        priv->ethtool_state = g_steal_pointer(&ethtool_state);
+    /* The worker gets its own copy of the setting. */
+    priv->ethtool_job =
+        _ethtool_job_start(self,
+                           ethtool_state,
+                           NM_SETTING_ETHTOOL(nm_setting_duplicate(NM_SETTING(s_ethtool))));
+    return TRUE;
 }
 
 /*****************************************************************************/
@@ -4750,22 +5055,227 @@ _stats_update_counters_from_pllink(NMDevice *self, const NMPlatformLink *pllink)
     _stats_update_counters(self, pllink->tx_bytes, pllink->rx_bytes);
 }
 
+static _PropertyEnums
+_stats_set_counter(guint64 *counter, guint64 value, _PropertyEnums prop)
+{
+    if (*counter == value)
+        return PROP_0;
+    *counter = value;
+    return prop;
+}
+
+static void
+_stats_update_link_stats(NMDevice *self, const NMPlatformLinkStats *link_stats)
+{
+    static const NMPlatformLinkStats link_stats_zero = {};
+    NMPlatformLinkStats             *l               = &NM_DEVICE_GET_PRIVATE(self)->stats.link;
+
+    if (!link_stats)
+        link_stats = &link_stats_zero;
+
+    _stats_update_counters(self, link_stats->tx_bytes, link_stats->rx_bytes);
+
+    nm_gobject_notify_together(
+        self,
+        _stats_set_counter(&l->rx_packets,
+                           link_stats->rx_packets,
+                           PROP_LINK_STATISTICS_RX_PACKETS),
+        _stats_set_counter(&l->tx_packets,
+                           link_stats->tx_packets,
+                           PROP_LINK_STATISTICS_TX_PACKETS),
+        _stats_set_counter(&l->rx_errors, link_stats->rx_errors, PROP_LINK_STATISTICS_RX_ERRORS),
+        _stats_set_counter(&l->tx_errors, link_stats->tx_errors, PROP_LINK_STATISTICS_TX_ERRORS),
+        _stats_set_counter(&l->rx_dropped,
+                           link_stats->rx_dropped,
+                           PROP_LINK_STATISTICS_RX_DROPPED),
+        _stats_set_counter(&l->tx_dropped,
+                           link_stats->tx_dropped,
+                           PROP_LINK_STATISTICS_TX_DROPPED),
+        _stats_set_counter(&l->multicast, link_stats->multicast, PROP_LINK_STATISTICS_MULTICAST),
+        _stats_set_counter(&l->collisions,
+                           link_stats->collisions,
+                           PROP_LINK_STATISTICS_COLLISIONS),
+        _stats_set_counter(&l->rx_nohandler,
+                           link_stats->rx_nohandler,
+                           PROP_LINK_STATISTICS_RX_NOHANDLER));
+}
+
+/* All devices that refresh their statistics at the same rate in the same
+ * network namespace share one StatsPoller. On each tick, it requests one
+ * RTM_GETSTATS dump with the counters of all links and hands them to the
+ * devices directly.
+ *
+ * If that is not supported, it falls back to either refresh the links one by
+ * one, or -- if they make up a large part of all links -- to request one dump
+ * of all links. In that case, the updated byte counters reach the devices via
+ * the platform cache and device_link_changed().
+ *
+ * The poller is ref-counted, because updating the statistics emits signals
+ * and processes netlink events, which may remove devices from the poller.
+ * When the last device leaves, the poller is unlinked and its timeout source
+ * destroyed. The tick keeps it alive until it returns. */
+typedef struct _StatsPoller {
+    CList       pollers_lst;
+    CList       devices_lst_head;
+    NMPlatform *platform;
+    GSource    *timeout_source;
+    int         ref_count;
+    guint       refresh_rate_ms;
+    guint       n_devices;
+} StatsPoller;
+
+static CList stats_pollers_lst_head = C_LIST_INIT(stats_pollers_lst_head);
+
+static void
+_stats_poller_unref(StatsPoller *poller)
+{
+    nm_assert(poller->ref_count > 0);
+
+    if (--poller->ref_count > 0)
+        return;
+
+    nm_assert(poller->n_devices == 0);
+    nm_assert(!poller->timeout_source);
+
+    g_object_unref(poller->platform);
+    nm_g_slice_free(poller);
+}
+
 static gboolean
-_stats_timeout_cb(gpointer user_data)
+_stats_poller_timeout_cb(gpointer user_data)
 {
-    NMDevice *self = user_data;
-    int       ifindex;
+    StatsPoller                 *poller    = user_data;
+    gs_unref_array GArray       *stats_arr = NULL;
+    const NMDedupMultiHeadEntry *head_entry;
+    NMDevicePrivate             *priv;
+    gs_free int                 *ifindexes_free = NULL;
+    int                         *ifindexes;
+    guint                        n_ifindexes;
+    guint                        i;
+
+    poller->ref_count++;
+
+    stats_arr = nm_platform_link_stats_dump(poller->platform);
+    if (stats_arr) {
+        gs_unref_ptrarray GPtrArray *devices = NULL;
+
+        /* take references first. Notifying property changes may cause
+         * devices to leave the poller. */
+        devices = g_ptr_array_new_full(poller->n_devices, g_object_unref);
+        c_list_for_each_entry (priv, &poller->devices_lst_head, stats.poller_lst)
+            g_ptr_array_add(devices, g_object_ref(priv->stats.poller_device));
+
+        /* the poller stays valid while we hold the reference, but once the last
+         * device left, there is nobody to update. */
+        for (i = 0; i < devices->len && poller->timeout_source; i++) {
+            NMDevice                  *device = devices->pdata[i];
+            const NMPlatformLinkStats  needle = {.ifindex = nm_device_get_ip_ifindex(device)};
+            const NMPlatformLinkStats *stats;
+
+            if (needle.ifindex <= 0 || NM_DEVICE_GET_PRIVATE(device)->stats.poller != poller)
+                continue;
 
-    ifindex = nm_device_get_ip_ifindex(self);
+            stats = bsearch(&needle,
+                            stats_arr->data,
+                            stats_arr->len,
+                            sizeof(NMPlatformLinkStats),
+                            nm_platform_link_stats_cmp_ifindex);
+            if (stats)
+                _stats_update_link_stats(device, stats);
+        }
+        goto out;
+    }
 
-    _LOGT(LOGD_DEVICE, "stats: refresh %d", ifindex);
+    head_entry = nm_platform_lookup_obj_type(poller->platform, NMP_OBJECT_TYPE_LINK);
 
-    if (ifindex > 0)
-        nm_platform_link_refresh(nm_device_get_platform(self), ifindex);
+    if (poller->n_devices > 1 && head_entry && poller->n_devices * 4 >= head_entry->len) {
+        nm_log_trace(LOGD_DEVICE,
+                     "stats: refresh all links for %u devices (every %u ms)",
+                     poller->n_devices,
+                     poller->refresh_rate_ms);
+        nm_platform_refresh_all(poller->platform, NMP_OBJECT_TYPE_LINK);
+        goto out;
+    }
+
+    /* collect the ifindexes first. Refreshing a link processes netlink events,
+     * which should not happen while iterating the list. */
+    ifindexes   = nm_malloc_maybe_a(300, sizeof(int) * poller->n_devices, &ifindexes_free);
+    n_ifindexes = 0;
+    c_list_for_each_entry (priv, &poller->devices_lst_head, stats.poller_lst) {
+        int ifindex;
 
+        /* like nm_device_get_ip_ifindex(). */
+        ifindex = priv->ip_iface ? priv->ip_ifindex : priv->ifindex;
+        if (ifindex > 0)
+            ifindexes[n_ifindexes++] = ifindex;
+    }
+
+    for (i = 0; i < n_ifindexes && poller->timeout_source; i++) {
+        nm_log_trace(LOGD_DEVICE, "stats: refresh %d", ifindexes[i]);
+        nm_platform_link_refresh(poller->platform, ifindexes[i]);
+    }
+
+out:
+    /* if the poller was dropped meanwhile, its source is already destroyed and
+     * the return value no longer matters. */
+    _stats_poller_unref(poller);
     return G_SOURCE_CONTINUE;
 }
 
+static void
+_stats_poller_remove(NMDevice *self)
+{
+    NMDevicePrivate *priv   = NM_DEVICE_GET_PRIVATE(self);
+    StatsPoller     *poller = priv->stats.poller;
+
+    if (!poller)
+        return;
+
+    priv->stats.poller = NULL;
+    c_list_unlink(&priv->stats.poller_lst);
+
+    nm_assert(poller->n_devices > 0);
+    if (--poller->n_devices > 0)
+        return;
+
+    c_list_unlink_stale(&poller->pollers_lst);
+    nm_clear_g_source_inst(&poller->timeout_source);
+    _stats_poller_unref(poller);
+}
+
+static void
+_stats_poller_add(NMDevice *self, guint refresh_rate_ms)
+{
+    NMDevicePrivate *priv     = NM_DEVICE_GET_PRIVATE(self);
+    NMPlatform      *platform = nm_device_get_platform(self);
+    StatsPoller     *poller;
+
+    nm_assert(refresh_rate_ms > 0);
+    nm_assert(!priv->stats.poller);
+
+    c_list_for_each_entry (poller, &stats_pollers_lst_head, pollers_lst) {
+        if (poller->platform == platform && poller->refresh_rate_ms == refresh_rate_ms)
+            goto found;
+    }
+
+    poller  = g_slice_new(StatsPoller);
+    *poller = (StatsPoller){
+        .devices_lst_head = C_LIST_INIT(poller->devices_lst_head),
+        .platform         = g_object_ref(platform),
+        .ref_count        = 1,
+        .refresh_rate_ms  = refresh_rate_ms,
+    };
+    c_list_link_tail(&stats_pollers_lst_head, &poller->pollers_lst);
+    poller->timeout_source =
+        nm_g_timeout_add_source(refresh_rate_ms, _stats_poller_timeout_cb, poller);
+
+found:
+    priv->stats.poller        = poller;
+    priv->stats.poller_device = self;
+    c_list_link_tail(&poller->devices_lst_head, &priv->stats.poller_lst);
+    poller->n_devices++;
+}
+
 static guint
 _stats_refresh_rate_real(guint refresh_rate_ms)
 {
@@ -4808,7 +5318,7 @@ _stats_set_refresh_rate(NMDevice *self, guint refresh_rate_ms)
     if (_stats_refresh_rate_real(old_rate) == refresh_rate_ms)
         return;
 
-    nm_clear_g_source_inst(&priv->stats.timeout_source);
+    _stats_poller_remove(self);
 
     if (!refresh_rate_ms)
         return;
@@ -4820,7 +5330,7 @@ _stats_set_refresh_rate(NMDevice *self, guint refresh_rate_ms)
     if (ifindex > 0)
         nm_platform_link_refresh(nm_device_get_platform(self), ifindex);
 
-    priv->stats.timeout_source = nm_g_timeout_add_source(refresh_rate_ms, _stats_timeout_cb, self);
+    _stats_poller_add(self, refresh_rate_ms);
 }
 
 /*****************************************************************************/
@@ -7146,6 +7656,13 @@ nm_device_update_from_platform_link(NMDevice *self, const NMPlatformLink *plink)
 
 /*****************************************************************************/
 
+static void
+sriov_op_free(SriovOp *op)
+{
+    g_strfreev((char **) op->vfs);
+    nm_g_slice_free(op);
+}
+
 static void
 sriov_op_start(NMDevice *self, SriovOp *op)
 {
@@ -7155,6 +7672,7 @@ sriov_op_start(NMDevice *self, SriovOp *op)
 
     op->cancellable     = g_cancellable_new();
     op->device          = g_object_ref(self);
+    op->start_msec      = nm_utils_get_monotonic_timestamp_msec();
     priv->sriov.pending = op;
 
     nm_platform_link_set_sriov_params_async(nm_device_get_platform(self),
@@ -7167,9 +7685,8 @@ sriov_op_start(NMDevice *self, SriovOp *op)
 }
 
 static void
-sriov_op_cb(GError *error, gpointer user_data)
+sriov_op_complete(SriovOp *op, GError *error)
 {
-    SriovOp                  *op   = user_data;
     gs_unref_object NMDevice *self = op->device;
     NMDevicePrivate          *priv = NM_DEVICE_GET_PRIVATE(self);
 
@@ -7181,13 +7698,54 @@ sriov_op_cb(GError *error, gpointer user_data)
         op->callback(error, op->callback_data);
 
     priv->sriov.pending = NULL;
-    nm_g_slice_free(op);
+    sriov_op_free(op);
 
     if (priv->sriov.next) {
         sriov_op_start(self, g_steal_pointer(&priv->sriov.next));
     }
 }
 
+static void
+sriov_op_vfs_cb(GError *error, gpointer user_data)
+{
+    SriovOp  *op   = user_data;
+    NMDevice *self = op->device;
+
+    if (!error) {
+        _LOGD(LOGD_DEVICE,
+              "sriov: %u VFs configured after %" G_GINT64_FORMAT " ms",
+              NM_PTRARRAY_LEN(op->vfs),
+              nm_utils_get_monotonic_timestamp_msec() - op->start_msec);
+    }
+
+    sriov_op_complete(op, error);
+}
+
+static void
+sriov_op_cb(GError *error, gpointer user_data)
+{
+    SriovOp  *op   = user_data;
+    NMDevice *self = op->device;
+
+    if (!error && op->vfs) {
+        /* The VFs exist now. Configure them in the same operation, so that a
+         * queued follow-up operation cannot reset the VFs concurrently. */
+        _LOGD(LOGD_DEVICE,
+              "sriov: %u VFs created after %" G_GINT64_FORMAT " ms, configuring them",
+              op->num_vfs,
+              nm_utils_get_monotonic_timestamp_msec() - op->start_msec);
+        nm_platform_link_set_sriov_vfs_async(nm_device_get_platform(self),
+                                             NM_DEVICE_GET_PRIVATE(self)->ifindex,
+                                             (const NMPlatformVF *const *) op->vfs,
+                                             sriov_op_vfs_cb,
+                                             op,
+                                             op->cancellable);
+        return;
+    }
+
+    sriov_op_complete(op, error);
+}
+
 static void
 sriov_op_queue_op(NMDevice *self, SriovOp *op)
 {
@@ -7206,7 +7764,7 @@ sriov_op_queue_op(NMDevice *self, SriovOp *op)
             op_next->callback(error, op_next->callback_data);
         }
 
-        nm_g_slice_free(op_next);
+        sriov_op_free(op_next);
         return;
     }
 
@@ -7224,6 +7782,7 @@ static void
 sriov_op_queue(NMDevice               *self,
                guint                   num_vfs,
                NMOptionBool            autoprobe,
+               NMPlatformVF          **vfs,
                NMPlatformAsyncCallback callback,
                gpointer                callback_data)
 {
@@ -7252,6 +7811,7 @@ sriov_op_queue(NMDevice               *self,
     *op = (SriovOp){
         .num_vfs       = num_vfs,
         .autoprobe     = autoprobe,
+        .vfs           = vfs,
         .callback      = callback,
         .callback_data = callback_data,
     };
@@ -7275,7 +7835,7 @@ device_init_static_sriov_num_vfs(NMDevice *self)
                                                          -1,
                                                          -1);
         if (num_vfs >= 0)
-            sriov_op_queue(self, num_vfs, NM_OPTION_BOOL_DEFAULT, NULL, NULL);
+            sriov_op_queue(self, num_vfs, NM_OPTION_BOOL_DEFAULT, NULL, NULL, NULL);
     }
 }
 
@@ -7439,12 +7999,10 @@ realize_start_setup(NMDevice             *self,
 
     nm_device_set_carrier_from_platform(self);
 
-    nm_assert(!priv->stats.timeout_source);
+    nm_assert(!priv->stats.poller);
     refresh_rate_ms = _stats_refresh_rate_real(priv->stats.refresh_rate_ms);
-    if (refresh_rate_ms > 0) {
-        priv->stats.timeout_source =
-            nm_g_timeout_add_source(refresh_rate_ms, _stats_timeout_cb, self);
-    }
+    if (refresh_rate_ms > 0)
+        _stats_poller_add(self, refresh_rate_ms);
 
     klass->realize_start_notify(self, plink);
 
@@ -7624,8 +8182,8 @@ nm_device_unrealize(NMDevice *self, gboolean remove_resources, GError **error)
         _notify(self, PROP_PHYSICAL_PORT_ID);
     }
 
-    nm_clear_g_source_inst(&priv->stats.timeout_source);
-    _stats_update_counters(self, 0, 0);
+    _stats_poller_remove(self);
+    _stats_update_link_stats(self, NULL);
 
     priv->hw_addr_len_ = 0;
     if (nm_clear_g_free(&priv->hw_addr))
@@ -9282,11 +9840,8 @@ sriov_vf_config_to_platform(NMDevice *self, NMSriovVF *vf, GError **error)
 static void
 sriov_params_cb(GError *error, gpointer user_data)
 {
-    NMDevice                    *self;
-    NMDevicePrivate             *priv;
-    nm_auto_freev NMPlatformVF **plat_vfs = NULL;
-
-    nm_utils_user_data_unpack(user_data, &self, &plat_vfs);
+    NMDevice        *self = user_data;
+    NMDevicePrivate *priv;
 
     if (nm_utils_error_is_cancelled_or_disposing(error))
         return;
@@ -9294,17 +9849,7 @@ sriov_params_cb(GError *error, gpointer user_data)
     priv = NM_DEVICE_GET_PRIVATE(self);
 
     if (error) {
-        _LOGE(LOGD_DEVICE, "failed to set SR-IOV parameters: %s", error->message);
-        nm_device_state_changed(self,
-                                NM_DEVICE_STATE_FAILED,
-                                NM_DEVICE_STATE_REASON_SRIOV_CONFIGURATION_FAILED);
-        return;
-    }
-
-    if (!nm_platform_link_set_sriov_vfs(nm_device_get_platform(self),
-                                        priv->ifindex,
-                                        (const NMPlatformVF *const *) plat_vfs)) {
-        _LOGE(LOGD_DEVICE, "failed to apply SR-IOV VFs");
+        _LOGE(LOGD_DEVICE, "failed to apply SR-IOV configuration: %s", error->message);
         nm_device_state_changed(self,
                                 NM_DEVICE_STATE_FAILED,
                                 NM_DEVICE_STATE_REASON_SRIOV_CONFIGURATION_FAILED);
@@ -9400,8 +9945,9 @@ activate_stage1_device_prepare(NMDevice *self)
             sriov_op_queue(self,
                            nm_setting_sriov_get_total_vfs(s_sriov),
                            NM_TERNARY_TO_OPTION_BOOL(autoprobe),
+                           g_steal_pointer(&plat_vfs),
                            sriov_params_cb,
-                           nm_utils_user_data_pack(self, g_steal_pointer(&plat_vfs)));
+                           self);
             priv->stage1_sriov_state = NM_DEVICE_STAGE_STATE_PENDING;
             return;
         }
@@ -9692,8 +10238,17 @@ activate_stage2_device_config(NMDevice *self)
 
     nm_device_state_changed(self, NM_DEVICE_STATE_CONFIG, NM_DEVICE_STATE_REASON_NONE);
 
-    if (!nm_device_sys_iface_state_is_external_or_assume(self))
-        _ethtool_state_set(self);
+    if (!nm_device_sys_iface_state_is_external_or_assume(self)) {
+        if (priv->stage2_ethtool_state == NM_DEVICE_STAGE_STATE_PENDING)
+            return;
+        if (priv->stage2_ethtool_state == NM_DEVICE_STAGE_STATE_INIT) {
+            if (_ethtool_state_set(self)) {
+                priv->stage2_ethtool_state = NM_DEVICE_STAGE_STATE_PENDING;
+                return;
+            }
+            priv->stage2_ethtool_state = NM_DEVICE_STAGE_STATE_COMPLETED;
+        }
+    }
 
     if (!nm_device_sys_iface_state_is_external_or_assume(self)) {
         if (!priv->tc_committed && !tc_commit(self)) {
@@ -14354,9 +14909,10 @@ _set_unmanaged_flags(NMDevice           *self,
         if (!NM_FLAGS_HAS(flags, NM_UNMANAGED_USER_SETTINGS)) {
             gboolean unmanaged;
 
-            unmanaged = nm_device_spec_match_list(
+            unmanaged = nm_device_spec_match_matcher(
                 self,
-                nm_settings_get_unmanaged_specs(NM_DEVICE_GET_PRIVATE(self)->settings));
+                nm_settings_get_unmanaged_matcher(NM_DEVICE_GET_PRIVATE(self)->settings),
+                FALSE);
             nm_device_set_unmanaged_flags(self, NM_UNMANAGED_USER_SETTINGS, !!unmanaged);
         }
 
@@ -14495,7 +15051,9 @@ nm_device_check_unrealized_device_managed(NMDevice *self)
                                                   TRUE))
         return FALSE;
 
-    if (nm_device_spec_match_list(self, nm_settings_get_unmanaged_specs(priv->settings)))
+    if (nm_device_spec_match_matcher(self,
+                                     nm_settings_get_unmanaged_matcher(priv->settings),
+                                     FALSE))
         return FALSE;
 
     return TRUE;
@@ -14520,9 +15078,10 @@ nm_device_set_unmanaged_by_user_settings(NMDevice *self, gboolean now)
         return;
     }
 
-    unmanaged = nm_device_spec_match_list(
+    unmanaged = nm_device_spec_match_matcher(
         self,
-        nm_settings_get_unmanaged_specs(NM_DEVICE_GET_PRIVATE(self)->settings));
+        nm_settings_get_unmanaged_matcher(NM_DEVICE_GET_PRIVATE(self)->settings),
+        FALSE);
 
     _set_unmanaged_flags(self,
                          NM_UNMANAGED_USER_SETTINGS,
@@ -15308,7 +15867,8 @@ _cleanup_generic_pre(NMDevice *self, CleanupType cleanup_type)
 
     _cancel_activation(self);
 
-    priv->stage1_sriov_state = NM_DEVICE_STAGE_STATE_INIT;
+    priv->stage1_sriov_state   = NM_DEVICE_STAGE_STATE_INIT;
+    priv->stage2_ethtool_state = NM_DEVICE_STAGE_STATE_INIT;
 
     if (cleanup_type != CLEANUP_TYPE_KEEP) {
         nm_manager_device_route_metric_clear(NM_MANAGER_GET, nm_device_get_ip_ifindex(self));
@@ -15654,6 +16214,80 @@ deactivate_dispatcher_complete(NMDispatcherCallId *call_id, gpointer user_data)
         deactivate_ready(self, reason);
 }
 
+static int
+_activation_timing_idx(NMDeviceState state)
+{
+    G_STATIC_ASSERT_EXPR(NM_DEVICE_STATE_CONFIG == NM_DEVICE_STATE_PREPARE + 10);
+    G_STATIC_ASSERT_EXPR(NM_DEVICE_STATE_SECONDARIES == NM_DEVICE_STATE_PREPARE + 50);
+
+    if (state < NM_DEVICE_STATE_PREPARE || state > NM_DEVICE_STATE_SECONDARIES)
+        return -1;
+    return (state - NM_DEVICE_STATE_PREPARE) / 10;
+}
+
+static void
+_activation_timing_update(NMDevice *self, NMDeviceState old_state, NMDeviceState state)
+{
+    NMDevicePrivate *priv = NM_DEVICE_GET_PRIVATE(self);
+    gint64           now_msec;
+    int              idx;
+
+    if (state == NM_DEVICE_STATE_PREPARE
+        && (old_state < NM_DEVICE_STATE_PREPARE || old_state > NM_DEVICE_STATE_ACTIVATED)) {
+        now_msec                = nm_utils_get_monotonic_timestamp_msec();
+        priv->activation_timing = (typeof(priv->activation_timing)){
+            .start_msec       = now_msec,
+            .state_enter_msec = now_msec,
+            .visited          = (1u << _activation_timing_idx(state)),
+        };
+        return;
+    }
+
+    if (priv->activation_timing.start_msec == 0)
+        return;
+
+    now_msec = nm_utils_get_monotonic_timestamp_msec();
+
+    idx = _activation_timing_idx(old_state);
+    if (idx >= 0) {
+        priv->activation_timing.state_msec[idx] +=
+            NM_MIN(now_msec - priv->activation_timing.state_enter_msec, (gint64) G_MAXUINT32);
+    }
+
+    idx = _activation_timing_idx(state);
+    if (idx >= 0) {
+        priv->activation_timing.visited |= (1u << idx);
+        priv->activation_timing.state_enter_msec = now_msec;
+        return;
+    }
+
+    if (state == NM_DEVICE_STATE_ACTIVATED
+        && priv->sys_iface_state == NM_DEVICE_SYS_IFACE_STATE_MANAGED) {
+        char  sbuf[200] = "";
+        char *buf       = sbuf;
+        gsize buf_len   = sizeof(sbuf);
+
+        /* Report where the time went. Together with the timestamps of the
+         * log, this shows which devices and stages hold up the startup. */
+        for (idx = 0; idx < (int) G_N_ELEMENTS(priv->activation_timing.state_msec); idx++) {
+            if (!NM_FLAGS_HAS(priv->activation_timing.visited, (1u << idx)))
+                continue;
+            nm_strbuf_append(&buf,
+                             &buf_len,
+                             "%s %u ms, ",
+                             nm_device_state_to_string(NM_DEVICE_STATE_PREPARE + 10 * idx),
+                             priv->activation_timing.state_msec[idx]);
+        }
+        _LOGI(LOGD_DEVICE,
+              "Activation: timing: %stotal %" G_GINT64_FORMAT " ms",
+              sbuf,
+              now_msec - priv->activation_timing.start_msec);
+    }
+
+    /* the activation is over, either successfully or not. */
+    priv->activation_timing.start_msec = 0;
+}
+
 static void
 _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason, gboolean quitting)
 {
@@ -15711,6 +16345,8 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
     priv->state        = state;
     priv->state_reason = reason;
 
+    _activation_timing_update(self, old_state, state);
+
     queued_state_clear(self);
 
     _dispatcher_cleanup(self);
@@ -15918,6 +16554,7 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
                 sriov_op_queue(self,
                                0,
                                NM_OPTION_BOOL_TRUE,
+                               NULL,
                                sriov_reset_on_deactivate_cb,
                                nm_utils_user_data_pack(self, GINT_TO_POINTER(reason)));
             }
@@ -15967,7 +16604,7 @@ _set_state_full(NMDevice *self, NMDeviceState state, NMDeviceStateReason reason,
         if (priv->ifindex > 0
             && (s_sriov = nm_device_get_applied_setting(self, NM_TYPE_SETTING_SRIOV))) {
             priv->sriov_reset_pending++;
-            sriov_op_queue(self, 0, NM_OPTION_BOOL_TRUE, sriov_reset_on_failure_cb, self);
+            sriov_op_queue(self, 0, NM_OPTION_BOOL_TRUE, NULL, sriov_reset_on_failure_cb, self);
             break;
         }
         /* Schedule the transition to DISCONNECTED.  The device can't transition
@@ -16884,15 +17521,23 @@ nm_device_spec_match_list(NMDevice *self, const GSList *specs)
     return nm_device_spec_match_list_full(self, specs, FALSE);
 }
 
-int
-nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match_value)
+/**
+ * nm_device_get_spec_match_data:
+ * @self: an #NMDevice
+ * @out_data: (out): the properties of @self that device specs match against
+ *
+ * The returned strings are owned by @self or static, and only valid
+ * until the next change of the device.
+ */
+void
+nm_device_get_spec_match_data(NMDevice *self, NMDeviceSpecMatchData *out_data)
 {
-    NMDeviceClass       *klass;
-    NMMatchSpecMatchType m;
-    const char          *hw_address = NULL;
-    gboolean             is_fake;
+    NMDeviceClass *klass;
+    const char    *hw_address;
+    gboolean       is_fake;
 
-    g_return_val_if_fail(NM_IS_DEVICE(self), FALSE);
+    g_return_if_fail(NM_IS_DEVICE(self));
+    nm_assert(out_data);
 
     klass      = NM_DEVICE_GET_CLASS(self);
     hw_address = nm_device_get_permanent_hw_address_full(
@@ -16900,14 +17545,49 @@ nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match
         !nm_device_get_unmanaged_flags(self, NM_UNMANAGED_PLATFORM_INIT),
         &is_fake);
 
-    m = nm_match_spec_device(specs,
-                             nm_device_get_iface(self),
-                             nm_device_get_type_description(self),
-                             nm_device_get_driver(self),
-                             nm_device_get_driver_version(self),
-                             is_fake ? NULL : hw_address,
-                             klass->get_s390_subchannels ? klass->get_s390_subchannels(self) : NULL,
-                             nm_dhcp_manager_get_config(nm_dhcp_manager_get()));
+    *out_data = (NMDeviceSpecMatchData){
+        .interface_name   = nm_device_get_iface(self),
+        .device_type      = nm_device_get_type_description(self),
+        .driver           = nm_device_get_driver(self),
+        .driver_version   = nm_device_get_driver_version(self),
+        .hwaddr           = is_fake ? NULL : hw_address,
+        .s390_subchannels = klass->get_s390_subchannels ? klass->get_s390_subchannels(self) : NULL,
+        .dhcp_plugin      = nm_dhcp_manager_get_config(nm_dhcp_manager_get()),
+    };
+}
+
+static int
+_spec_match(NMDevice                       *self,
+            const GSList                   *specs,
+            const NMMatchSpecDeviceMatcher *matcher,
+            int                             no_match_value)
+{
+    NMDeviceSpecMatchData data;
+    NMMatchSpecMatchType  m;
+
+    g_return_val_if_fail(NM_IS_DEVICE(self), FALSE);
+
+    nm_device_get_spec_match_data(self, &data);
+
+    if (matcher) {
+        m = nm_match_spec_device_matcher_match(matcher,
+                                               data.interface_name,
+                                               data.device_type,
+                                               data.driver,
+                                               data.driver_version,
+                                               data.hwaddr,
+                                               data.s390_subchannels,
+                                               data.dhcp_plugin);
+    } else {
+        m = nm_match_spec_device(specs,
+                                 data.interface_name,
+                                 data.device_type,
+                                 data.driver,
+                                 data.driver_version,
+                                 data.hwaddr,
+                                 data.s390_subchannels,
+                                 data.dhcp_plugin);
+    }
 
     switch (m) {
     case NM_MATCH_SPEC_MATCH:
@@ -16921,6 +17601,30 @@ nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match
     return no_match_value;
 }
 
+int
+nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match_value)
+{
+    return _spec_match(self, specs, NULL, no_match_value);
+}
+
+/**
+ * nm_device_spec_match_matcher:
+ * @self: an #NMDevice
+ * @matcher: (nullable): the compiled device specs
+ * @no_match_value: the value to return if @matcher neither matches
+ *   nor excludes @self
+ *
+ * Like nm_device_spec_match_list_full(), but for specs compiled with
+ * nm_match_spec_device_matcher_new().
+ */
+int
+nm_device_spec_match_matcher(NMDevice                       *self,
+                             const NMMatchSpecDeviceMatcher *matcher,
+                             int                             no_match_value)
+{
+    return _spec_match(self, NULL, matcher, no_match_value);
+}
+
 guint
 nm_device_get_supplicant_timeout(NMDevice *self)
 {
@@ -17463,6 +18167,33 @@ get_property(GObject *object, guint prop_id, GValue *value, GParamSpec *pspec)
     case PROP_STATISTICS_RX_BYTES:
         g_value_set_uint64(value, priv->stats.rx_bytes);
         break;
+    case PROP_LINK_STATISTICS_RX_PACKETS:
+        g_value_set_uint64(value, priv->stats.link.rx_packets);
+        break;
+    case PROP_LINK_STATISTICS_TX_PACKETS:
+        g_value_set_uint64(value, priv->stats.link.tx_packets);
+        break;
+    case PROP_LINK_STATISTICS_RX_ERRORS:
+        g_value_set_uint64(value, priv->stats.link.rx_errors);
+        break;
+    case PROP_LINK_STATISTICS_TX_ERRORS:
+        g_value_set_uint64(value, priv->stats.link.tx_errors);
+        break;
+    case PROP_LINK_STATISTICS_RX_DROPPED:
+        g_value_set_uint64(value, priv->stats.link.rx_dropped);
+        break;
+    case PROP_LINK_STATISTICS_TX_DROPPED:
+        g_value_set_uint64(value, priv->stats.link.tx_dropped);
+        break;
+    case PROP_LINK_STATISTICS_MULTICAST:
+        g_value_set_uint64(value, priv->stats.link.multicast);
+        break;
+    case PROP_LINK_STATISTICS_COLLISIONS:
+        g_value_set_uint64(value, priv->stats.link.collisions);
+        break;
+    case PROP_LINK_STATISTICS_RX_NOHANDLER:
+        g_value_set_uint64(value, priv->stats.link.rx_nohandler);
+        break;
     case PROP_IP4_CONNECTIVITY:
         g_value_set_uint(value, priv->concheck_x[1].state);
         break;
@@ -17735,7 +18466,11 @@ dispose(GObject *object)
 
     nm_clear_g_source(&priv->check_delete_unrealized_id);
 
-    nm_clear_g_source_inst(&priv->stats.timeout_source);
+    /* usually nm_device_cleanup() did that already. Otherwise, don't leave
+     * a pending set-job behind that hands its state to a disposed device. */
+    _ethtool_state_reset(self);
+
+    _stats_poller_remove(self);
 
     carrier_disconnected_action_cancel(self);
 
@@ -17954,6 +18689,40 @@ static const NMDBusInterfaceInfoExtended interface_info_device_statistics = {
                                                            NM_DEVICE_STATISTICS_RX_BYTES), ), ),
 };
 
+static const NMDBusInterfaceInfoExtended interface_info_device_link_statistics = {
+    .parent = NM_DEFINE_GDBUS_INTERFACE_INFO_INIT(
+        NM_DBUS_INTERFACE_DEVICE_LINK_STATS,
+        .properties = NM_DEFINE_GDBUS_PROPERTY_INFOS(
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("RxPackets",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_RX_PACKETS),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("TxPackets",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_TX_PACKETS),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("RxErrors",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_RX_ERRORS),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("TxErrors",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_TX_ERRORS),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("RxDropped",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_RX_DROPPED),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("TxDropped",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_TX_DROPPED),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("Multicast",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_MULTICAST),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("Collisions",
+                                                           "t",
+                                                           NM_DEVICE_LINK_STATISTICS_COLLISIONS),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE(
+                "RxNoHandler",
+                "t",
+                NM_DEVICE_LINK_STATISTICS_RX_NOHANDLER), ), ),
+};
+
 static void
 nm_device_class_init(NMDeviceClass *klass)
 {
@@ -17964,7 +18733,9 @@ nm_device_class_init(NMDeviceClass *klass)
 
     dbus_object_class->export_path = NM_DBUS_EXPORT_PATH_NUMBERED(NM_DBUS_PATH "/Devices");
     dbus_object_class->interface_infos =
-        NM_DBUS_INTERFACE_INFOS(&interface_info_device, &interface_info_device_statistics);
+        NM_DBUS_INTERFACE_INFOS(&interface_info_device,
+                                &interface_info_device_statistics,
+                                &interface_info_device_link_statistics);
 
     object_class->dispose      = dispose;
     object_class->finalize     = finalize;
@@ -18259,6 +19030,78 @@ nm_device_class_init(NMDeviceClass *klass)
                             UINT64_MAX,
                             0,
                             G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_RX_PACKETS] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_RX_PACKETS,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_TX_PACKETS] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_TX_PACKETS,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_RX_ERRORS] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_RX_ERRORS,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_TX_ERRORS] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_TX_ERRORS,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_RX_DROPPED] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_RX_DROPPED,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_TX_DROPPED] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_TX_DROPPED,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_MULTICAST] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_MULTICAST,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_COLLISIONS] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_COLLISIONS,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties[PROP_LINK_STATISTICS_RX_NOHANDLER] =
+        g_param_spec_uint64(NM_DEVICE_LINK_STATISTICS_RX_NOHANDLER,
+                            "",
+                            "",
+                            0,
+                            UINT64_MAX,
+                            0,
+                            G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
 
     obj_properties[PROP_IP4_CONNECTIVITY] =
         g_param_spec_uint(NM_DEVICE_IP4_CONNECTIVITY,
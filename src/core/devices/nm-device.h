@@ -86,6 +86,16 @@
 #define NM_DEVICE_STATISTICS_TX_BYTES        "tx-bytes"
 #define NM_DEVICE_STATISTICS_RX_BYTES        "rx-bytes"
 
+#define NM_DEVICE_LINK_STATISTICS_RX_PACKETS   "link-stats-rx-packets"
+#define NM_DEVICE_LINK_STATISTICS_TX_PACKETS   "link-stats-tx-packets"
+#define NM_DEVICE_LINK_STATISTICS_RX_ERRORS    "link-stats-rx-errors"
+#define NM_DEVICE_LINK_STATISTICS_TX_ERRORS    "link-stats-tx-errors"
+#define NM_DEVICE_LINK_STATISTICS_RX_DROPPED   "link-stats-rx-dropped"
+#define NM_DEVICE_LINK_STATISTICS_TX_DROPPED   "link-stats-tx-dropped"
+#define NM_DEVICE_LINK_STATISTICS_MULTICAST    "link-stats-multicast"
+#define NM_DEVICE_LINK_STATISTICS_COLLISIONS   "link-stats-collisions"
+#define NM_DEVICE_LINK_STATISTICS_RX_NOHANDLER "link-stats-rx-nohandler"
+
 #define NM_DEVICE_IP4_CONNECTIVITY "ip4-connectivity"
 #define NM_DEVICE_IP6_CONNECTIVITY "ip6-connectivity"
 #define NM_DEVICE_INTERFACE_FLAGS  "interface-flags"
@@ -532,8 +542,23 @@ gboolean nm_device_check_slave_connection_compatible(NMDevice *device, NMConnect
 gboolean nm_device_can_assume_connections(NMDevice *self);
 gboolean nm_device_unmanage_on_quit(NMDevice *self);
 
+typedef struct {
+    const char *interface_name;
+    const char *device_type;
+    const char *driver;
+    const char *driver_version;
+    const char *hwaddr;
+    const char *s390_subchannels;
+    const char *dhcp_plugin;
+} NMDeviceSpecMatchData;
+
+void nm_device_get_spec_match_data(NMDevice *self, NMDeviceSpecMatchData *out_data);
+
 gboolean nm_device_spec_match_list(NMDevice *device, const GSList *specs);
 int      nm_device_spec_match_list_full(NMDevice *self, const GSList *specs, int no_match_value);
+int      nm_device_spec_match_matcher(NMDevice                       *self,
+                                      const NMMatchSpecDeviceMatcher *matcher,
+                                      int                             no_match_value);
 
 gboolean nm_device_is_activating(NMDevice *dev);
 gboolean nm_device_autoconnect_allowed(NMDevice *self);
@@ -264,6 +264,16 @@ _dbus_manager_init(NMConfig *config)
 
     busmgr = nm_dbus_manager_get();
 
+    nm_dbus_manager_set_properties_changed_interval(
+        busmgr,
+        nm_config_data_get_value_int64(nm_config_get_data_orig(config),
+                                       NM_CONFIG_KEYFILE_GROUP_MAIN,
+                                       NM_CONFIG_KEYFILE_KEY_MAIN_PROPERTIES_CHANGED_INTERVAL,
+                                       10,
+                                       0,
+                                       10000,
+                                       0));
+
     c_a_q_type = nm_config_get_configure_and_quit(config);
 
     if (c_a_q_type == NM_CONFIG_CONFIGURE_AND_QUIT_DISABLED)
@@ -21,6 +21,12 @@
 #define CANCELLATION_ID_PREFIX  "cancellation-id-"
 #define CANCELLATION_TIMEOUT_MS 5000
 
+/* How long a definite authorization result from polkit is reused for further
+ * requests of the same subject and action. The cache is also flushed whenever
+ * polkit signals a change. */
+#define AUTH_CACHE_TIMEOUT_MSEC 5000
+#define AUTH_CACHE_MAX_SIZE     1024
+
 /*****************************************************************************/
 
 NM_GOBJECT_PROPERTIES_DEFINE_BASE(PROP_POLKIT_ENABLED, );
@@ -37,6 +43,9 @@ typedef struct {
     GDBusConnection *dbus_connection;
     GCancellable    *main_cancellable;
     char            *name_owner;
+    GHashTable      *auth_cache;
+    guint64          auth_cache_hits;
+    guint64          auth_cache_misses;
     guint64          call_numid_counter;
     guint            changed_id;
     guint            name_owner_changed_id;
@@ -125,9 +134,135 @@ nm_auth_manager_get_polkit_enabled(NMAuthManager *self)
 
 /*****************************************************************************/
 
+typedef struct {
+    gint64  expiry_msec;
+    guint64 start_time;
+    gulong  pid;
+    gulong  uid;
+    bool    allow_user_interaction : 1;
+    bool    is_authorized : 1;
+    char    action_id[];
+} AuthCacheEntry;
+
+static guint
+_auth_cache_entry_hash(gconstpointer ptr)
+{
+    const AuthCacheEntry *entry = ptr;
+    NMHashState           h;
+
+    nm_hash_init(&h, 1843712231u);
+    nm_hash_update_vals(&h,
+                        entry->start_time,
+                        entry->pid,
+                        entry->uid,
+                        (bool) entry->allow_user_interaction);
+    nm_hash_update_str(&h, entry->action_id);
+    return nm_hash_complete(&h);
+}
+
+static gboolean
+_auth_cache_entry_equal(gconstpointer ptr_a, gconstpointer ptr_b)
+{
+    const AuthCacheEntry *a = ptr_a;
+    const AuthCacheEntry *b = ptr_b;
+
+    return a->start_time == b->start_time && a->pid == b->pid && a->uid == b->uid
+           && a->allow_user_interaction == b->allow_user_interaction
+           && nm_streq(a->action_id, b->action_id);
+}
+
+static AuthCacheEntry *
+_auth_cache_entry_new(NMAuthSubject *subject,
+                      const char    *action_id,
+                      gboolean       allow_user_interaction)
+{
+    AuthCacheEntry *entry;
+    gsize           l = strlen(action_id) + 1;
+
+    entry  = g_malloc(sizeof(AuthCacheEntry) + l);
+    *entry = (AuthCacheEntry){
+        .start_time             = nm_auth_subject_get_unix_process_start_time(subject),
+        .pid                    = nm_auth_subject_get_unix_process_pid(subject),
+        .uid                    = nm_auth_subject_get_unix_process_uid(subject),
+        .allow_user_interaction = allow_user_interaction,
+    };
+    memcpy(entry->action_id, action_id, l);
+    return entry;
+}
+
+static void
+_auth_cache_add(NMAuthManager *self, AuthCacheEntry *entry, gboolean is_authorized)
+{
+    NMAuthManagerPrivate *priv = NM_AUTH_MANAGER_GET_PRIVATE(self);
+    gint64                now_msec;
+    GHashTableIter        iter;
+    AuthCacheEntry       *e;
+
+    now_msec = nm_utils_get_monotonic_timestamp_msec();
+
+    if (!priv->auth_cache) {
+        priv->auth_cache =
+            g_hash_table_new_full(_auth_cache_entry_hash, _auth_cache_entry_equal, g_free, NULL);
+    } else if (g_hash_table_size(priv->auth_cache) >= AUTH_CACHE_MAX_SIZE) {
+        g_hash_table_iter_init(&iter, priv->auth_cache);
+        while (g_hash_table_iter_next(&iter, (gpointer *) &e, NULL)) {
+            if (e->expiry_msec <= now_msec)
+                g_hash_table_iter_remove(&iter);
+        }
+        if (g_hash_table_size(priv->auth_cache) >= AUTH_CACHE_MAX_SIZE)
+            g_hash_table_remove_all(priv->auth_cache);
+    }
+
+    entry->expiry_msec   = now_msec + AUTH_CACHE_TIMEOUT_MSEC;
+    entry->is_authorized = is_authorized;
+    g_hash_table_add(priv->auth_cache, entry);
+}
+
+static const AuthCacheEntry *
+_auth_cache_lookup(NMAuthManager *self,
+                   NMAuthSubject *subject,
+                   const char    *action_id,
+                   gboolean       allow_user_interaction)
+{
+    NMAuthManagerPrivate   *priv   = NM_AUTH_MANAGER_GET_PRIVATE(self);
+    gs_free AuthCacheEntry *needle = NULL;
+    AuthCacheEntry         *entry;
+
+    if (!priv->auth_cache || g_hash_table_size(priv->auth_cache) == 0)
+        return NULL;
+
+    needle = _auth_cache_entry_new(subject, action_id, allow_user_interaction);
+    entry  = g_hash_table_lookup(priv->auth_cache, needle);
+    if (!entry)
+        return NULL;
+
+    if (entry->expiry_msec <= nm_utils_get_monotonic_timestamp_msec()) {
+        g_hash_table_remove(priv->auth_cache, entry);
+        return NULL;
+    }
+    return entry;
+}
+
+static void
+_auth_cache_flush(NMAuthManager *self)
+{
+    NMAuthManagerPrivate *priv = NM_AUTH_MANAGER_GET_PRIVATE(self);
+
+    if (!priv->auth_cache || g_hash_table_size(priv->auth_cache) == 0)
+        return;
+
+    _LOGT("flush %u cached authorization results", g_hash_table_size(priv->auth_cache));
+    g_hash_table_remove_all(priv->auth_cache);
+}
+
+/*****************************************************************************/
+
 static void
 _emit_changed_signal(NMAuthManager *self)
 {
+    /* the authorization of subjects may have changed. Drop what we cached. */
+    _auth_cache_flush(self);
+
     g_signal_emit(self, signals[CHANGED_SIGNAL], 0);
 }
 
@@ -142,6 +277,7 @@ struct _NMAuthManagerCallId {
     GCancellable                           *dbus_cancellable;
     NMAuthManagerCheckAuthorizationCallback callback;
     gpointer                                user_data;
+    AuthCacheEntry                         *cache_entry;
     guint64                                 call_numid;
     guint                                   idle_id;
     bool                                    idle_is_authorized : 1;
@@ -165,6 +301,7 @@ _call_id_free(NMAuthManagerCallId *call_id)
         return;
     }
 
+    g_free(call_id->cache_entry);
     g_object_unref(call_id->self);
     g_slice_free(NMAuthManagerCallId, call_id);
 }
@@ -200,6 +337,43 @@ cancel_check_authorization_cb(GObject *source, GAsyncResult *res, gpointer user_
     _call_id_free(call_id);
 }
 
+/* Whether polkit's answer may be reused for a later request of the same subject
+ * and action. Only answers that polkit gave without talking to the user are
+ * cacheable:
+ *
+ * - a challenge is no answer at all, it depends on the user.
+ * - a "no" after the user dismissed the authentication dialog may well be a "yes"
+ *   on the next attempt.
+ * - a "yes" for a request that allowed user interaction may be the result of the
+ *   user authenticating. polkit does not tell us whether that was the case, unless
+ *   it keeps a temporary authorization (auth_*_keep), which it may revoke at any
+ *   time. Either way, such a grant is only valid for this very request. */
+static gboolean
+_auth_result_is_cacheable(gboolean  allow_user_interaction,
+                          gboolean  is_authorized,
+                          gboolean  is_challenge,
+                          GVariant *details)
+{
+    const char *str;
+
+    if (is_challenge)
+        return FALSE;
+
+    if (is_authorized) {
+        if (allow_user_interaction)
+            return FALSE;
+        if (details
+            && g_variant_lookup(details, "polkit.temporary_authorization_id", "&s", &str))
+            return FALSE;
+        return TRUE;
+    }
+
+    if (details && g_variant_lookup(details, "polkit.dismissed", "&s", &str))
+        return FALSE;
+
+    return TRUE;
+}
+
 static void
 _call_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
 {
@@ -207,6 +381,7 @@ _call_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
     NMAuthManager             *self;
     NMAuthManagerPrivate      *priv;
     gs_unref_variant GVariant *value         = NULL;
+    gs_unref_variant GVariant *details       = NULL;
     gs_free_error GError      *error         = NULL;
     gboolean                   is_authorized = FALSE;
     gboolean                   is_challenge  = FALSE;
@@ -258,8 +433,15 @@ _call_check_authorize_cb(GObject *proxy, GAsyncResult *res, gpointer user_data)
     }
 
     if (!error) {
-        g_variant_get(value, "((bb@a{ss}))", &is_authorized, &is_challenge, NULL);
+        g_variant_get(value, "((bb@a{ss}))", &is_authorized, &is_challenge, &details);
         _LOG2T(call_id, "completed: authorized=%d, challenge=%d", is_authorized, is_challenge);
+
+        if (call_id->cache_entry
+            && _auth_result_is_cacheable(call_id->cache_entry->allow_user_interaction,
+                                         is_authorized,
+                                         is_challenge,
+                                         details))
+            _auth_cache_add(self, g_steal_pointer(&call_id->cache_entry), is_authorized);
     } else
         _LOG2T(call_id, "completed: failed: %s", error->message);
 
@@ -310,6 +492,7 @@ nm_auth_manager_check_authorization(NMAuthManager                          *self
     PolkitCheckAuthorizationFlags flags;
     char                          subject_buf[64];
     NMAuthManagerCallId          *call_id;
+    const AuthCacheEntry         *cached;
 
     g_return_val_if_fail(NM_IS_AUTH_MANAGER(self), NULL);
     g_return_val_if_fail(NM_IN_SET(nm_auth_subject_get_subject_type(subject),
@@ -357,6 +540,18 @@ nm_auth_manager_check_authorization(NMAuthManager                          *self
                priv->auth_polkit_mode == NM_AUTH_POLKIT_MODE_ALLOW_ALL ? "grant" : "deny");
         call_id->idle_is_authorized = (priv->auth_polkit_mode == NM_AUTH_POLKIT_MODE_ALLOW_ALL);
         call_id->idle_id            = g_idle_add(_call_on_idle, call_id);
+    } else if ((cached = _auth_cache_lookup(self, subject, action_id, allow_user_interaction))) {
+        priv->auth_cache_hits++;
+        _LOG2T(call_id,
+               "CheckAuthorization(%s), subject=%s (cached %s, %" G_GUINT64_FORMAT
+               " hits, %" G_GUINT64_FORMAT " misses)",
+               action_id,
+               nm_auth_subject_to_string(subject, subject_buf, sizeof(subject_buf)),
+               cached->is_authorized ? "grant" : "deny",
+               priv->auth_cache_hits,
+               priv->auth_cache_misses);
+        call_id->idle_is_authorized = cached->is_authorized;
+        call_id->idle_id            = g_idle_add(_call_on_idle, call_id);
     } else {
         GVariant       *parameters;
         GVariantBuilder builder;
@@ -377,6 +572,9 @@ nm_auth_manager_check_authorization(NMAuthManager                          *self
                                    (guint32) flags,
                                    cancellation_id_to_str_a(call_id->call_numid));
 
+        priv->auth_cache_misses++;
+        call_id->cache_entry = _auth_cache_entry_new(subject, action_id, allow_user_interaction);
+
         _LOG2T(call_id,
                "CheckAuthorization(%s), subject=%s",
                action_id,
@@ -717,6 +915,13 @@ dispose(GObject *object)
     g_clear_object(&priv->dbus_connection);
 
     nm_clear_g_free(&priv->name_owner);
+
+    if (priv->auth_cache_hits + priv->auth_cache_misses > 0) {
+        _LOGD("authorization cache: %" G_GUINT64_FORMAT " hits, %" G_GUINT64_FORMAT " misses",
+              priv->auth_cache_hits,
+              priv->auth_cache_misses);
+    }
+    nm_clear_pointer(&priv->auth_cache, g_hash_table_unref);
 }
 
 static void
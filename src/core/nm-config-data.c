@@ -23,8 +23,9 @@ typedef struct {
         /* have a separate boolean field @has, because a @spec with
          * value %NULL does not necessarily mean, that the property
          * "match-device" was unspecified. */
-        gboolean has;
-        GSList  *spec;
+        gboolean                  has;
+        GSList                   *spec;
+        NMMatchSpecDeviceMatcher *matcher;
     } match_device;
     union {
         struct {
@@ -39,6 +40,22 @@ typedef struct {
     const NMUtilsNamedValue *lookup_idx;
 } MatchSectionInfo;
 
+typedef enum {
+    MATCH_CACHE_UNKNOWN = 0,
+    MATCH_CACHE_NO,
+    MATCH_CACHE_YES,
+} MatchCacheResult;
+
+typedef struct {
+    /* The key. Copies of the device properties that the results below were
+     * evaluated against. Must be the first field, see _match_cache_get(). */
+    NMDeviceSpecMatchData data;
+
+    /* One MatchCacheResult for each [device] section, followed by one
+     * for each [connection] section. */
+    guint8 results[];
+} MatchCacheEntry;
+
 struct _NMGlobalDnsDomain {
     char  *name;
     char **servers;
@@ -81,6 +98,17 @@ typedef struct {
      * [device] sections. This is to speed up lookup. */
     MatchSectionInfo *device_infos;
 
+    /* Whether a device matches the "match-device" of a section only depends
+     * on a few properties of the device, so remember it for these properties. */
+    struct {
+        GHashTable *entries;
+        guint       device_infos_len;
+        guint       connection_infos_len;
+        guint64     hits;
+        guint64     evaluations;
+        guint       flushes;
+    } match_cache;
+
     struct {
         gboolean enabled;
         char    *uri;
@@ -100,8 +128,18 @@ typedef struct {
     } no_auto_default;
 
     GSList *ignore_carrier;
+    GSList *ignore_devices;
     GSList *assume_ipv6ll_only;
 
+    /* The device specs above, compiled for matching. */
+    struct {
+        NMMatchSpecDeviceMatcher *no_auto_default;
+        NMMatchSpecDeviceMatcher *no_auto_default_config;
+        NMMatchSpecDeviceMatcher *ignore_carrier;
+        NMMatchSpecDeviceMatcher *ignore_devices;
+        NMMatchSpecDeviceMatcher *assume_ipv6ll_only;
+    } matchers;
+
     char *dns_mode;
     char *rc_manager;
 
@@ -331,8 +369,8 @@ nm_config_data_get_no_auto_default_for_device(const NMConfigData *self, NMDevice
     g_return_val_if_fail(NM_IS_DEVICE(device), FALSE);
 
     priv = NM_CONFIG_DATA_GET_PRIVATE(self);
-    return nm_device_spec_match_list(device, priv->no_auto_default.specs)
-           || nm_device_spec_match_list(device, priv->no_auto_default.specs_config);
+    return nm_device_spec_match_matcher(device, priv->matchers.no_auto_default, FALSE)
+           || nm_device_spec_match_matcher(device, priv->matchers.no_auto_default_config, FALSE);
 }
 
 const char *
@@ -382,9 +420,9 @@ nm_config_data_get_ignore_carrier(const NMConfigData *self, NMDevice *device)
     if (has_match)
         m = nm_config_parse_boolean(value, -1);
     else
-        m = nm_device_spec_match_list_full(device,
-                                           NM_CONFIG_DATA_GET_PRIVATE(self)->ignore_carrier,
-                                           -1);
+        m = nm_device_spec_match_matcher(device,
+                                         NM_CONFIG_DATA_GET_PRIVATE(self)->matchers.ignore_carrier,
+                                         -1);
 
     if (NM_IN_SET(m, TRUE, FALSE))
         return m;
@@ -393,13 +431,32 @@ nm_config_data_get_ignore_carrier(const NMConfigData *self, NMDevice *device)
     return nm_device_ignore_carrier_by_default(device);
 }
 
+const GSList *
+nm_config_data_get_ignore_devices(const NMConfigData *self)
+{
+    g_return_val_if_fail(NM_IS_CONFIG_DATA(self), NULL);
+
+    return NM_CONFIG_DATA_GET_PRIVATE(self)->ignore_devices;
+}
+
+const NMMatchSpecDeviceMatcher *
+nm_config_data_get_ignore_devices_matcher(const NMConfigData *self)
+{
+    g_return_val_if_fail(NM_IS_CONFIG_DATA(self), NULL);
+
+    return NM_CONFIG_DATA_GET_PRIVATE(self)->matchers.ignore_devices;
+}
+
 gboolean
 nm_config_data_get_assume_ipv6ll_only(const NMConfigData *self, NMDevice *device)
 {
+    const NMConfigDataPrivate *priv;
+
     g_return_val_if_fail(NM_IS_CONFIG_DATA(self), FALSE);
     g_return_val_if_fail(NM_IS_DEVICE(device), FALSE);
 
-    return nm_device_spec_match_list(device, NM_CONFIG_DATA_GET_PRIVATE(self)->assume_ipv6ll_only);
+    priv = NM_CONFIG_DATA_GET_PRIVATE(self);
+    return nm_device_spec_match_matcher(device, priv->matchers.assume_ipv6ll_only, FALSE);
 }
 
 GKeyFile *
@@ -1461,8 +1518,117 @@ global_dns_equal(NMGlobalDnsConfig *old, NMGlobalDnsConfig *new)
 
 /*****************************************************************************/
 
+/* Devices come and go with different names, like the veth pairs of
+ * containers. Don't let the cache grow without bound. */
+#define MATCH_CACHE_MAX_ENTRIES 1000
+
+static guint
+_match_cache_data_hash(gconstpointer ptr)
+{
+    const NMDeviceSpecMatchData *data = ptr;
+    NMHashState                  h;
+
+    nm_hash_init(&h, 1640474953u);
+    nm_hash_update_str0(&h, data->interface_name);
+    nm_hash_update_str0(&h, data->device_type);
+    nm_hash_update_str0(&h, data->driver);
+    nm_hash_update_str0(&h, data->driver_version);
+    nm_hash_update_str0(&h, data->hwaddr);
+    nm_hash_update_str0(&h, data->s390_subchannels);
+    nm_hash_update_str0(&h, data->dhcp_plugin);
+    return nm_hash_complete(&h);
+}
+
+static gboolean
+_match_cache_data_equal(gconstpointer a, gconstpointer b)
+{
+    const NMDeviceSpecMatchData *data_a = a;
+    const NMDeviceSpecMatchData *data_b = b;
+
+    return nm_streq0(data_a->interface_name, data_b->interface_name)
+           && nm_streq0(data_a->device_type, data_b->device_type)
+           && nm_streq0(data_a->driver, data_b->driver)
+           && nm_streq0(data_a->driver_version, data_b->driver_version)
+           && nm_streq0(data_a->hwaddr, data_b->hwaddr)
+           && nm_streq0(data_a->s390_subchannels, data_b->s390_subchannels)
+           && nm_streq0(data_a->dhcp_plugin, data_b->dhcp_plugin);
+}
+
+static void
+_match_cache_entry_free(gpointer user_data)
+{
+    MatchCacheEntry *entry = user_data;
+
+    g_free((char *) entry->data.interface_name);
+    g_free((char *) entry->data.device_type);
+    g_free((char *) entry->data.driver);
+    g_free((char *) entry->data.driver_version);
+    g_free((char *) entry->data.hwaddr);
+    g_free((char *) entry->data.s390_subchannels);
+    g_free((char *) entry->data.dhcp_plugin);
+    g_free(entry);
+}
+
+static guint8 *
+_match_cache_get(NMConfigDataPrivate *priv, const NMDeviceSpecMatchData *data, gboolean is_device)
+{
+    MatchCacheEntry *entry;
+    guint            n;
+
+    G_STATIC_ASSERT_EXPR(G_STRUCT_OFFSET(MatchCacheEntry, data) == 0);
+
+    if (!priv->match_cache.entries) {
+        priv->match_cache.entries = g_hash_table_new_full(_match_cache_data_hash,
+                                                          _match_cache_data_equal,
+                                                          _match_cache_entry_free,
+                                                          NULL);
+    }
+
+    /* The entry starts with its NMDeviceSpecMatchData, so it can be looked
+     * up by @data. */
+    entry = g_hash_table_lookup(priv->match_cache.entries, data);
+    if (!entry) {
+        if (g_hash_table_size(priv->match_cache.entries) >= MATCH_CACHE_MAX_ENTRIES) {
+            g_hash_table_remove_all(priv->match_cache.entries);
+            priv->match_cache.flushes++;
+        }
+
+        n     = priv->match_cache.device_infos_len + priv->match_cache.connection_infos_len;
+        entry = g_malloc0(sizeof(MatchCacheEntry) + n);
+
+        entry->data = (NMDeviceSpecMatchData){
+            .interface_name   = g_strdup(data->interface_name),
+            .device_type      = g_strdup(data->device_type),
+            .driver           = g_strdup(data->driver),
+            .driver_version   = g_strdup(data->driver_version),
+            .hwaddr           = g_strdup(data->hwaddr),
+            .s390_subchannels = g_strdup(data->s390_subchannels),
+            .dhcp_plugin      = g_strdup(data->dhcp_plugin),
+        };
+        g_hash_table_add(priv->match_cache.entries, entry);
+    }
+
+    return &entry->results[is_device ? 0u : priv->match_cache.device_infos_len];
+}
+
+void
+_nm_config_data_get_match_cache_stats_for_testing(const NMConfigData *self,
+                                                  guint64            *out_hits,
+                                                  guint64            *out_evaluations)
+{
+    const NMConfigDataPrivate *priv;
+
+    g_return_if_fail(self);
+
+    priv = NM_CONFIG_DATA_GET_PRIVATE(self);
+
+    NM_SET_OUT(out_hits, priv->match_cache.hits);
+    NM_SET_OUT(out_evaluations, priv->match_cache.evaluations);
+}
+
 static const MatchSectionInfo *
-_match_section_infos_lookup(const MatchSectionInfo *match_section_infos,
+_match_section_infos_lookup(NMConfigDataPrivate    *priv,
+                            const MatchSectionInfo *match_section_infos,
                             GKeyFile               *keyfile,
                             const char             *property,
                             NMDevice               *device,
@@ -1470,9 +1636,12 @@ _match_section_infos_lookup(const MatchSectionInfo *match_section_infos,
                             const char             *match_device_type,
                             const char            **out_value)
 {
-    const char *match_dhcp_plugin;
+    const MatchSectionInfo *match_section_infos_first = match_section_infos;
+    NMDeviceSpecMatchData   device_data;
+    guint8                 *match_cache = NULL;
+    const char             *match_dhcp_plugin;
 
-    if (!match_section_infos)
+    if (!match_section_infos || !match_section_infos->group_name)
         goto out;
 
     match_dhcp_plugin = nm_dhcp_manager_get_config(nm_dhcp_manager_get());
@@ -1493,13 +1662,41 @@ _match_section_infos_lookup(const MatchSectionInfo *match_section_infos,
             continue;
 
         if (match_section_infos->match_device.has) {
-            if (device)
-                match = nm_device_spec_match_list(device, match_section_infos->match_device.spec);
-            else if (pllink)
+            if (device) {
+                guint8 *result;
+
+                if (!match_cache) {
+                    /* Only get the data when a section needs it. For example, reading
+                     * the permanent MAC address might fix it before it is known. */
+                    nm_device_get_spec_match_data(device, &device_data);
+                    match_cache =
+                        _match_cache_get(priv, &device_data, match_section_infos_first->is_device);
+                }
+
+                result = &match_cache[match_section_infos - match_section_infos_first];
+                if (*result != MATCH_CACHE_UNKNOWN)
+                    priv->match_cache.hits++;
+                else {
+                    NMMatchSpecMatchType m;
+
+                    m = nm_match_spec_device_matcher_match(
+                        match_section_infos->match_device.matcher,
+                        device_data.interface_name,
+                        device_data.device_type,
+                        device_data.driver,
+                        device_data.driver_version,
+                        device_data.hwaddr,
+                        device_data.s390_subchannels,
+                        device_data.dhcp_plugin);
+                    *result = (m == NM_MATCH_SPEC_MATCH) ? MATCH_CACHE_YES : MATCH_CACHE_NO;
+                    priv->match_cache.evaluations++;
+                }
+                match = (*result == MATCH_CACHE_YES);
+            } else if (pllink)
                 match = nm_match_spec_device_by_pllink(pllink,
                                                        match_device_type,
                                                        match_dhcp_plugin,
-                                                       match_section_infos->match_device.spec,
+                                                       match_section_infos->match_device.matcher,
                                                        FALSE);
             else
                 match = FALSE;
@@ -1534,7 +1731,8 @@ nm_config_data_get_device_config(const NMConfigData *self,
 
     priv = NM_CONFIG_DATA_GET_PRIVATE(self);
 
-    connection_info = _match_section_infos_lookup(&priv->device_infos[0],
+    connection_info = _match_section_infos_lookup((NMConfigDataPrivate *) priv,
+                                                  &priv->device_infos[0],
                                                   priv->keyfile,
                                                   property,
                                                   device,
@@ -1561,7 +1759,8 @@ nm_config_data_get_device_config_by_pllink(const NMConfigData   *self,
 
     priv = NM_CONFIG_DATA_GET_PRIVATE(self);
 
-    connection_info = _match_section_infos_lookup(&priv->device_infos[0],
+    connection_info = _match_section_infos_lookup((NMConfigDataPrivate *) priv,
+                                                  &priv->device_infos[0],
                                                   priv->keyfile,
                                                   property,
                                                   NULL,
@@ -1622,7 +1821,8 @@ nm_config_data_get_device_allowed_connections_specs(const NMConfigData *self,
 
     priv = NM_CONFIG_DATA_GET_PRIVATE(self);
 
-    connection_info = _match_section_infos_lookup(&priv->device_infos[0],
+    connection_info = _match_section_infos_lookup((NMConfigDataPrivate *) priv,
+                                                  &priv->device_infos[0],
                                                   priv->keyfile,
                                                   NM_CONFIG_KEYFILE_KEY_DEVICE_ALLOWED_CONNECTIONS,
                                                   device,
@@ -1667,7 +1867,8 @@ nm_config_data_get_connection_default(const NMConfigData *self,
     }
 #endif
 
-    _match_section_infos_lookup(&priv->connection_infos[0],
+    _match_section_infos_lookup((NMConfigDataPrivate *) priv,
+                                &priv->connection_infos[0],
                                 priv->keyfile,
                                 property,
                                 device,
@@ -1731,6 +1932,8 @@ _match_section_info_init(MatchSectionInfo *connection_info,
                                  group,
                                  NM_CONFIG_KEYFILE_KEY_MATCH_DEVICE,
                                  &connection_info->match_device.has);
+    connection_info->match_device.matcher =
+        nm_match_spec_device_matcher_new(connection_info->match_device.spec);
     connection_info->stop_match =
         nm_config_keyfile_get_boolean(keyfile, group, NM_CONFIG_KEYFILE_KEY_STOP_MATCH, FALSE);
 
@@ -1797,6 +2000,7 @@ _match_section_infos_free(MatchSectionInfo *match_section_infos)
     for (m = match_section_infos; m->group_name; m++) {
         g_free(m->group_name);
         g_slist_free_full(m->match_device.spec, g_free);
+        nm_match_spec_device_matcher_free(m->match_device.matcher);
         if (m->is_device) {
             g_slist_free_full(m->device.allowed_connections, g_free);
         }
@@ -1809,6 +2013,18 @@ _match_section_infos_free(MatchSectionInfo *match_section_infos)
     g_free(match_section_infos);
 }
 
+static guint
+_match_section_infos_len(const MatchSectionInfo *match_section_infos)
+{
+    guint n = 0;
+
+    if (match_section_infos) {
+        while (match_section_infos[n].group_name)
+            n++;
+    }
+    return n;
+}
+
 static MatchSectionInfo *
 _match_section_infos_construct(GKeyFile *keyfile, gboolean is_device)
 {
@@ -1922,6 +2138,9 @@ nm_config_data_diff(NMConfigData *old_data, NMConfigData *new_data)
     if (!global_dns_equal(priv_old->global_dns, priv_new->global_dns))
         changes |= NM_CONFIG_CHANGE_GLOBAL_DNS_CONFIG;
 
+    if (nm_utils_g_slist_strlist_cmp(priv_old->ignore_devices, priv_new->ignore_devices) != 0)
+        changes |= NM_CONFIG_CHANGE_IGNORE_DEVICES;
+
     nm_assert(!NM_FLAGS_ANY(changes, NM_CONFIG_CHANGE_CAUSES));
 
     return changes;
@@ -2052,6 +2271,8 @@ set_property(GObject *object, guint prop_id, const GValue *value, GParamSpec *ps
 
             priv->no_auto_default.arr   = nm_strv_dup(value_arr, j, TRUE);
             priv->no_auto_default.specs = g_slist_reverse(specs);
+            priv->matchers.no_auto_default =
+                nm_match_spec_device_matcher_new(priv->no_auto_default.specs);
         }
         break;
     default:
@@ -2078,6 +2299,9 @@ constructed(GObject *object)
     priv->connection_infos = _match_section_infos_construct(priv->keyfile, FALSE);
     priv->device_infos     = _match_section_infos_construct(priv->keyfile, TRUE);
 
+    priv->match_cache.connection_infos_len = _match_section_infos_len(priv->connection_infos);
+    priv->match_cache.device_infos_len     = _match_section_infos_len(priv->device_infos);
+
     priv->connectivity.enabled =
         nm_config_keyfile_get_boolean(priv->keyfile,
                                       NM_CONFIG_KEYFILE_GROUP_CONNECTIVITY,
@@ -2130,6 +2354,10 @@ constructed(GObject *object)
                                                     NM_CONFIG_KEYFILE_GROUP_MAIN,
                                                     NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_CARRIER,
                                                     NULL);
+    priv->ignore_devices = nm_config_get_match_spec(priv->keyfile,
+                                                    NM_CONFIG_KEYFILE_GROUP_MAIN,
+                                                    NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_DEVICES,
+                                                    NULL);
     priv->assume_ipv6ll_only =
         nm_config_get_match_spec(priv->keyfile,
                                  NM_CONFIG_KEYFILE_GROUP_MAIN,
@@ -2141,6 +2369,14 @@ constructed(GObject *object)
                                  NM_CONFIG_KEYFILE_KEY_MAIN_NO_AUTO_DEFAULT,
                                  NULL);
 
+    priv->matchers.ignore_carrier = nm_match_spec_device_matcher_new(priv->ignore_carrier);
+    priv->matchers.ignore_devices = nm_match_spec_device_matcher_new(priv->ignore_devices);
+
+    priv->matchers.assume_ipv6ll_only =
+        nm_match_spec_device_matcher_new(priv->assume_ipv6ll_only);
+    priv->matchers.no_auto_default_config =
+        nm_match_spec_device_matcher_new(priv->no_auto_default.specs_config);
+
     priv->global_dns = load_global_dns(priv->keyfile_user, FALSE);
     if (!priv->global_dns)
         priv->global_dns = load_global_dns(priv->keyfile_intern, TRUE);
@@ -2233,12 +2469,31 @@ finalize(GObject *gobject)
     g_free(priv->rc_manager);
 
     g_slist_free_full(priv->ignore_carrier, g_free);
+    g_slist_free_full(priv->ignore_devices, g_free);
     g_slist_free_full(priv->assume_ipv6ll_only, g_free);
 
+    nm_match_spec_device_matcher_free(priv->matchers.no_auto_default);
+    nm_match_spec_device_matcher_free(priv->matchers.no_auto_default_config);
+    nm_match_spec_device_matcher_free(priv->matchers.ignore_carrier);
+    nm_match_spec_device_matcher_free(priv->matchers.ignore_devices);
+    nm_match_spec_device_matcher_free(priv->matchers.assume_ipv6ll_only);
+
     nm_global_dns_config_free(priv->global_dns);
 
     g_free(priv->iwd_config_path);
 
+    if (priv->match_cache.hits + priv->match_cache.evaluations > 0) {
+        nm_log_dbg(LOGD_CORE,
+                   "config-data[%p]: match-device cache: %" G_GUINT64_FORMAT
+                   " hits, %" G_GUINT64_FORMAT " evaluations, %u flushes, %u entries",
+                   gobject,
+                   priv->match_cache.hits,
+                   priv->match_cache.evaluations,
+                   priv->match_cache.flushes,
+                   nm_g_hash_table_size(priv->match_cache.entries));
+    }
+    nm_clear_pointer(&priv->match_cache.entries, g_hash_table_destroy);
+
     _match_section_infos_free(priv->connection_infos);
     _match_section_infos_free(priv->device_infos);
 
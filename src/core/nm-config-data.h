@@ -116,6 +116,9 @@ typedef enum {
     /* configuration regarding global dns-config changed */
     NM_CONFIG_CHANGE_GLOBAL_DNS_CONFIG = (1L << 18),
 
+    /* configuration regarding ignore-devices changed */
+    NM_CONFIG_CHANGE_IGNORE_DEVICES = (1L << 19),
+
 } NMConfigChangeFlags;
 
 typedef struct _NMConfigDataClass NMConfigDataClass;
@@ -188,6 +191,9 @@ gboolean nm_config_data_get_ignore_carrier(const NMConfigData *self, NMDevice *d
 gboolean nm_config_data_get_assume_ipv6ll_only(const NMConfigData *self, NMDevice *device);
 int      nm_config_data_get_sriov_num_vfs(const NMConfigData *self, NMDevice *device);
 
+const GSList                   *nm_config_data_get_ignore_devices(const NMConfigData *self);
+const NMMatchSpecDeviceMatcher *nm_config_data_get_ignore_devices_matcher(const NMConfigData *self);
+
 NMGlobalDnsConfig *nm_config_data_get_global_dns_config(const NMConfigData *self);
 
 const char *nm_config_data_get_iwd_config_path(const NMConfigData *self);
@@ -280,6 +286,10 @@ GKeyFile *_nm_config_data_get_keyfile(const NMConfigData *self);
 GKeyFile *_nm_config_data_get_keyfile_user(const NMConfigData *self);
 GKeyFile *_nm_config_data_get_keyfile_intern(const NMConfigData *self);
 
+void _nm_config_data_get_match_cache_stats_for_testing(const NMConfigData *self,
+                                                       guint64            *out_hits,
+                                                       guint64            *out_evaluations);
+
 /*****************************************************************************/
 
 /* nm-config-data.c requires getting the DHCP manager's configuration. That is a bit
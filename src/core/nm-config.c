@@ -804,6 +804,7 @@ _setting_is_device_spec(const char *group, const char *key)
 
     return _IS(NM_CONFIG_KEYFILE_GROUP_MAIN, NM_CONFIG_KEYFILE_KEY_MAIN_NO_AUTO_DEFAULT)
            || _IS(NM_CONFIG_KEYFILE_GROUP_MAIN, NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_CARRIER)
+           || _IS(NM_CONFIG_KEYFILE_GROUP_MAIN, NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_DEVICES)
            || _IS(NM_CONFIG_KEYFILE_GROUP_MAIN, NM_CONFIG_KEYFILE_KEY_MAIN_ASSUME_IPV6LL_ONLY)
            || _IS(NM_CONFIG_KEYFILE_GROUP_KEYFILE, NM_CONFIG_KEYFILE_KEY_KEYFILE_UNMANAGED_DEVICES)
            || (NM_STR_HAS_PREFIX(group, NM_CONFIG_KEYFILE_GROUPPREFIX_CONNECTION)
@@ -852,11 +853,14 @@ static const ConfigGroup config_groups[] = {
                              NM_CONFIG_KEYFILE_KEY_MAIN_FIREWALL_BACKEND,
                              NM_CONFIG_KEYFILE_KEY_MAIN_HOSTNAME_MODE,
                              NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_CARRIER,
+                             NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_DEVICES,
                              NM_CONFIG_KEYFILE_KEY_MAIN_IWD_CONFIG_PATH,
                              NM_CONFIG_KEYFILE_KEY_MAIN_MONITOR_CONNECTION_FILES,
                              NM_CONFIG_KEYFILE_KEY_MAIN_NO_AUTO_DEFAULT,
                              NM_CONFIG_KEYFILE_KEY_MAIN_PLUGINS,
+                             NM_CONFIG_KEYFILE_KEY_MAIN_PROPERTIES_CHANGED_INTERVAL,
                              NM_CONFIG_KEYFILE_KEY_MAIN_RC_MANAGER,
+                             NM_CONFIG_KEYFILE_KEY_MAIN_SECRET_AGENTS_PARALLEL,
                              NM_CONFIG_KEYFILE_KEY_MAIN_SLAVES_ORDER,
                              NM_CONFIG_KEYFILE_KEY_MAIN_SYSTEMD_RESOLVED, ),
     },
@@ -877,6 +881,7 @@ static const ConfigGroup config_groups[] = {
     {
         .group = NM_CONFIG_KEYFILE_GROUP_KEYFILE,
         .keys  = NM_MAKE_STRV(NM_CONFIG_KEYFILE_KEY_KEYFILE_HOSTNAME,
+                             NM_CONFIG_KEYFILE_KEY_KEYFILE_INCREMENTAL_RELOAD,
                              NM_CONFIG_KEYFILE_KEY_KEYFILE_PATH,
                              NM_CONFIG_KEYFILE_KEY_KEYFILE_UNMANAGED_DEVICES, ),
     },
@@ -2897,7 +2902,8 @@ NM_UTILS_FLAGS2STR_DEFINE(nm_config_change_flags_to_string,
                           NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_DNS_MODE, "dns-mode"),
                           NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_RC_MANAGER, "rc-manager"),
                           NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_GLOBAL_DNS_CONFIG,
-                                             "global-dns-config"), );
+                                             "global-dns-config"),
+                          NM_UTILS_FLAGS2STR(NM_CONFIG_CHANGE_IGNORE_DEVICES, "ignore-devices"), );
 
 static void
 _set_config_data(NMConfig *self, NMConfigData *new_data, NMConfigChangeFlags reload_flags)
@@ -1484,6 +1484,484 @@ nm_match_spec_device(const GSList *specs,
     return _match_result(has_except, has_not_except, has_match, has_match_except);
 }
 
+/*****************************************************************************/
+
+typedef struct {
+    guint8 len;
+    guint8 bin[_NM_UTILS_HWADDR_LEN_MAX];
+} MatcherHwaddr;
+
+typedef struct {
+    char         *driver;
+    gsize         driver_len;
+    GPatternSpec *version;
+} MatcherDriverVersion;
+
+typedef struct {
+    guint32 a;
+    guint32 b;
+    guint32 c;
+} MatcherS390;
+
+typedef struct {
+    /* Interface names that match literally. */
+    GHashTable *ifnames;
+
+    /* Interface name globs of the form "prefix*", indexed by the prefix.
+     * ifname_prefix_lens has the distinct prefix lengths, sorted. */
+    GHashTable *ifname_prefixes;
+    GArray     *ifname_prefix_lens;
+
+    /* All other interface name globs, as GPatternSpec. */
+    GPtrArray *ifname_patterns;
+
+    GHashTable *device_types;
+    GHashTable *drivers;
+    GArray     *driver_versions;
+    GHashTable *hwaddrs;
+    GArray     *s390_subchannels;
+    GHashTable *dhcp_plugins;
+
+    bool match_all;
+} MatcherGroup;
+
+struct _NMMatchSpecDeviceMatcher {
+    MatcherGroup match;
+    MatcherGroup except;
+    bool         has_except;
+    bool         has_not_except;
+};
+
+static const guint8 *
+_matcher_hwaddr_get_relevant(const MatcherHwaddr *h, gsize *out_len)
+{
+    *out_len = h->len;
+    return nm_utils_hwaddr_get_relevant_part(h->bin, out_len);
+}
+
+static guint
+_matcher_hwaddr_hash(gconstpointer ptr)
+{
+    const MatcherHwaddr *h = ptr;
+    NMHashState          state;
+    const guint8        *bin;
+    gsize                len;
+
+    bin = _matcher_hwaddr_get_relevant(h, &len);
+
+    nm_hash_init(&state, 1209434647u);
+    nm_hash_update_val(&state, h->len);
+    nm_hash_update_mem(&state, bin, len);
+    return nm_hash_complete(&state);
+}
+
+static gboolean
+_matcher_hwaddr_equal(gconstpointer a, gconstpointer b)
+{
+    const MatcherHwaddr *h_a = a;
+    const MatcherHwaddr *h_b = b;
+    const guint8        *bin_a;
+    const guint8        *bin_b;
+    gsize                len;
+
+    if (h_a->len != h_b->len)
+        return FALSE;
+
+    bin_a = _matcher_hwaddr_get_relevant(h_a, &len);
+    bin_b = _matcher_hwaddr_get_relevant(h_b, &len);
+    return memcmp(bin_a, bin_b, len) == 0;
+}
+
+static gboolean
+_matcher_hwaddr_parse(const char *str, MatcherHwaddr *out_hwaddr)
+{
+    gsize l;
+
+    if (!_nm_utils_hwaddr_aton(str, out_hwaddr->bin, sizeof(out_hwaddr->bin), &l))
+        return FALSE;
+    out_hwaddr->len = l;
+    return TRUE;
+}
+
+static void
+_matcher_str_set_add(GHashTable **p_set, const char *str)
+{
+    if (!*p_set)
+        *p_set = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, NULL);
+    g_hash_table_add(*p_set, g_strdup(str));
+}
+
+static void
+_matcher_driver_version_clear(gpointer data)
+{
+    MatcherDriverVersion *d = data;
+
+    g_free(d->driver);
+    g_pattern_spec_free(d->version);
+}
+
+static void
+_matcher_group_compile_ifname(MatcherGroup *group, const char *spec_str, gboolean use_pattern)
+{
+    const char *wildcard;
+    gsize       len;
+    guint       i;
+
+    if (use_pattern)
+        wildcard = strpbrk(spec_str, "*?");
+    else
+        wildcard = NULL;
+
+    if (!wildcard) {
+        _matcher_str_set_add(&group->ifnames, spec_str);
+        return;
+    }
+
+    len = wildcard - spec_str;
+    if (wildcard[0] == '*' && wildcard[1] == '\0') {
+        /* The common case of "prefix*". */
+        if (!group->ifname_prefixes) {
+            group->ifname_prefixes = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, NULL);
+            group->ifname_prefix_lens = g_array_new(FALSE, FALSE, sizeof(gsize));
+        }
+        g_hash_table_add(group->ifname_prefixes, g_strndup(spec_str, len));
+
+        for (i = 0; i < group->ifname_prefix_lens->len; i++) {
+            gsize l = g_array_index(group->ifname_prefix_lens, gsize, i);
+
+            if (l == len)
+                return;
+            if (l > len)
+                break;
+        }
+        g_array_insert_val(group->ifname_prefix_lens, i, len);
+        return;
+    }
+
+    if (!group->ifname_patterns)
+        group->ifname_patterns =
+            g_ptr_array_new_with_free_func((GDestroyNotify) g_pattern_spec_free);
+    g_ptr_array_add(group->ifname_patterns, g_pattern_spec_new(spec_str));
+}
+
+static void
+_matcher_group_compile_hwaddr(MatcherGroup *group, const char *spec_str)
+{
+    MatcherHwaddr hwaddr;
+
+    if (!_matcher_hwaddr_parse(spec_str, &hwaddr))
+        return;
+
+    if (!group->hwaddrs) {
+        group->hwaddrs = g_hash_table_new_full(_matcher_hwaddr_hash,
+                                               _matcher_hwaddr_equal,
+                                               g_free,
+                                               NULL);
+    }
+    g_hash_table_add(group->hwaddrs, nm_memdup(&hwaddr, sizeof(hwaddr)));
+}
+
+/* This must be kept in sync with match_device_eval(). */
+static void
+_matcher_group_compile(MatcherGroup *group, const char *spec_str, gboolean allow_fuzzy)
+{
+    if (spec_str[0] == '*' && spec_str[1] == '\0') {
+        group->match_all = TRUE;
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, DEVICE_TYPE_TAG)) {
+        _matcher_str_set_add(&group->device_types, spec_str);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, NM_MATCH_SPEC_MAC_TAG)) {
+        _matcher_group_compile_hwaddr(group, spec_str);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, NM_MATCH_SPEC_INTERFACE_NAME_TAG)) {
+        gboolean use_pattern = FALSE;
+
+        if (spec_str[0] == '=')
+            spec_str += 1;
+        else {
+            if (spec_str[0] == '~')
+                spec_str += 1;
+            use_pattern = TRUE;
+        }
+        _matcher_group_compile_ifname(group, spec_str, use_pattern);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, DRIVER_TAG)) {
+        MatcherDriverVersion *d;
+        const char           *t;
+
+        t = strrchr(spec_str, '/');
+        if (!t) {
+            _matcher_str_set_add(&group->drivers, spec_str);
+            return;
+        }
+
+        if (!group->driver_versions) {
+            group->driver_versions = g_array_new(FALSE, FALSE, sizeof(MatcherDriverVersion));
+            g_array_set_clear_func(group->driver_versions, _matcher_driver_version_clear);
+        }
+        g_array_set_size(group->driver_versions, group->driver_versions->len + 1);
+        d             = nm_g_array_last(group->driver_versions, MatcherDriverVersion);
+        d->driver_len = t - spec_str;
+        d->driver     = g_strndup(spec_str, d->driver_len);
+        d->version    = g_pattern_spec_new(&t[1]);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, NM_MATCH_SPEC_S390_SUBCHANNELS_TAG)) {
+        MatcherS390 s390;
+
+        if (!match_device_s390_subchannels_parse(spec_str, &s390.a, &s390.b, &s390.c))
+            return;
+        if (!group->s390_subchannels)
+            group->s390_subchannels = g_array_new(FALSE, FALSE, sizeof(MatcherS390));
+        g_array_append_val(group->s390_subchannels, s390);
+        return;
+    }
+
+    if (_MATCH_CHECK(spec_str, DHCP_PLUGIN_TAG)) {
+        _matcher_str_set_add(&group->dhcp_plugins, spec_str);
+        return;
+    }
+
+    if (allow_fuzzy) {
+        _matcher_group_compile_hwaddr(group, spec_str);
+        _matcher_str_set_add(&group->ifnames, spec_str);
+    }
+}
+
+static void
+_matcher_group_clear(MatcherGroup *group)
+{
+    nm_clear_pointer(&group->ifnames, g_hash_table_unref);
+    nm_clear_pointer(&group->ifname_prefixes, g_hash_table_unref);
+    nm_clear_pointer(&group->ifname_prefix_lens, g_array_unref);
+    nm_clear_pointer(&group->ifname_patterns, g_ptr_array_unref);
+    nm_clear_pointer(&group->device_types, g_hash_table_unref);
+    nm_clear_pointer(&group->drivers, g_hash_table_unref);
+    nm_clear_pointer(&group->driver_versions, g_array_unref);
+    nm_clear_pointer(&group->hwaddrs, g_hash_table_unref);
+    nm_clear_pointer(&group->s390_subchannels, g_array_unref);
+    nm_clear_pointer(&group->dhcp_plugins, g_hash_table_unref);
+}
+
+typedef struct {
+    const char   *interface_name;
+    const char   *device_type;
+    const char   *driver;
+    const char   *driver_version;
+    const char   *dhcp_plugin;
+    MatcherHwaddr hwaddr;
+    MatcherS390   s390;
+    bool          has_s390;
+} MatcherData;
+
+static gboolean
+_matcher_group_match_ifname_prefix(const MatcherGroup *group, const char *interface_name)
+{
+    gsize ifname_len = strlen(interface_name);
+    guint i;
+
+    for (i = 0; i < group->ifname_prefix_lens->len; i++) {
+        gsize         l           = g_array_index(group->ifname_prefix_lens, gsize, i);
+        gs_free char *prefix_free = NULL;
+        char          prefix_buf[64];
+        char         *prefix;
+
+        if (l > ifname_len)
+            break;
+
+        if (l < sizeof(prefix_buf))
+            prefix = prefix_buf;
+        else
+            prefix = prefix_free = g_malloc(l + 1);
+        memcpy(prefix, interface_name, l);
+        prefix[l] = '\0';
+
+        if (g_hash_table_contains(group->ifname_prefixes, prefix))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static gboolean
+_matcher_group_match(const MatcherGroup *group, const MatcherData *data)
+{
+    guint i;
+
+    if (group->match_all)
+        return TRUE;
+
+    if (data->interface_name) {
+        if (group->ifnames && g_hash_table_contains(group->ifnames, data->interface_name))
+            return TRUE;
+        if (group->ifname_prefixes
+            && _matcher_group_match_ifname_prefix(group, data->interface_name))
+            return TRUE;
+    }
+
+    if (data->device_type && group->device_types
+        && g_hash_table_contains(group->device_types, data->device_type))
+        return TRUE;
+
+    if (data->driver) {
+        if (group->drivers && g_hash_table_contains(group->drivers, data->driver))
+            return TRUE;
+        if (group->driver_versions) {
+            for (i = 0; i < group->driver_versions->len; i++) {
+                const MatcherDriverVersion *d =
+                    nm_g_array_index_p(group->driver_versions, MatcherDriverVersion, i);
+
+                if (strncmp(d->driver, data->driver, d->driver_len) == 0
+                    && g_pattern_match_string(d->version, data->driver_version ?: ""))
+                    return TRUE;
+            }
+        }
+    }
+
+    if (data->dhcp_plugin && group->dhcp_plugins
+        && g_hash_table_contains(group->dhcp_plugins, data->dhcp_plugin))
+        return TRUE;
+
+    if (data->hwaddr.len > 0 && group->hwaddrs
+        && g_hash_table_contains(group->hwaddrs, &data->hwaddr))
+        return TRUE;
+
+    if (data->has_s390 && group->s390_subchannels) {
+        for (i = 0; i < group->s390_subchannels->len; i++) {
+            const MatcherS390 *s = nm_g_array_index_p(group->s390_subchannels, MatcherS390, i);
+
+            if (s->a == data->s390.a && s->b == data->s390.b && s->c == data->s390.c)
+                return TRUE;
+        }
+    }
+
+    if (data->interface_name && group->ifname_patterns) {
+        for (i = 0; i < group->ifname_patterns->len; i++) {
+            if (g_pattern_match_string(group->ifname_patterns->pdata[i], data->interface_name))
+                return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * nm_match_spec_device_matcher_new:
+ * @specs: (element-type utf8): a list of device specs
+ *
+ * Compiles @specs once, so that they can be evaluated with
+ * nm_match_spec_device_matcher_match() without parsing the spec strings
+ * again. Interface names, MAC addresses, device types, drivers and
+ * DHCP plugins are looked up in hash tables.
+ *
+ * Returns: (transfer full): the matcher or %NULL if @specs is empty.
+ */
+NMMatchSpecDeviceMatcher *
+nm_match_spec_device_matcher_new(const GSList *specs)
+{
+    NMMatchSpecDeviceMatcher *matcher;
+    const GSList             *iter;
+
+    if (!specs)
+        return NULL;
+
+    matcher = g_slice_new0(NMMatchSpecDeviceMatcher);
+
+    for (iter = specs; iter; iter = iter->next) {
+        const char *spec_str = iter->data;
+        gboolean    except;
+
+        if (!spec_str || !*spec_str)
+            continue;
+
+        spec_str = match_except(spec_str, &except);
+
+        if (except) {
+            matcher->has_except = TRUE;
+            _matcher_group_compile(&matcher->except, spec_str, FALSE);
+        } else {
+            matcher->has_not_except = TRUE;
+            _matcher_group_compile(&matcher->match, spec_str, TRUE);
+        }
+    }
+
+    return matcher;
+}
+
+void
+nm_match_spec_device_matcher_free(NMMatchSpecDeviceMatcher *matcher)
+{
+    if (!matcher)
+        return;
+
+    _matcher_group_clear(&matcher->match);
+    _matcher_group_clear(&matcher->except);
+    nm_g_slice_free(matcher);
+}
+
+/**
+ * nm_match_spec_device_matcher_match:
+ * @matcher: (nullable): the matcher from nm_match_spec_device_matcher_new()
+ *
+ * Like nm_match_spec_device(), but evaluates a compiled list of specs.
+ */
+NMMatchSpecMatchType
+nm_match_spec_device_matcher_match(const NMMatchSpecDeviceMatcher *matcher,
+                                   const char                     *interface_name,
+                                   const char                     *device_type,
+                                   const char                     *driver,
+                                   const char                     *driver_version,
+                                   const char                     *hwaddr,
+                                   const char                     *s390_subchannels,
+                                   const char                     *dhcp_plugin)
+{
+    MatcherData data = {
+        .interface_name = interface_name,
+        .device_type    = nm_str_not_empty(device_type),
+        .driver         = nm_str_not_empty(driver),
+        .driver_version = nm_str_not_empty(driver_version),
+        .dhcp_plugin    = nm_str_not_empty(dhcp_plugin),
+    };
+    gboolean has_match;
+    gboolean has_match_except;
+
+    nm_assert(!hwaddr || nm_utils_hwaddr_valid(hwaddr, -1));
+
+    if (!matcher)
+        return NM_MATCH_SPEC_NO_MATCH;
+
+    if (hwaddr) {
+        if (!_matcher_hwaddr_parse(hwaddr, &data.hwaddr))
+            g_return_val_if_reached(NM_MATCH_SPEC_NO_MATCH);
+    }
+
+    if (s390_subchannels) {
+        data.has_s390 = match_device_s390_subchannels_parse(s390_subchannels,
+                                                            &data.s390.a,
+                                                            &data.s390.b,
+                                                            &data.s390.c);
+    }
+
+    has_match        = matcher->has_not_except && _matcher_group_match(&matcher->match, &data);
+    has_match_except = matcher->has_except && _matcher_group_match(&matcher->except, &data);
+
+    return _match_result(matcher->has_except,
+                         matcher->has_not_except,
+                         has_match,
+                         has_match_except);
+}
+
+/*****************************************************************************/
+
 typedef struct {
     const char *uuid;
     const char *id;
@@ -3196,6 +3674,67 @@ nm_utils_arp_type_get_hwaddr_relevant_part(int arp_type, const guint8 **hwaddr,
     return TRUE;
 }
 
+/**
+ * nm_utils_hwaddr_get_relevant_part:
+ * @hwaddr: the binary hardware address
+ * @hwaddr_len: (inout): the length of @hwaddr
+ *
+ * Like nm_utils_arp_type_get_hwaddr_relevant_part(), but detects the
+ * arp-type from the address length. Addresses of other lengths are
+ * returned as they are.
+ *
+ * Returns: the start of the part of @hwaddr that nm_utils_hwaddr_matches()
+ *   compares. On return, @hwaddr_len is its length.
+ */
+const guint8 *
+nm_utils_hwaddr_get_relevant_part(const guint8 *hwaddr, gsize *hwaddr_len)
+{
+    int arp_type;
+
+    arp_type = nm_utils_arp_type_detect_from_hwaddrlen(*hwaddr_len);
+    if (arp_type >= 0) {
+        if (!nm_utils_arp_type_get_hwaddr_relevant_part(arp_type, &hwaddr, hwaddr_len))
+            nm_assert_not_reached();
+    }
+    return hwaddr;
+}
+
+/**
+ * nm_utils_hwaddr_match_key:
+ * @hwaddr: (nullable): a hardware address string
+ *
+ * Returns a key for looking up @hwaddr in a hash table. Two addresses
+ * have the same key exactly if nm_utils_hwaddr_matches() considers them
+ * equal. In particular, InfiniBand addresses are reduced to their last
+ * 8 bytes (the port GUID), the QPN and subnet prefix in front may differ.
+ *
+ * The key is not a valid address for other purposes.
+ *
+ * Returns: (transfer full): the key, or %NULL if @hwaddr is not
+ *   a valid address.
+ */
+char *
+nm_utils_hwaddr_match_key(const char *hwaddr)
+{
+    guint8        buf[NM_UTILS_HWADDR_LEN_MAX];
+    char          sbuf[NM_UTILS_HWADDR_LEN_MAX * 3];
+    const guint8 *bin;
+    gsize         len;
+    gsize         full_len;
+
+    if (!hwaddr || !_nm_utils_hwaddr_aton(hwaddr, buf, sizeof(buf), &len) || len == 0)
+        return NULL;
+
+    full_len = len;
+    bin      = nm_utils_hwaddr_get_relevant_part(buf, &len);
+
+    /* the prefix keeps a shortened address apart from a real address
+     * of that length. */
+    return g_strconcat(len != full_len ? "ib:" : "",
+                       _nm_utils_hwaddr_ntoa(bin, len, TRUE, sbuf, sizeof(sbuf)),
+                       NULL);
+}
+
 /*****************************************************************************/
 
 /* Returns the "u" (universal/local) bit value for a Modified EUI-64 */
@@ -5266,3 +5805,273 @@ nm_utils_shorten_hostname(const char *hostname, char **shortened)
     *shortened = g_steal_pointer(&s);
     return TRUE;
 }
+
+/*****************************************************************************/
+
+struct _NMUtilsKeyIdx {
+    /* key -> GArray of NMUtilsKeyIdxEntry, sorted by seq. */
+    GHashTable *hash;
+    bool        str_keys;
+};
+
+static NMUtilsKeyIdx *
+_key_idx_new(gboolean str_keys)
+{
+    NMUtilsKeyIdx *idx;
+
+    idx           = g_slice_new(NMUtilsKeyIdx);
+    idx->str_keys = str_keys;
+    if (str_keys) {
+        idx->hash =
+            g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, (GDestroyNotify) g_array_unref);
+    } else {
+        idx->hash =
+            g_hash_table_new_full(nm_direct_hash, NULL, NULL, (GDestroyNotify) g_array_unref);
+    }
+    return idx;
+}
+
+/**
+ * nm_utils_key_idx_new_int:
+ *
+ * Creates an index of objects by integer key, which are passed to the other
+ * functions with GINT_TO_POINTER().
+ *
+ * Returns: (transfer full): the new index.
+ */
+NMUtilsKeyIdx *
+nm_utils_key_idx_new_int(void)
+{
+    return _key_idx_new(FALSE);
+}
+
+/**
+ * nm_utils_key_idx_new_str:
+ *
+ * Creates an index of objects by string key.
+ *
+ * Returns: (transfer full): the new index.
+ */
+NMUtilsKeyIdx *
+nm_utils_key_idx_new_str(void)
+{
+    return _key_idx_new(TRUE);
+}
+
+void
+nm_utils_key_idx_free(NMUtilsKeyIdx *idx)
+{
+    if (!idx)
+        return;
+    g_hash_table_unref(idx->hash);
+    nm_g_slice_free(idx);
+}
+
+/**
+ * nm_utils_key_idx_add:
+ * @idx: the index
+ * @key: the key
+ * @obj: the object to add
+ * @seq: the position of @obj among all objects
+ *
+ * Adds @obj under @key. Several objects can have the same key, lookups
+ * return them sorted by @seq.
+ */
+void
+nm_utils_key_idx_add(NMUtilsKeyIdx *idx, gconstpointer key, gpointer obj, guint64 seq)
+{
+    GArray            *bucket;
+    NMUtilsKeyIdxEntry entry = {
+        .obj = obj,
+        .seq = seq,
+    };
+    guint i;
+
+    nm_assert(idx);
+    nm_assert(!idx->str_keys || key);
+
+    bucket = g_hash_table_lookup(idx->hash, key);
+    if (!bucket) {
+        bucket = g_array_sized_new(FALSE, FALSE, sizeof(NMUtilsKeyIdxEntry), 1);
+        g_hash_table_insert(idx->hash, idx->str_keys ? g_strdup(key) : (gpointer) key, bucket);
+    }
+
+    /* Buckets are short. Usually, there is just one object per key. */
+    for (i = bucket->len; i > 0; i--) {
+        if (nm_g_array_index_p(bucket, NMUtilsKeyIdxEntry, i - 1)->seq < seq)
+            break;
+    }
+    g_array_insert_val(bucket, i, entry);
+}
+
+/**
+ * nm_utils_key_idx_remove:
+ * @idx: the index
+ * @key: the key that @obj was added with
+ * @obj: the object to remove
+ *
+ * Returns: %TRUE if @obj was indexed under @key and got removed.
+ */
+gboolean
+nm_utils_key_idx_remove(NMUtilsKeyIdx *idx, gconstpointer key, gpointer obj)
+{
+    GArray *bucket;
+    guint   i;
+
+    nm_assert(idx);
+
+    bucket = g_hash_table_lookup(idx->hash, key);
+    if (!bucket)
+        return FALSE;
+
+    for (i = 0; i < bucket->len; i++) {
+        if (nm_g_array_index_p(bucket, NMUtilsKeyIdxEntry, i)->obj != obj)
+            continue;
+        if (bucket->len == 1)
+            g_hash_table_remove(idx->hash, key);
+        else
+            g_array_remove_index(bucket, i);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * nm_utils_key_idx_lookup:
+ * @idx: the index
+ * @key: the key
+ * @out_len: (out): the number of returned entries
+ *
+ * Returns: (transfer none): the entries for @key, sorted by their seq, or
+ *   %NULL. The array is only valid until the index is modified.
+ */
+const NMUtilsKeyIdxEntry *
+nm_utils_key_idx_lookup(const NMUtilsKeyIdx *idx, gconstpointer key, guint *out_len)
+{
+    GArray *bucket;
+
+    nm_assert(idx);
+    nm_assert(out_len);
+
+    if (idx->str_keys && !key) {
+        *out_len = 0;
+        return NULL;
+    }
+
+    bucket = g_hash_table_lookup(idx->hash, key);
+    if (!bucket) {
+        *out_len = 0;
+        return NULL;
+    }
+
+    *out_len = bucket->len;
+    return nm_g_array_index_p(bucket, NMUtilsKeyIdxEntry, 0);
+}
+
+/*****************************************************************************/
+
+static guint
+_variant_hash(gconstpointer ptr)
+{
+    GVariant *v = (GVariant *) ptr;
+
+    return nm_hash_mem(1386441917u, g_variant_get_data(v), g_variant_get_size(v));
+}
+
+static void
+_variant_count_add(GHashTable *counts, GVariant *v_take)
+{
+    gpointer orig_key;
+    gpointer count;
+
+    if (g_hash_table_lookup_extended(counts, v_take, &orig_key, &count)) {
+        g_variant_unref(v_take);
+        g_hash_table_insert(counts,
+                            g_variant_ref(orig_key),
+                            GUINT_TO_POINTER(GPOINTER_TO_UINT(count) + 1u));
+    } else
+        g_hash_table_insert(counts, v_take, GUINT_TO_POINTER(1u));
+}
+
+static gboolean
+_variant_count_remove(GHashTable *counts, GVariant *v)
+{
+    guint count;
+
+    count = GPOINTER_TO_UINT(g_hash_table_lookup(counts, v));
+    if (count == 0)
+        return FALSE;
+    if (count == 1)
+        g_hash_table_remove(counts, v);
+    else
+        g_hash_table_insert(counts, g_variant_ref(v), GUINT_TO_POINTER(count - 1u));
+    return TRUE;
+}
+
+/**
+ * nm_utils_variant_array_diff:
+ * @array_type: the #GVariantType of @v_old, @v_new and the results
+ * @v_old: (nullable): the previous array, %NULL for an empty one
+ * @v_new: (nullable): the current array, %NULL for an empty one
+ * @out_added: (out) (transfer full): the elements that are in @v_new
+ *   but not in @v_old, in the order of @v_new
+ * @out_removed: (out) (transfer full): the elements that are in @v_old
+ *   but not in @v_new, in the order of @v_old
+ *
+ * Compares the elements of two arrays as multisets. The order of the
+ * elements does not matter, but duplicates do: an element that appears
+ * twice in @v_new and once in @v_old is reported once in @out_added.
+ * Applying @out_removed and @out_added to @v_old therefore always
+ * gives the multiset of @v_new.
+ */
+void
+nm_utils_variant_array_diff(const GVariantType *array_type,
+                            GVariant           *v_old,
+                            GVariant           *v_new,
+                            GVariant          **out_added,
+                            GVariant          **out_removed)
+{
+    gs_unref_hashtable GHashTable *counts = NULL;
+    GVariantBuilder                builder_added;
+    GVariantBuilder                builder_removed;
+    gsize                          n_old;
+    gsize                          n_new;
+    gsize                          i;
+
+    nm_assert(g_variant_type_is_array(array_type));
+    nm_assert(!v_old || g_variant_is_of_type(v_old, array_type));
+    nm_assert(!v_new || g_variant_is_of_type(v_new, array_type));
+    nm_assert(out_added);
+    nm_assert(out_removed);
+
+    n_old = v_old ? g_variant_n_children(v_old) : 0u;
+    n_new = v_new ? g_variant_n_children(v_new) : 0u;
+
+    counts = g_hash_table_new_full(_variant_hash,
+                                   (GEqualFunc) g_variant_equal,
+                                   (GDestroyNotify) g_variant_unref,
+                                   NULL);
+    for (i = 0; i < n_old; i++)
+        _variant_count_add(counts, g_variant_get_child_value(v_old, i));
+
+    g_variant_builder_init(&builder_added, array_type);
+    for (i = 0; i < n_new; i++) {
+        gs_unref_variant GVariant *v = g_variant_get_child_value(v_new, i);
+
+        if (!_variant_count_remove(counts, v))
+            g_variant_builder_add_value(&builder_added, v);
+    }
+
+    /* What is left in @counts is gone. Iterate @v_old again to report the
+     * removed elements in their previous order. */
+    g_variant_builder_init(&builder_removed, array_type);
+    for (i = 0; i < n_old && g_hash_table_size(counts) > 0; i++) {
+        gs_unref_variant GVariant *v = g_variant_get_child_value(v_old, i);
+
+        if (_variant_count_remove(counts, v))
+            g_variant_builder_add_value(&builder_removed, v);
+    }
+
+    *out_added   = g_variant_ref_sink(g_variant_builder_end(&builder_added));
+    *out_removed = g_variant_ref_sink(g_variant_builder_end(&builder_removed));
+}
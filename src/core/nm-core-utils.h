@@ -205,6 +205,24 @@ NMMatchSpecMatchType nm_match_spec_config(const GSList *specs, guint nm_version,
 GSList              *nm_match_spec_split(const char *value);
 char                *nm_match_spec_join(GSList *specs);
 
+NMMatchSpecDeviceMatcher *nm_match_spec_device_matcher_new(const GSList *specs);
+void                      nm_match_spec_device_matcher_free(NMMatchSpecDeviceMatcher *matcher);
+
+NM_AUTO_DEFINE_FCN0(NMMatchSpecDeviceMatcher *,
+                    _nm_auto_free_match_spec_device_matcher,
+                    nm_match_spec_device_matcher_free);
+#define nm_auto_free_match_spec_device_matcher nm_auto(_nm_auto_free_match_spec_device_matcher)
+
+NMMatchSpecMatchType
+nm_match_spec_device_matcher_match(const NMMatchSpecDeviceMatcher *matcher,
+                                   const char                     *interface_name,
+                                   const char                     *device_type,
+                                   const char                     *driver,
+                                   const char                     *driver_version,
+                                   const char                     *hwaddr,
+                                   const char                     *s390_subchannels,
+                                   const char                     *dhcp_plugin);
+
 gboolean nm_wildcard_match_check(const char *str, const char *const *patterns, guint num_patterns);
 
 gboolean nm_utils_kernel_cmdline_match_check(const char *const *proc_cmdline,
@@ -286,6 +304,10 @@ gboolean nm_utils_arp_type_validate_hwaddr(int arp_type, const guint8 *hwaddr, g
 gboolean
 nm_utils_arp_type_get_hwaddr_relevant_part(int arp_type, const guint8 **hwaddr, gsize *hwaddr_len);
 
+const guint8 *nm_utils_hwaddr_get_relevant_part(const guint8 *hwaddr, gsize *hwaddr_len);
+
+char *nm_utils_hwaddr_match_key(const char *hwaddr);
+
 /*****************************************************************************/
 
 typedef enum {
@@ -474,6 +496,36 @@ char *nm_utils_spawn_helper_finish(GAsyncResult *result, GError **error);
 
 /*****************************************************************************/
 
+typedef struct _NMUtilsKeyIdx NMUtilsKeyIdx;
+
+typedef struct {
+    gpointer obj;
+    guint64  seq;
+} NMUtilsKeyIdxEntry;
+
+NMUtilsKeyIdx *nm_utils_key_idx_new_int(void);
+NMUtilsKeyIdx *nm_utils_key_idx_new_str(void);
+void           nm_utils_key_idx_free(NMUtilsKeyIdx *idx);
+
+NM_AUTO_DEFINE_FCN0(NMUtilsKeyIdx *, _nm_auto_free_key_idx, nm_utils_key_idx_free);
+#define nm_auto_free_key_idx nm_auto(_nm_auto_free_key_idx)
+
+void     nm_utils_key_idx_add(NMUtilsKeyIdx *idx, gconstpointer key, gpointer obj, guint64 seq);
+gboolean nm_utils_key_idx_remove(NMUtilsKeyIdx *idx, gconstpointer key, gpointer obj);
+
+const NMUtilsKeyIdxEntry *
+nm_utils_key_idx_lookup(const NMUtilsKeyIdx *idx, gconstpointer key, guint *out_len);
+
+/*****************************************************************************/
+
+void nm_utils_variant_array_diff(const GVariantType *array_type,
+                                 GVariant           *v_old,
+                                 GVariant           *v_new,
+                                 GVariant          **out_added,
+                                 GVariant          **out_removed);
+
+/*****************************************************************************/
+
 uid_t nm_utils_get_nm_uid(void);
 
 gid_t nm_utils_get_nm_gid(void);
@@ -14,6 +14,7 @@
 
 #include "c-list/src/c-list.h"
 #include "libnm-glib-aux/nm-c-list.h"
+#include "libnm-glib-aux/nm-dbus-aux.h"
 #include "nm-dbus-interface.h"
 #include "libnm-core-intern/nm-core-internal.h"
 #include "libnm-std-aux/nm-dbus-compat.h"
@@ -43,6 +44,9 @@ typedef struct {
 
 typedef struct {
     GVariant *value;
+
+    /* the property changed, but the PropertiesChanged signal is not yet sent. */
+    bool changed_pending : 1;
 } PropertyCacheData;
 
 typedef struct {
@@ -51,7 +55,17 @@ typedef struct {
     NMDBusObjectClass *klass;
     guint              info_idx;
     guint              registration_id;
-    PropertyCacheData  property_cache[];
+
+    /* maps the GObject property names to the index of the property in the
+     * interface info. Owned by NMDBusManagerPrivate.property_idx_by_interface. */
+    GHashTable *property_idx_by_name;
+
+    /* the "a{sv}" dictionary with all properties of the interface, as
+     * returned for GetManagedObjects() and InterfacesAdded. */
+    GVariant *properties_all;
+
+    bool              changed_pending : 1;
+    PropertyCacheData property_cache[];
 } RegistrationData;
 
 /* we require that @path is the first member of NMDBusManagerData
@@ -78,7 +92,21 @@ typedef struct {
 
     GDBusConnection *main_dbus_connection;
 
-    CList caller_info_lst_head;
+    /* The credentials of bus clients by unique name, in LRU order. */
+    CList       caller_info_lst_head;
+    GHashTable *caller_info_by_sender;
+    guint       name_owner_changed_id;
+
+    /* a per interface-info index for _nm_dbus_manager_obj_notify(). See
+     * _interface_info_get_property_idx_by_name(). */
+    GHashTable *property_idx_by_interface;
+
+    /* objects with a delayed PropertiesChanged signal, in the order they were delayed. */
+    CList properties_changed_lst_head;
+
+    guint64 properties_changed_emitted;
+    guint64 properties_changed_suppressed;
+    guint   properties_changed_interval_msec;
 
     guint objmgr_registration_id;
     bool  started : 1;
@@ -111,6 +139,8 @@ static const GDBusInterfaceInfo interface_info_objmgr;
 static const GDBusSignalInfo    signal_info_objmgr_interfaces_added;
 static const GDBusSignalInfo    signal_info_objmgr_interfaces_removed;
 static GVariantBuilder *_obj_collect_properties_all(NMDBusObject *obj, GVariantBuilder *builder);
+static void _obj_properties_changed_clear(NMDBusObject *obj);
+static void _obj_properties_changed_flush_all(NMDBusManager *self);
 
 /*****************************************************************************/
 
@@ -446,12 +476,46 @@ private_server_get_connection_by_owner(PrivateServer *s, const char *owner)
 /*****************************************************************************/
 
 static void
-_caller_info_free(CallerInfo *caller_info)
+_caller_info_free(NMDBusManager *self, CallerInfo *caller_info)
 {
+    NMDBusManagerPrivate *priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+
+    if (!g_hash_table_remove(priv->caller_info_by_sender, caller_info->sender))
+        nm_assert_not_reached();
     c_list_unlink_stale(&caller_info->caller_info_lst);
     g_free(caller_info);
 }
 
+static void
+_caller_info_name_owner_changed_cb(GDBusConnection *connection,
+                                   const char      *sender_name,
+                                   const char      *object_path,
+                                   const char      *interface_name,
+                                   const char      *signal_name,
+                                   GVariant        *parameters,
+                                   gpointer         user_data)
+{
+    NMDBusManager        *self = user_data;
+    NMDBusManagerPrivate *priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+    CallerInfo           *caller_info;
+    const char           *name;
+    const char           *new_owner;
+
+    if (!g_variant_is_of_type(parameters, G_VARIANT_TYPE("(sss)")))
+        return;
+
+    g_variant_get(parameters, "(&s&s&s)", &name, NULL, &new_owner);
+
+    /* Unique names are never reused. Once a client disconnects, drop what
+     * we know about it. */
+    if (new_owner[0] != '\0' || name[0] != ':')
+        return;
+
+    caller_info = g_hash_table_lookup(priv->caller_info_by_sender, name);
+    if (caller_info)
+        _caller_info_free(self, caller_info);
+}
+
 static gboolean
 _bus_get_unix_pid(NMDBusManager *self, const char *sender, gulong *out_pid)
 {
@@ -520,28 +584,17 @@ _get_caller_info_ensure(NMDBusManager *self,
 {
     NMDBusManagerPrivate *priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
     CallerInfo           *caller_info;
-    CallerInfo           *ci;
     gint64                now_ns;
-    gsize                 num;
 
-#define CALLER_INFO_MAX_AGE (NM_UTILS_NSEC_PER_SEC * 1)
+#define CALLER_INFO_MAX_AGE  (NM_UTILS_NSEC_PER_SEC * 1)
+#define CALLER_INFO_MAX_SIZE 256
 
-    /* Linear search the cache for the sender.
-     *
-     * The number of cached caller-infos is limited. Hence, it's O(1) and
-     * the list is reasonably short.
-     * Also, the entire caching assumes that we repeatedly ask for the
-     * same sender. That means, we expect to find the right caller info
-     * at the front of the list. */
-    num         = 1;
-    caller_info = NULL;
-    c_list_for_each_entry (ci, &priv->caller_info_lst_head, caller_info_lst) {
-        if (nm_streq(sender, ci->sender)) {
-            caller_info = ci;
-            break;
-        }
-        num++;
-    }
+    /* The credentials of a unique name cannot change while the client is
+     * connected. When we watch NameOwnerChanged, entries get dropped when the
+     * client disconnects and successfully resolved credentials are reused
+     * until then. Failed lookups, and all lookups when we cannot watch the
+     * bus, are retried after CALLER_INFO_MAX_AGE. */
+    caller_info = g_hash_table_lookup(priv->caller_info_by_sender, sender);
 
     if (caller_info)
         nm_c_list_move_front(&priv->caller_info_lst_head, &caller_info->caller_info_lst);
@@ -555,17 +608,25 @@ _get_caller_info_ensure(NMDBusManager *self,
         };
         memcpy(caller_info->sender, sender, l);
         c_list_link_front(&priv->caller_info_lst_head, &caller_info->caller_info_lst);
+        g_hash_table_add(priv->caller_info_by_sender, caller_info->sender);
 
-        /* only cache the last few entries. */
-        while (TRUE) {
-            nm_assert(num > 0 && num == c_list_length(&priv->caller_info_lst_head));
-            if (num-- <= 5)
-                break;
+        if (g_hash_table_size(priv->caller_info_by_sender) > CALLER_INFO_MAX_SIZE) {
             _caller_info_free(
+                self,
                 c_list_last_entry(&priv->caller_info_lst_head, CallerInfo, caller_info_lst));
         }
     }
 
+    if (priv->name_owner_changed_id != 0) {
+        if (caller_info->uid_valid)
+            ensure_uid = FALSE;
+        if (caller_info->pid_valid)
+            ensure_pid = FALSE;
+    }
+
+    if (!ensure_uid && !ensure_pid)
+        return caller_info;
+
     now_ns = nm_utils_get_monotonic_timestamp_nsec();
 
     if (ensure_uid && (now_ns - caller_info->uid_checked_at) > CALLER_INFO_MAX_AGE) {
@@ -869,9 +930,10 @@ _obj_get_property(RegistrationData *reg_data, guint property_idx, gboolean refet
     property_info =
         (const NMDBusPropertyInfoExtended *) (interface_info->parent.properties[property_idx]);
 
-    if (refetch)
+    if (refetch) {
         nm_clear_g_variant(&reg_data->property_cache[property_idx].value);
-    else {
+        nm_clear_g_variant(&reg_data->properties_all);
+    } else {
         value = reg_data->property_cache[property_idx].value;
         if (value)
             goto out;
@@ -915,6 +977,45 @@ static const GDBusInterfaceVTable dbus_vtable = {
     .set_property = NULL,
 };
 
+static GHashTable *
+_interface_info_get_property_idx_by_name(NMDBusManager                     *self,
+                                         const NMDBusInterfaceInfoExtended *interface_info)
+{
+    NMDBusManagerPrivate *priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+    GHashTable           *idx_by_name;
+    guint                 i;
+
+    if (!interface_info->parent.properties)
+        return NULL;
+
+    /* The interface infos are static data, so the index is created once for
+     * each interface (when the first object with that interface gets registered)
+     * and kept for the lifetime of the manager. */
+    if (G_UNLIKELY(!priv->property_idx_by_interface)) {
+        priv->property_idx_by_interface =
+            g_hash_table_new_full(nm_direct_hash, NULL, NULL, (GDestroyNotify) g_hash_table_unref);
+    }
+
+    idx_by_name = g_hash_table_lookup(priv->property_idx_by_interface, interface_info);
+    if (idx_by_name)
+        return idx_by_name;
+
+    idx_by_name = g_hash_table_new(nm_str_hash, g_str_equal);
+    for (i = 0; interface_info->parent.properties[i]; i++) {
+        const NMDBusPropertyInfoExtended *property_info =
+            (const NMDBusPropertyInfoExtended *) interface_info->parent.properties[i];
+
+        /* an interface never exposes the same GObject property twice. */
+        nm_assert(!g_hash_table_contains(idx_by_name, property_info->property_name));
+
+        g_hash_table_insert(idx_by_name,
+                            (gpointer) property_info->property_name,
+                            GUINT_TO_POINTER(i + 1u));
+    }
+    g_hash_table_insert(priv->property_idx_by_interface, (gpointer) interface_info, idx_by_name);
+    return idx_by_name;
+}
+
 static void
 _obj_register(NMDBusManager *self, NMDBusObject *obj)
 {
@@ -979,10 +1080,12 @@ _obj_register(NMDBusManager *self, NMDBusObject *obj)
                 continue;
             }
 
-            reg_data->obj             = obj;
-            reg_data->klass           = g_type_class_ref(G_TYPE_FROM_CLASS(klass));
-            reg_data->info_idx        = i;
-            reg_data->registration_id = registration_id;
+            reg_data->obj                  = obj;
+            reg_data->klass                = g_type_class_ref(G_TYPE_FROM_CLASS(klass));
+            reg_data->info_idx             = i;
+            reg_data->registration_id      = registration_id;
+            reg_data->property_idx_by_name =
+                _interface_info_get_property_idx_by_name(self, interface_info);
             c_list_link_tail(&obj->internal.registration_lst_head, &reg_data->registration_lst);
         }
     }
@@ -1004,7 +1107,11 @@ _obj_register(NMDBusManager *self, NMDBusObject *obj)
      * notifications out. Which is a bit odd, as we just export the object.
      *
      * In general, it's ok to export an object with frozen signals. But you better make sure
-     * that all properties are in a self-consistent state when exporting the object. */
+     * that all properties are in a self-consistent state when exporting the object.
+     *
+     * Delayed PropertiesChanged signals of other objects might reference the new object
+     * or be referenced by it. Send them first, so that signals are seen in order. */
+    _obj_properties_changed_flush_all(self);
     g_dbus_connection_emit_signal(priv->main_dbus_connection,
                                   NULL,
                                   OBJECT_MANAGER_SERVER_BASE_PATH,
@@ -1029,6 +1136,11 @@ _obj_unregister(NMDBusManager *self, NMDBusObject *obj)
     nm_assert(priv->started);
     nm_assert(!c_list_is_empty(&obj->internal.registration_lst_head));
 
+    /* the object goes away. Pending PropertiesChanged signals are irrelevant now. But
+     * those of other objects must reach the clients before InterfacesRemoved. */
+    _obj_properties_changed_clear(obj);
+    _obj_properties_changed_flush_all(self);
+
     g_variant_builder_init(&builder, G_VARIANT_TYPE("as"));
 
     while ((reg_data = c_list_last_entry(&obj->internal.registration_lst_head,
@@ -1047,6 +1159,7 @@ _obj_unregister(NMDBusManager *self, NMDBusObject *obj)
             for (i = 0; interface_info->parent.properties[i]; i++)
                 nm_clear_g_variant(&reg_data->property_cache[i].value);
         }
+        nm_clear_g_variant(&reg_data->properties_all);
 
         g_type_class_unref(reg_data->klass);
         g_free(reg_data);
@@ -1147,12 +1260,121 @@ _nm_dbus_manager_obj_unexport(NMDBusObject *obj)
     c_list_unlink(&obj->internal.objects_lst);
 }
 
+static void
+_obj_properties_changed_clear(NMDBusObject *obj)
+{
+    RegistrationData *reg_data;
+
+    nm_clear_g_source_inst(&obj->internal.properties_changed_source);
+    c_list_unlink(&obj->internal.properties_changed_lst);
+
+    c_list_for_each_entry (reg_data, &obj->internal.registration_lst_head, registration_lst) {
+        const NMDBusInterfaceInfoExtended *interface_info;
+        guint                              i;
+
+        if (!reg_data->changed_pending)
+            continue;
+
+        reg_data->changed_pending = FALSE;
+
+        interface_info = _reg_data_get_interface_info(reg_data);
+        for (i = 0; interface_info->parent.properties[i]; i++)
+            reg_data->property_cache[i].changed_pending = FALSE;
+    }
+}
+
+static void
+_obj_properties_changed_emit(NMDBusManager *self, NMDBusObject *obj)
+{
+    NMDBusManagerPrivate *priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+    RegistrationData     *reg_data;
+
+    nm_clear_g_source_inst(&obj->internal.properties_changed_source);
+    c_list_unlink(&obj->internal.properties_changed_lst);
+
+    c_list_for_each_entry (reg_data, &obj->internal.registration_lst_head, registration_lst) {
+        const NMDBusInterfaceInfoExtended *interface_info;
+        GVariantBuilder                    builder;
+        GVariantBuilder                    invalidated_builder;
+        guint                              i;
+
+        if (!reg_data->changed_pending)
+            continue;
+
+        reg_data->changed_pending = FALSE;
+
+        interface_info = _reg_data_get_interface_info(reg_data);
+
+        /* The order in which properties are added to the GVariant is strictly defined
+         * to be the order in which the D-Bus property-info is declared. */
+        g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
+        for (i = 0; interface_info->parent.properties[i]; i++) {
+            gs_unref_variant GVariant *value = NULL;
+
+            if (!reg_data->property_cache[i].changed_pending)
+                continue;
+
+            reg_data->property_cache[i].changed_pending = FALSE;
+
+            value = _obj_get_property(reg_data, i, TRUE);
+            g_variant_builder_add(&builder,
+                                  "{sv}",
+                                  interface_info->parent.properties[i]->name,
+                                  value);
+        }
+
+        g_variant_builder_init(&invalidated_builder, G_VARIANT_TYPE("as"));
+        g_dbus_connection_emit_signal(priv->main_dbus_connection,
+                                      NULL,
+                                      obj->internal.path,
+                                      DBUS_INTERFACE_PROPERTIES,
+                                      "PropertiesChanged",
+                                      g_variant_new("(sa{sv}as)",
+                                                    interface_info->parent.name,
+                                                    &builder,
+                                                    &invalidated_builder),
+                                      NULL);
+        priv->properties_changed_emitted++;
+    }
+
+    if (priv->properties_changed_interval_msec > 0)
+        obj->internal.properties_changed_last_msec = nm_utils_get_monotonic_timestamp_msec();
+}
+
+/* Send all delayed PropertiesChanged signals. This must happen before any other
+ * signal is sent, so that clients never see a signal before the property changes
+ * that happened before it (for example, a property referencing an object after
+ * InterfacesRemoved for that object). */
+static void
+_obj_properties_changed_flush_all(NMDBusManager *self)
+{
+    NMDBusManagerPrivate *priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+    NMDBusObject         *obj;
+
+    while ((obj = c_list_first_entry(&priv->properties_changed_lst_head,
+                                     NMDBusObject,
+                                     internal.properties_changed_lst)))
+        _obj_properties_changed_emit(self, obj);
+}
+
+static gboolean
+_obj_properties_changed_timeout_cb(gpointer user_data)
+{
+    NMDBusObject *obj = user_data;
+
+    _obj_properties_changed_emit(obj->internal.bus_manager, obj);
+    return G_SOURCE_CONTINUE;
+}
+
 void
 _nm_dbus_manager_obj_notify(NMDBusObject *obj, guint n_pspecs, const GParamSpec *const *pspecs)
 {
     NMDBusManager        *self;
     NMDBusManagerPrivate *priv;
     RegistrationData     *reg_data;
+    gboolean              has_changes = FALSE;
+    gint64                now_msec;
+    gint64                next_msec;
     guint                 i, p;
 
     nm_assert(NM_IS_DBUS_OBJECT(obj));
@@ -1170,59 +1392,60 @@ _nm_dbus_manager_obj_notify(NMDBusObject *obj, guint n_pspecs, const GParamSpec
     if (G_UNLIKELY(!priv->started))
         return;
 
-    /* do a naive search for the matching NMDBusPropertyInfoExtended infos. Since the number of
-     * (interfaces x properties) is static and possibly small, this naive search is effectively
-     * O(1). We might wanna introduce some index to lookup the properties in question faster.
-     *
-     * The nice part of this implementation is however, that the order in which properties
-     * are added to the GVariant is strictly defined to be the order in which the D-Bus property-info
-     * is declared. Getting a defined ordering with some smart lookup would be hard. */
+    /* Look up the changed properties via the index. They are only marked as pending
+     * here. The signal is sent by _obj_properties_changed_emit(), which adds them in
+     * the order in which the D-Bus property-info is declared. */
     c_list_for_each_entry (reg_data, &obj->internal.registration_lst_head, registration_lst) {
-        const NMDBusInterfaceInfoExtended *interface_info = _reg_data_get_interface_info(reg_data);
-        gboolean                           has_properties = FALSE;
-        GVariantBuilder                    builder;
-        GVariantBuilder                    invalidated_builder;
-        GVariant                          *args;
-
-        if (!interface_info->parent.properties)
+        if (!reg_data->property_idx_by_name)
             continue;
 
-        for (i = 0; interface_info->parent.properties[i]; i++) {
-            const NMDBusPropertyInfoExtended *property_info =
-                (const NMDBusPropertyInfoExtended *) interface_info->parent.properties[i];
-
-            for (p = 0; p < n_pspecs; p++) {
-                const GParamSpec          *pspec = pspecs[p];
-                gs_unref_variant GVariant *value = NULL;
+        for (p = 0; p < n_pspecs; p++) {
+            gpointer ptr;
 
-                if (!nm_streq(property_info->property_name, pspec->name))
-                    continue;
+            ptr = g_hash_table_lookup(reg_data->property_idx_by_name, pspecs[p]->name);
+            if (!ptr)
+                continue;
 
-                value = _obj_get_property(reg_data, i, TRUE);
+            i = GPOINTER_TO_UINT(ptr) - 1u;
 
-                if (!has_properties) {
-                    has_properties = TRUE;
-                    g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
-                }
-                g_variant_builder_add(&builder, "{sv}", property_info->parent.name, value);
-            }
+            /* drop the cached value right away, so that Get() and GetManagedObjects()
+             * return the new value even while the signal is delayed. */
+            nm_clear_g_variant(&reg_data->property_cache[i].value);
+            nm_clear_g_variant(&reg_data->properties_all);
+            reg_data->property_cache[i].changed_pending = TRUE;
+            reg_data->changed_pending                   = TRUE;
+            has_changes                                 = TRUE;
         }
+    }
 
-        if (!has_properties)
-            continue;
+    if (!has_changes)
+        return;
 
-        args = g_variant_builder_end(&builder);
+    if (priv->properties_changed_interval_msec == 0) {
+        _obj_properties_changed_emit(self, obj);
+        return;
+    }
 
-        g_variant_builder_init(&invalidated_builder, G_VARIANT_TYPE("as"));
-        g_dbus_connection_emit_signal(
-            priv->main_dbus_connection,
-            NULL,
-            obj->internal.path,
-            DBUS_INTERFACE_PROPERTIES,
-            "PropertiesChanged",
-            g_variant_new("(s@a{sv}as)", interface_info->parent.name, args, &invalidated_builder),
-            NULL);
+    if (obj->internal.properties_changed_source) {
+        /* a signal is already scheduled. The changes get merged into it. */
+        priv->properties_changed_suppressed++;
+        return;
+    }
+
+    /* Rate limit the PropertiesChanged signals of an object: the first change after
+     * a quiet period is sent right away. Further changes within the interval are
+     * collected and sent together when the interval ends. */
+    now_msec  = nm_utils_get_monotonic_timestamp_msec();
+    next_msec = obj->internal.properties_changed_last_msec + priv->properties_changed_interval_msec;
+    if (obj->internal.properties_changed_last_msec == 0 || now_msec >= next_msec) {
+        _obj_properties_changed_emit(self, obj);
+        return;
     }
+
+    priv->properties_changed_suppressed++;
+    obj->internal.properties_changed_source =
+        nm_g_timeout_add_source(next_msec - now_msec, _obj_properties_changed_timeout_cb, obj);
+    c_list_link_tail(&priv->properties_changed_lst_head, &obj->internal.properties_changed_lst);
 }
 
 void
@@ -1247,6 +1470,10 @@ _nm_dbus_manager_obj_emit_signal(NMDBusObject                      *obj,
         return;
     }
 
+    /* Clients expect to see the property changes that happened before the
+     * signal, also those of other objects. Flush them first. */
+    _obj_properties_changed_flush_all(self);
+
     g_dbus_connection_emit_signal(priv->main_dbus_connection,
                                   NULL,
                                   obj->internal.path,
@@ -1258,15 +1485,22 @@ _nm_dbus_manager_obj_emit_signal(NMDBusObject                      *obj,
 
 /*****************************************************************************/
 
-static GVariantBuilder *
-_obj_collect_properties_per_interface(NMDBusObject     *obj,
-                                      RegistrationData *reg_data,
-                                      GVariantBuilder  *builder)
+static GVariant *
+_obj_collect_properties_per_interface(NMDBusObject *obj, RegistrationData *reg_data)
 {
-    const NMDBusInterfaceInfoExtended *interface_info = _reg_data_get_interface_info(reg_data);
+    const NMDBusInterfaceInfoExtended *interface_info;
+    GVariantBuilder                    builder;
     guint                              i;
 
-    g_variant_builder_init(builder, G_VARIANT_TYPE("a{sv}"));
+    /* Monitoring clients may call GetManagedObjects() frequently. The dictionary
+     * only changes when one of its properties changes, so we cache it until
+     * the next notification. */
+    if (reg_data->properties_all)
+        return reg_data->properties_all;
+
+    interface_info = _reg_data_get_interface_info(reg_data);
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a{sv}"));
     if (interface_info->parent.properties) {
         for (i = 0; interface_info->parent.properties[i]; i++) {
             const NMDBusPropertyInfoExtended *property_info =
@@ -1274,10 +1508,12 @@ _obj_collect_properties_per_interface(NMDBusObject     *obj,
             gs_unref_variant GVariant *variant = NULL;
 
             variant = _obj_get_property(reg_data, i, FALSE);
-            g_variant_builder_add(builder, "{sv}", property_info->parent.name, variant);
+            g_variant_builder_add(&builder, "{sv}", property_info->parent.name, variant);
         }
     }
-    return builder;
+
+    reg_data->properties_all = g_variant_ref_sink(g_variant_builder_end(&builder));
+    return reg_data->properties_all;
 }
 
 static GVariantBuilder *
@@ -1288,13 +1524,10 @@ _obj_collect_properties_all(NMDBusObject *obj, GVariantBuilder *builder)
     g_variant_builder_init(builder, G_VARIANT_TYPE("a{sa{sv}}"));
 
     c_list_for_each_entry (reg_data, &obj->internal.registration_lst_head, registration_lst) {
-        GVariantBuilder properties_builder;
-
-        g_variant_builder_add(
-            builder,
-            "{sa{sv}}",
-            _reg_data_get_interface_info(reg_data)->parent.name,
-            _obj_collect_properties_per_interface(obj, reg_data, &properties_builder));
+        g_variant_builder_add(builder,
+                              "{s@a{sv}}",
+                              _reg_data_get_interface_info(reg_data)->parent.name,
+                              _obj_collect_properties_per_interface(obj, reg_data));
     }
 
     return builder;
@@ -1435,6 +1668,13 @@ nm_dbus_manager_acquire_bus(NMDBusManager *self, gboolean request_name)
 
     g_dbus_connection_set_exit_on_close(priv->main_dbus_connection, FALSE);
 
+    priv->name_owner_changed_id =
+        nm_dbus_connection_signal_subscribe_name_owner_changed(priv->main_dbus_connection,
+                                                               NULL,
+                                                               _caller_info_name_owner_changed_cb,
+                                                               self,
+                                                               NULL);
+
     if (!request_name) {
         _LOGD("D-Bus connection created");
         return TRUE;
@@ -1490,6 +1730,46 @@ nm_dbus_manager_acquire_bus(NMDBusManager *self, gboolean request_name)
     return TRUE;
 }
 
+/**
+ * _nm_dbus_manager_set_connection_for_testing:
+ * @self: the #NMDBusManager
+ * @connection: a (peer-to-peer) #GDBusConnection
+ *
+ * Like nm_dbus_manager_acquire_bus(), but uses @connection instead of the
+ * system bus and does not request the well-known name. Only for unit tests.
+ *
+ * Returns: %TRUE if the object manager could be registered on @connection.
+ */
+gboolean
+_nm_dbus_manager_set_connection_for_testing(NMDBusManager *self, GDBusConnection *connection)
+{
+    NMDBusManagerPrivate *priv;
+    gs_free_error GError *error = NULL;
+
+    g_return_val_if_fail(NM_IS_DBUS_MANAGER(self), FALSE);
+    g_return_val_if_fail(G_IS_DBUS_CONNECTION(connection), FALSE);
+
+    priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+
+    g_return_val_if_fail(!priv->main_dbus_connection, FALSE);
+
+    priv->main_dbus_connection   = g_object_ref(connection);
+    priv->objmgr_registration_id = g_dbus_connection_register_object(
+        priv->main_dbus_connection,
+        OBJECT_MANAGER_SERVER_BASE_PATH,
+        NM_UNCONST_PTR(GDBusInterfaceInfo, &interface_info_objmgr),
+        &dbus_vtable_objmgr,
+        self,
+        NULL,
+        &error);
+    if (!priv->objmgr_registration_id) {
+        _LOGE("failure to register object manager: %s", error->message);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
 void
 nm_dbus_manager_stop(NMDBusManager *self)
 {
@@ -1497,6 +1777,11 @@ nm_dbus_manager_stop(NMDBusManager *self)
 
     priv->shutting_down = TRUE;
 
+    _LOGD("PropertiesChanged signals: %" G_GUINT64_FORMAT " emitted, %" G_GUINT64_FORMAT
+          " suppressed",
+          priv->properties_changed_emitted,
+          priv->properties_changed_suppressed);
+
     /* during shutdown we also clear the set-property-handler. It's no longer
      * possible to set a property, because doing so would require authorization,
      * which is async, which is just complicated to get right. No more property
@@ -1511,6 +1796,38 @@ nm_dbus_manager_is_stopping(NMDBusManager *self)
     return NM_DBUS_MANAGER_GET_PRIVATE(self)->shutting_down;
 }
 
+/**
+ * nm_dbus_manager_set_properties_changed_interval:
+ * @self: the #NMDBusManager
+ * @interval_msec: the minimum interval between two PropertiesChanged
+ *   signals of the same object, or 0 to send them right away.
+ *
+ * Property changes that happen within the interval are merged into
+ * one PropertiesChanged signal (per interface).
+ */
+void
+nm_dbus_manager_set_properties_changed_interval(NMDBusManager *self, guint interval_msec)
+{
+    g_return_if_fail(NM_IS_DBUS_MANAGER(self));
+
+    NM_DBUS_MANAGER_GET_PRIVATE(self)->properties_changed_interval_msec = interval_msec;
+}
+
+void
+nm_dbus_manager_get_properties_changed_stats(NMDBusManager *self,
+                                             guint64       *out_emitted,
+                                             guint64       *out_suppressed)
+{
+    NMDBusManagerPrivate *priv;
+
+    g_return_if_fail(NM_IS_DBUS_MANAGER(self));
+
+    priv = NM_DBUS_MANAGER_GET_PRIVATE(self);
+
+    NM_SET_OUT(out_emitted, priv->properties_changed_emitted);
+    NM_SET_OUT(out_suppressed, priv->properties_changed_suppressed);
+}
+
 /*****************************************************************************/
 
 static void
@@ -1520,11 +1837,13 @@ nm_dbus_manager_init(NMDBusManager *self)
 
     c_list_init(&priv->private_servers_lst_head);
     c_list_init(&priv->objects_lst_head);
+    c_list_init(&priv->properties_changed_lst_head);
 
     priv->objects_by_path =
         g_hash_table_new((GHashFunc) _objects_by_path_hash, (GEqualFunc) _objects_by_path_equal);
 
     c_list_init(&priv->caller_info_lst_head);
+    priv->caller_info_by_sender = g_hash_table_new(nm_str_hash, g_str_equal);
 }
 
 static void
@@ -1541,6 +1860,7 @@ dispose(GObject *object)
     nm_assert(c_list_is_empty(&priv->objects_lst_head));
 
     nm_clear_pointer(&priv->objects_by_path, g_hash_table_destroy);
+    nm_clear_pointer(&priv->property_idx_by_interface, g_hash_table_destroy);
 
     c_list_for_each_entry_safe (s, s_safe, &priv->private_servers_lst_head, private_servers_lst)
         private_server_free(s);
@@ -1550,13 +1870,16 @@ dispose(GObject *object)
                                             nm_steal_int(&priv->objmgr_registration_id));
     }
 
+    nm_clear_g_dbus_connection_signal(priv->main_dbus_connection, &priv->name_owner_changed_id);
+
     g_clear_object(&priv->main_dbus_connection);
 
     G_OBJECT_CLASS(nm_dbus_manager_parent_class)->dispose(object);
 
     while ((caller_info =
                 c_list_first_entry(&priv->caller_info_lst_head, CallerInfo, caller_info_lst)))
-        _caller_info_free(caller_info);
+        _caller_info_free(self, caller_info);
+    nm_clear_pointer(&priv->caller_info_by_sender, g_hash_table_destroy);
 }
 
 static void
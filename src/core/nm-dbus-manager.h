@@ -50,6 +50,15 @@ void nm_dbus_manager_stop(NMDBusManager *self);
 
 gboolean nm_dbus_manager_is_stopping(NMDBusManager *self);
 
+gboolean _nm_dbus_manager_set_connection_for_testing(NMDBusManager   *self,
+                                                     GDBusConnection *connection);
+
+void nm_dbus_manager_set_properties_changed_interval(NMDBusManager *self, guint interval_msec);
+
+void nm_dbus_manager_get_properties_changed_stats(NMDBusManager *self,
+                                                  guint64       *out_emitted,
+                                                  guint64       *out_suppressed);
+
 gpointer nm_dbus_manager_lookup_object(NMDBusManager *self, const char *path);
 
 gpointer
@@ -71,7 +71,13 @@ struct _NMDBusObjectInternal {
      * unexported, or even re-exported afterwards. If that happens, we want
      * to fail the request. For that, we keep track of a version id.  */
     guint64 export_version_id;
-    bool    is_unexporting : 1;
+
+    /* pending, rate limited PropertiesChanged signals. Only used by NMDBusManager. */
+    GSource *properties_changed_source;
+    gint64   properties_changed_last_msec;
+    CList    properties_changed_lst;
+
+    bool is_unexporting : 1;
 };
 
 struct _NMDBusObject {
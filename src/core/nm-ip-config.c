@@ -20,13 +20,15 @@ GType nm_ip6_config_get_type(void);
 
 /*****************************************************************************/
 
-#define NM_IP_CONFIG_ADDRESS_DATA "address-data"
-#define NM_IP_CONFIG_DNS_OPTIONS  "dns-options"
-#define NM_IP_CONFIG_DNS_PRIORITY "dns-priority"
-#define NM_IP_CONFIG_DOMAINS      "domains"
-#define NM_IP_CONFIG_GATEWAY      "gateway"
-#define NM_IP_CONFIG_ROUTE_DATA   "route-data"
-#define NM_IP_CONFIG_SEARCHES     "searches"
+#define NM_IP_CONFIG_ADDRESS_DATA      "address-data"
+#define NM_IP_CONFIG_DNS_OPTIONS       "dns-options"
+#define NM_IP_CONFIG_DNS_PRIORITY      "dns-priority"
+#define NM_IP_CONFIG_DOMAINS           "domains"
+#define NM_IP_CONFIG_GATEWAY           "gateway"
+#define NM_IP_CONFIG_ROUTE_COUNT       "route-count"
+#define NM_IP_CONFIG_ROUTE_DATA        "route-data"
+#define NM_IP_CONFIG_ROUTES_GENERATION "routes-generation"
+#define NM_IP_CONFIG_SEARCHES          "searches"
 
 /*****************************************************************************/
 
@@ -38,6 +40,8 @@ NM_GOBJECT_PROPERTIES_DEFINE_FULL(_ip,
                                   PROP_IP_ADDRESS_DATA,
                                   PROP_IP_GATEWAY,
                                   PROP_IP_ROUTE_DATA,
+                                  PROP_IP_ROUTE_COUNT,
+                                  PROP_IP_ROUTES_GENERATION,
                                   PROP_IP_DOMAINS,
                                   PROP_IP_SEARCHES,
                                   PROP_IP_DNS_PRIORITY,
@@ -115,6 +119,12 @@ get_property_ip(GObject *object, guint prop_id, GValue *value, GParamSpec *pspec
     case PROP_IP_ROUTE_DATA:
         g_value_set_variant(value, priv->v_route_data);
         break;
+    case PROP_IP_ROUTE_COUNT:
+        g_value_set_variant(value, g_variant_new_uint32(g_variant_n_children(priv->v_route_data)));
+        break;
+    case PROP_IP_ROUTES_GENERATION:
+        g_value_set_variant(value, g_variant_new_uint64(priv->routes_generation));
+        break;
     case PROP_IP_DOMAINS:
         strv = nm_l3_config_data_get_domains(priv->l3cd, addr_family, &len);
         _value_set_variant_as(value, strv, len);
@@ -160,6 +170,46 @@ set_property(GObject *object, guint prop_id, const GValue *value, GParamSpec *ps
 
 /*****************************************************************************/
 
+static void
+impl_ip_config_get_routes(NMDBusObject                      *obj,
+                          const NMDBusInterfaceInfoExtended *interface_info,
+                          const NMDBusMethodInfoExtended    *method_info,
+                          GDBusConnection                   *connection,
+                          const char                        *sender,
+                          GDBusMethodInvocation             *invocation,
+                          GVariant                          *parameters)
+{
+    NMIPConfig        *self = NM_IP_CONFIG(obj);
+    NMIPConfigPrivate *priv = NM_IP_CONFIG_GET_PRIVATE(self);
+    GVariantBuilder    builder;
+    guint32            offset;
+    guint32            limit;
+    gsize              total;
+    gsize              i;
+
+    g_variant_get(parameters, "(uu)", &offset, &limit);
+
+    total = g_variant_n_children(priv->v_route_data);
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("aa{sv}"));
+    for (i = offset; i < total; i++) {
+        gs_unref_variant GVariant *v_route = NULL;
+
+        if (limit > 0 && i - offset >= limit)
+            break;
+        v_route = g_variant_get_child_value(priv->v_route_data, i);
+        g_variant_builder_add_value(&builder, v_route);
+    }
+
+    g_dbus_method_invocation_return_value(invocation,
+                                          g_variant_new("(tuaa{sv})",
+                                                        priv->routes_generation,
+                                                        (guint32) total,
+                                                        &builder));
+}
+
+/*****************************************************************************/
+
 static void
 nm_ip_config_init(NMIPConfig *self)
 {}
@@ -262,6 +312,20 @@ nm_ip_config_class_init(NMIPConfigClass *klass)
                              G_VARIANT_TYPE("aa{sv}"),
                              NULL,
                              G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties_ip[PROP_IP_ROUTE_COUNT] =
+        g_param_spec_variant(NM_IP_CONFIG_ROUTE_COUNT,
+                             "",
+                             "",
+                             G_VARIANT_TYPE("u"),
+                             NULL,
+                             G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
+    obj_properties_ip[PROP_IP_ROUTES_GENERATION] =
+        g_param_spec_variant(NM_IP_CONFIG_ROUTES_GENERATION,
+                             "",
+                             "",
+                             G_VARIANT_TYPE("t"),
+                             NULL,
+                             G_PARAM_READABLE | G_PARAM_STATIC_STRINGS);
     obj_properties_ip[PROP_IP_DOMAINS] =
         g_param_spec_variant(NM_IP_CONFIG_DOMAINS,
                              "",
@@ -296,6 +360,37 @@ nm_ip_config_class_init(NMIPConfigClass *klass)
 
 /*****************************************************************************/
 
+static const GDBusSignalInfo signal_info_routes_changed = NM_DEFINE_GDBUS_SIGNAL_INFO_INIT(
+    "RoutesChanged",
+    .args = NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("generation", "t"),
+                                      NM_DEFINE_GDBUS_ARG_INFO("added", "aa{sv}"),
+                                      NM_DEFINE_GDBUS_ARG_INFO("removed", "aa{sv}"), ), );
+
+static const NMDBusInterfaceInfoExtended interface_info_ip_config_routes = {
+    .parent = NM_DEFINE_GDBUS_INTERFACE_INFO_INIT(
+        NM_DBUS_INTERFACE_IP_CONFIG_ROUTES,
+        .methods = NM_DEFINE_GDBUS_METHOD_INFOS(NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
+            NM_DEFINE_GDBUS_METHOD_INFO_INIT(
+                "GetRoutes",
+                .in_args  = NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("offset", "u"),
+                                                     NM_DEFINE_GDBUS_ARG_INFO("limit", "u"), ),
+                .out_args = NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("generation", "t"),
+                                                      NM_DEFINE_GDBUS_ARG_INFO("total", "u"),
+                                                      NM_DEFINE_GDBUS_ARG_INFO("routes",
+                                                                               "aa{sv}"), ), ),
+            .handle = impl_ip_config_get_routes, ), ),
+        .signals    = NM_DEFINE_GDBUS_SIGNAL_INFOS(&signal_info_routes_changed, ),
+        .properties = NM_DEFINE_GDBUS_PROPERTY_INFOS(
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("Generation",
+                                                           "t",
+                                                           NM_IP_CONFIG_ROUTES_GENERATION),
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("RouteCount",
+                                                           "u",
+                                                           NM_IP_CONFIG_ROUTE_COUNT), ), ),
+};
+
+/*****************************************************************************/
+
 /* public */
 #define NM_IP4_CONFIG_NAMESERVER_DATA  "nameserver-data"
 #define NM_IP4_CONFIG_WINS_SERVER_DATA "wins-server-data"
@@ -448,7 +543,8 @@ nm_ip4_config_class_init(NMIP4ConfigClass *klass)
     ip_config_class->addr_family = AF_INET;
 
     dbus_object_class->export_path     = NM_DBUS_EXPORT_PATH_NUMBERED(NM_DBUS_PATH "/IP4Config");
-    dbus_object_class->interface_infos = NM_DBUS_INTERFACE_INFOS(&interface_info_ip4_config);
+    dbus_object_class->interface_infos = NM_DBUS_INTERFACE_INFOS(&interface_info_ip4_config,
+                                                                 &interface_info_ip_config_routes);
 
     object_class->get_property = get_property_ip4;
 
@@ -676,7 +772,8 @@ nm_ip6_config_class_init(NMIP6ConfigClass *klass)
     ip_config_class->addr_family = AF_INET6;
 
     dbus_object_class->export_path     = NM_DBUS_EXPORT_PATH_NUMBERED(NM_DBUS_PATH "/IP6Config");
-    dbus_object_class->interface_infos = NM_DBUS_INTERFACE_INFOS(&interface_info_ip6_config);
+    dbus_object_class->interface_infos = NM_DBUS_INTERFACE_INFOS(&interface_info_ip6_config,
+                                                                 &interface_info_ip_config_routes);
 
     object_class->get_property = get_property_ip6;
 
@@ -796,10 +893,12 @@ _handle_platform_change(NMIPConfig *self, guint32 obj_type_flags, gboolean is_in
     const int                    addr_family = nm_ip_config_get_addr_family(self);
     const int                    IS_IPv4     = NM_IS_IPv4(addr_family);
     NMIPConfigPrivate           *priv        = NM_IP_CONFIG_GET_PRIVATE(self);
-    GParamSpec                  *changed_params[5];
+    GParamSpec                  *changed_params[7];
     guint                        n_changed_params           = 0;
     const NMDedupMultiHeadEntry *head_entry_routes          = NULL;
     gboolean                     best_default_route_changed = FALSE;
+    gs_unref_variant GVariant   *v_routes_added             = NULL;
+    gs_unref_variant GVariant   *v_routes_removed           = NULL;
 
     if (NM_FLAGS_ANY(obj_type_flags,
                      (nmp_object_type_to_flags(NMP_OBJECT_TYPE_IP_ADDRESS(IS_IPv4))
@@ -889,6 +988,23 @@ _handle_platform_change(NMIPConfig *self, guint32 obj_type_flags, gboolean is_in
         if (!nm_g_variant_equal(priv->v_route_data, x_route_data)) {
             changed_params[n_changed_params++] = obj_properties_ip[PROP_IP_ROUTE_DATA];
             g_variant_ref_sink(x_route_data);
+            if (!is_init) {
+                /* Routes are compared as multisets: the kernel may have
+                 * several identical entries (e.g. in different tables that
+                 * we don't expose), and the order of RouteData is not
+                 * meaningful. */
+                nm_utils_variant_array_diff(G_VARIANT_TYPE("aa{sv}"),
+                                            priv->v_route_data,
+                                            x_route_data,
+                                            &v_routes_added,
+                                            &v_routes_removed);
+                priv->routes_generation++;
+                changed_params[n_changed_params++] = obj_properties_ip[PROP_IP_ROUTES_GENERATION];
+                if (!priv->v_route_data
+                    || g_variant_n_children(priv->v_route_data)
+                           != g_variant_n_children(x_route_data))
+                    changed_params[n_changed_params++] = obj_properties_ip[PROP_IP_ROUTE_COUNT];
+            }
             NM_SWAP(&priv->v_route_data, &x_route_data);
         }
         if (!nm_g_variant_equal(priv->v_routes, x_routes)) {
@@ -901,4 +1017,13 @@ _handle_platform_change(NMIPConfig *self, guint32 obj_type_flags, gboolean is_in
 
     if (!is_init)
         _notify_all(self, changed_params, n_changed_params);
+
+    if (v_routes_added)
+        nm_dbus_object_emit_signal(NM_DBUS_OBJECT(self),
+                                   &interface_info_ip_config_routes,
+                                   &signal_info_routes_changed,
+                                   "(t@aa{sv}@aa{sv})",
+                                   priv->routes_generation,
+                                   v_routes_added,
+                                   v_routes_removed);
 }
@@ -32,7 +32,8 @@ struct _NMIPConfigPrivate {
     struct {
         const NMPObject *best_default_route;
     } v_gateway;
-    gulong l3cfg_notify_id;
+    guint64 routes_generation;
+    gulong  l3cfg_notify_id;
 };
 
 struct _NMIPConfig {
@@ -159,6 +159,16 @@ typedef struct {
 
     CList devices_lst_head;
 
+    /* Indexes of the devices in devices_lst_head. Within a key, devices are
+     * sorted by their DeviceIdx.seq, which follows the order of the list. */
+    GHashTable    *devices_idx;
+    NMUtilsKeyIdx *devices_by_ifindex;
+    NMUtilsKeyIdx *devices_by_iface;
+    NMUtilsKeyIdx *devices_by_ip_iface;
+    NMUtilsKeyIdx *devices_by_perm_hw_addr;
+    GHashTable    *devices_perm_hw_addr_unknown;
+    guint64        devices_idx_seq;
+
     NMState            state;
     NMConfig          *config;
     NMConnectivity    *concheck_mgr;
@@ -173,6 +183,9 @@ typedef struct {
 
     CList link_cb_lst;
 
+    /* ifindex to interface name of the links that matched main.ignore-devices. */
+    GHashTable *ignored_links;
+
     NMCheckpointManager *checkpoint_mgr;
 
     NMSettings *settings;
@@ -375,6 +388,12 @@ settings_startup_complete_changed(NMSettings *settings, GParamSpec *pspec, NMMan
 
 static void retry_connections_for_parent_device(NMManager *self, NMDevice *device);
 
+static void platform_link_added(NMManager                     *self,
+                                int                            ifindex,
+                                const NMPlatformLink          *plink,
+                                gboolean                       guess_assume,
+                                const NMConfigDeviceStateData *dev_state);
+
 static void
 active_connection_state_changed(NMActiveConnection *active, GParamSpec *pspec, NMManager *self);
 static void
@@ -1200,6 +1219,21 @@ _config_changed_cb(NMConfig           *config,
     if (NM_FLAGS_HAS(changes, NM_CONFIG_CHANGE_GLOBAL_DNS_CONFIG))
         _notify(self, PROP_GLOBAL_DNS_CONFIGURATION);
 
+    if (NM_FLAGS_HAS(changes, NM_CONFIG_CHANGE_IGNORE_DEVICES)) {
+        NMManagerPrivate            *priv  = NM_MANAGER_GET_PRIVATE(self);
+        gs_unref_ptrarray GPtrArray *links = NULL;
+        guint                        i;
+
+        /* Create devices for links that are no longer ignored. Devices
+         * that already exist are kept until their link goes away. */
+        links = nm_platform_link_get_all(priv->platform, FALSE);
+        for (i = 0; links && i < links->len; i++) {
+            const NMPlatformLink *link = NMP_OBJECT_CAST_LINK(links->pdata[i]);
+
+            platform_link_added(self, link->ifindex, link, FALSE, NULL);
+        }
+    }
+
     if (!nm_streq0(nm_config_data_get_connectivity_uri(config_data),
                    nm_config_data_get_connectivity_uri(old_data))) {
         if ((!nm_config_data_get_connectivity_uri(config_data))
@@ -1322,55 +1356,203 @@ nm_manager_get_device_by_path(NMManager *self, const char *path)
     return device;
 }
 
+typedef struct {
+    guint64 seq;
+    int     ifindex;
+    char   *iface;
+    char   *ip_iface;
+    char   *perm_hw_addr;
+} DeviceIdx;
+
+static void
+_device_idx_free(gpointer data)
+{
+    DeviceIdx *idx = data;
+
+    g_free(idx->iface);
+    g_free(idx->ip_iface);
+    g_free(idx->perm_hw_addr);
+    nm_g_slice_free(idx);
+}
+
+static void
+_device_idx_update_str(NMUtilsKeyIdx *key_idx,
+                       char         **p_key,
+                       const char    *key,
+                       NMDevice      *device,
+                       guint64        seq)
+{
+    if (nm_streq0(*p_key, key))
+        return;
+
+    if (*p_key) {
+        nm_utils_key_idx_remove(key_idx, *p_key, device);
+        nm_clear_g_free(p_key);
+    }
+    if (key) {
+        *p_key = g_strdup(key);
+        nm_utils_key_idx_add(key_idx, *p_key, device, seq);
+    }
+}
+
+/* Brings the lookup indexes for @device in sync with its current properties.
+ * With @remove, @device gets dropped from all indexes. */
+static void
+_device_idx_update(NMManager *self, NMDevice *device, gboolean remove)
+{
+    NMManagerPrivate *priv         = NM_MANAGER_GET_PRIVATE(self);
+    gs_free char     *perm_hw_addr = NULL;
+    DeviceIdx        *idx;
+    int               ifindex  = 0;
+    const char       *iface    = NULL;
+    const char       *ip_iface = NULL;
+
+    idx = g_hash_table_lookup(priv->devices_idx, device);
+    if (!idx) {
+        if (remove || c_list_is_empty(&device->devices_lst))
+            return;
+        idx      = g_slice_new0(DeviceIdx);
+        idx->seq = ++priv->devices_idx_seq;
+        g_hash_table_insert(priv->devices_idx, device, idx);
+    }
+
+    if (!remove) {
+        ifindex      = nm_device_get_ifindex(device);
+        iface        = nm_device_get_iface(device);
+        ip_iface     = nm_device_get_ip_iface(device);
+        perm_hw_addr =
+            nm_utils_hwaddr_match_key(nm_device_get_permanent_hw_address_full(device, FALSE, NULL));
+    }
+
+    if (idx->ifindex != ifindex) {
+        if (idx->ifindex > 0)
+            nm_utils_key_idx_remove(priv->devices_by_ifindex,
+                                    GINT_TO_POINTER(idx->ifindex),
+                                    device);
+        idx->ifindex = ifindex;
+        if (ifindex > 0)
+            nm_utils_key_idx_add(priv->devices_by_ifindex,
+                                 GINT_TO_POINTER(ifindex),
+                                 device,
+                                 idx->seq);
+    }
+
+    _device_idx_update_str(priv->devices_by_iface, &idx->iface, iface, device, idx->seq);
+    _device_idx_update_str(priv->devices_by_ip_iface, &idx->ip_iface, ip_iface, device, idx->seq);
+    _device_idx_update_str(priv->devices_by_perm_hw_addr,
+                           &idx->perm_hw_addr,
+                           perm_hw_addr,
+                           device,
+                           idx->seq);
+
+    /* Devices whose permanent MAC address is not yet known are tracked
+     * separately, so that lookups can force only them to read it. */
+    if (!remove && !nm_device_get_permanent_hw_address_full(device, FALSE, NULL))
+        g_hash_table_add(priv->devices_perm_hw_addr_unknown, device);
+    else
+        g_hash_table_remove(priv->devices_perm_hw_addr_unknown, device);
+
+    if (remove)
+        g_hash_table_remove(priv->devices_idx, device);
+}
+
+static guint64
+_device_idx_get_seq(NMManager *self, NMDevice *device)
+{
+    DeviceIdx *idx;
+
+    idx = g_hash_table_lookup(NM_MANAGER_GET_PRIVATE(self)->devices_idx, device);
+    nm_assert(idx);
+    return idx->seq;
+}
+
+static int
+_device_idx_cmp_seq(gconstpointer a, gconstpointer b, gpointer user_data)
+{
+    NMManager *self = user_data;
+
+    NM_CMP_DIRECT(_device_idx_get_seq(self, *((NMDevice **) a)),
+                  _device_idx_get_seq(self, *((NMDevice **) b)));
+    return 0;
+}
+
 NMDevice *
 nm_manager_get_device_by_ifindex(NMManager *self, int ifindex)
 {
-    NMManagerPrivate *priv = NM_MANAGER_GET_PRIVATE(self);
-    NMDevice         *device;
+    NMManagerPrivate         *priv = NM_MANAGER_GET_PRIVATE(self);
+    const NMUtilsKeyIdxEntry *entries;
+    guint                     len;
 
-    if (ifindex > 0) {
-        c_list_for_each_entry (device, &priv->devices_lst_head, devices_lst) {
-            if (nm_device_get_ifindex(device) == ifindex)
-                return device;
-        }
-    }
+    if (ifindex <= 0)
+        return NULL;
 
-    return NULL;
+    entries = nm_utils_key_idx_lookup(priv->devices_by_ifindex, GINT_TO_POINTER(ifindex), &len);
+    return len > 0 ? entries[0].obj : NULL;
 }
 
 static NMDevice *
 find_device_by_permanent_hw_addr(NMManager *self, const char *hwaddr)
 {
-    NMManagerPrivate *priv = NM_MANAGER_GET_PRIVATE(self);
-    NMDevice         *device;
-    const char       *device_addr;
-    guint8            hwaddr_bin[_NM_UTILS_HWADDR_LEN_MAX];
-    gsize             hwaddr_len;
+    NMManagerPrivate         *priv        = NM_MANAGER_GET_PRIVATE(self);
+    gs_free char             *hwaddr_norm = NULL;
+    gs_free NMDevice        **unknown     = NULL;
+    const NMUtilsKeyIdxEntry *entries;
+    NMDevice                 *device      = NULL;
+    guint64                   device_seq  = G_MAXUINT64;
+    guint                     n_unknown;
+    guint                     len;
+    guint                     i;
 
     g_return_val_if_fail(hwaddr != NULL, NULL);
 
-    if (!_nm_utils_hwaddr_aton(hwaddr, hwaddr_bin, sizeof(hwaddr_bin), &hwaddr_len))
+    /* like nm_utils_hwaddr_matches(), InfiniBand addresses only compare
+     * by their last 8 bytes. The index is keyed accordingly. */
+    hwaddr_norm = nm_utils_hwaddr_match_key(hwaddr);
+    if (!hwaddr_norm)
         return NULL;
 
-    c_list_for_each_entry (device, &priv->devices_lst_head, devices_lst) {
-        device_addr = nm_device_get_permanent_hw_address(device);
-        if (device_addr && nm_utils_hwaddr_matches(hwaddr_bin, hwaddr_len, device_addr, -1))
-            return device;
+    entries = nm_utils_key_idx_lookup(priv->devices_by_perm_hw_addr, hwaddr_norm, &len);
+    if (len > 0) {
+        device     = entries[0].obj;
+        device_seq = entries[0].seq;
     }
-    return NULL;
+
+    if (g_hash_table_size(priv->devices_perm_hw_addr_unknown) == 0)
+        return device;
+
+    /* Devices that come before the match might not yet know their permanent
+     * MAC address. Like nm_device_get_permanent_hw_address(), force them
+     * to read it, in the order of the device list. Reading it notifies
+     * the property and updates the indexes. */
+    unknown = (NMDevice **) g_hash_table_get_keys_as_array(priv->devices_perm_hw_addr_unknown,
+                                                           &n_unknown);
+    g_qsort_with_data(unknown, n_unknown, sizeof(NMDevice *), _device_idx_cmp_seq, self);
+
+    for (i = 0; i < n_unknown; i++) {
+        if (_device_idx_get_seq(self, unknown[i]) > device_seq)
+            break;
+        nm_device_get_permanent_hw_address(unknown[i]);
+        _device_idx_update(self, unknown[i], FALSE);
+    }
+
+    entries = nm_utils_key_idx_lookup(priv->devices_by_perm_hw_addr, hwaddr_norm, &len);
+    return len > 0 ? entries[0].obj : NULL;
 }
 
 static NMDevice *
 find_device_by_ip_iface(NMManager *self, const char *iface)
 {
-    NMManagerPrivate *priv = NM_MANAGER_GET_PRIVATE(self);
-    NMDevice         *device;
+    NMManagerPrivate         *priv = NM_MANAGER_GET_PRIVATE(self);
+    const NMUtilsKeyIdxEntry *entries;
+    guint                     len;
+    guint                     i;
 
     g_return_val_if_fail(iface, NULL);
 
-    c_list_for_each_entry (device, &priv->devices_lst_head, devices_lst) {
-        if (nm_device_is_real(device) && nm_streq0(nm_device_get_ip_iface(device), iface))
-            return device;
+    entries = nm_utils_key_idx_lookup(priv->devices_by_ip_iface, iface, &len);
+    for (i = 0; i < len; i++) {
+        if (nm_device_is_real(entries[i].obj))
+            return entries[i].obj;
     }
     return NULL;
 }
@@ -1396,15 +1578,27 @@ find_device_by_iface(NMManager    *self,
                      NMConnection *connection,
                      NMConnection *slave)
 {
-    NMManagerPrivate *priv     = NM_MANAGER_GET_PRIVATE(self);
-    NMDevice         *fallback = NULL;
-    NMDevice         *candidate;
+    NMManagerPrivate         *priv       = NM_MANAGER_GET_PRIVATE(self);
+    gs_free NMDevice        **candidates = NULL;
+    const NMUtilsKeyIdxEntry *entries;
+    NMDevice                 *fallback = NULL;
+    NMDevice                 *candidate;
+    guint                     len;
+    guint                     i;
 
     g_return_val_if_fail(iface != NULL, NULL);
 
-    c_list_for_each_entry (candidate, &priv->devices_lst_head, devices_lst) {
-        if (!nm_streq(nm_device_get_iface(candidate), iface))
-            continue;
+    entries = nm_utils_key_idx_lookup(priv->devices_by_iface, iface, &len);
+    if (len == 0)
+        return NULL;
+
+    /* The compatibility checks below might modify the index. */
+    candidates = g_new(NMDevice *, len);
+    for (i = 0; i < len; i++)
+        candidates[i] = entries[i].obj;
+
+    for (i = 0; i < len; i++) {
+        candidate = candidates[i];
         if (connection && !nm_device_check_connection_compatible(candidate, connection, NULL))
             continue;
         if (slave) {
@@ -1787,6 +1981,7 @@ remove_device(NMManager *self, NMDevice *device, gboolean quitting)
 
     nm_settings_device_removed(priv->settings, device, quitting);
 
+    _device_idx_update(self, device, TRUE);
     c_list_unlink(&device->devices_lst);
 
     _parent_notify_changed(self, device, TRUE);
@@ -2011,16 +2206,18 @@ nm_manager_iface_for_uuid(NMManager *self, const char *uuid)
 NMDevice *
 nm_manager_get_device(NMManager *self, const char *ifname, NMDeviceType device_type)
 {
-    NMManagerPrivate *priv = NM_MANAGER_GET_PRIVATE(self);
-    NMDevice         *device;
+    NMManagerPrivate         *priv = NM_MANAGER_GET_PRIVATE(self);
+    const NMUtilsKeyIdxEntry *entries;
+    guint                     len;
+    guint                     i;
 
     g_return_val_if_fail(ifname, NULL);
     g_return_val_if_fail(device_type != NM_DEVICE_TYPE_UNKNOWN, NULL);
 
-    c_list_for_each_entry (device, &priv->devices_lst_head, devices_lst) {
-        if (nm_device_get_device_type(device) == device_type
-            && nm_streq0(nm_device_get_iface(device), ifname))
-            return device;
+    entries = nm_utils_key_idx_lookup(priv->devices_by_iface, ifname, &len);
+    for (i = 0; i < len; i++) {
+        if (nm_device_get_device_type(entries[i].obj) == device_type)
+            return entries[i].obj;
     }
 
     return NULL;
@@ -3259,25 +3456,35 @@ recheck_assume_connection_cb(NMManager *self, NMDevice *device)
 static void
 device_ifindex_changed(NMDevice *device, GParamSpec *pspec, NMManager *self)
 {
+    _device_idx_update(self, device, FALSE);
     _parent_notify_changed(self, device, FALSE);
 }
 
 static void
 device_ip_iface_changed(NMDevice *device, GParamSpec *pspec, NMManager *self)
 {
-    NMManagerPrivate *priv        = NM_MANAGER_GET_PRIVATE(self);
-    const char       *ip_iface    = nm_device_get_ip_iface(device);
-    NMDeviceType      device_type = nm_device_get_device_type(device);
-    NMDevice         *candidate;
+    NMManagerPrivate         *priv        = NM_MANAGER_GET_PRIVATE(self);
+    const char               *ip_iface    = nm_device_get_ip_iface(device);
+    NMDeviceType              device_type = nm_device_get_device_type(device);
+    const NMUtilsKeyIdxEntry *entries;
+    NMDevice                 *candidate;
+    guint                     len;
+    guint                     i;
+
+    _device_idx_update(self, device, FALSE);
+
+    if (!ip_iface)
+        return;
 
     /* Remove NMDevice objects that are actually child devices of others,
      * when the other device finally knows its IP interface name.  For example,
      * remove the PPP interface that's a child of a WWAN device, since it's
      * not really a standalone NMDevice.
      */
-    c_list_for_each_entry (candidate, &priv->devices_lst_head, devices_lst) {
-        if (candidate != device && nm_streq0(nm_device_get_iface(candidate), ip_iface)
-            && nm_device_get_device_type(candidate) == device_type
+    entries = nm_utils_key_idx_lookup(priv->devices_by_iface, ip_iface, &len);
+    for (i = 0; i < len; i++) {
+        candidate = entries[i].obj;
+        if (candidate != device && nm_device_get_device_type(candidate) == device_type
             && nm_device_is_real(candidate)) {
             remove_device(self, candidate, FALSE);
             break;
@@ -3288,12 +3495,20 @@ device_ip_iface_changed(NMDevice *device, GParamSpec *pspec, NMManager *self)
 static void
 device_iface_changed(NMDevice *device, GParamSpec *pspec, NMManager *self)
 {
+    _device_idx_update(self, device, FALSE);
+
     /* Virtual connections may refer to the new device name as
      * parent device, retry to activate them.
      */
     retry_connections_for_parent_device(self, device);
 }
 
+static void
+device_perm_hw_addr_changed(NMDevice *device, GParamSpec *pspec, NMManager *self)
+{
+    _device_idx_update(self, device, FALSE);
+}
+
 static void
 _emit_device_added_removed(NMManager *self, NMDevice *device, gboolean is_added)
 {
@@ -3480,6 +3695,7 @@ add_device(NMManager *self, NMDevice *device, GError **error)
 
     nm_assert(c_list_is_empty(&device->devices_lst));
     c_list_link_tail(&priv->devices_lst_head, &device->devices_lst);
+    _device_idx_update(self, device, FALSE);
 
     g_signal_connect(device,
                      NM_DEVICE_STATE_CHANGED,
@@ -3507,6 +3723,11 @@ add_device(NMManager *self, NMDevice *device, GError **error)
 
     g_signal_connect(device, "notify::" NM_DEVICE_IFACE, G_CALLBACK(device_iface_changed), self);
 
+    g_signal_connect(device,
+                     "notify::" NM_DEVICE_PERM_HW_ADDRESS,
+                     G_CALLBACK(device_perm_hw_addr_changed),
+                     self);
+
     g_signal_connect(device, "notify::" NM_DEVICE_REAL, G_CALLBACK(device_realized), self);
 
     g_signal_connect(device,
@@ -3615,21 +3836,40 @@ platform_link_added(NMManager                     *self,
                     gboolean                       guess_assume,
                     const NMConfigDeviceStateData *dev_state)
 {
-    NMManagerPrivate *priv = NM_MANAGER_GET_PRIVATE(self);
-    NMDeviceFactory  *factory;
-    NMDevice         *device = NULL;
-    NMDevice         *candidate;
+    NMManagerPrivate         *priv       = NM_MANAGER_GET_PRIVATE(self);
+    gs_free NMDevice        **candidates = NULL;
+    const NMUtilsKeyIdxEntry *entries;
+    NMDeviceFactory          *factory;
+    NMDevice                 *device = NULL;
+    NMDevice                 *candidate;
+    guint                     len;
+    guint                     i;
 
     g_return_if_fail(ifindex > 0);
 
+    /* added back below, if the link is still ignored. */
+    g_hash_table_remove(priv->ignored_links, GINT_TO_POINTER(ifindex));
+
     if (nm_manager_get_device_by_ifindex(self, ifindex))
         return;
 
+    entries = nm_utils_key_idx_lookup(priv->devices_by_iface, plink->name, &len);
+    if (len > 0) {
+        candidates = g_new(NMDevice *, len);
+        for (i = 0; i < len; i++)
+            candidates[i] = g_object_ref(entries[i].obj);
+    }
+
     /* Let unrealized devices try to realize themselves with the link */
-    c_list_for_each_entry (candidate, &priv->devices_lst_head, devices_lst) {
+    for (i = 0; i < len; i++) {
         gboolean              compatible = TRUE;
         gs_free_error GError *error      = NULL;
 
+        candidate = candidates[i];
+
+        if (c_list_is_empty(&candidate->devices_lst))
+            continue;
+
         if (nm_device_get_link_type(candidate) != plink->type)
             continue;
 
@@ -3656,7 +3896,7 @@ platform_link_added(NMManager                     *self,
                 remove_device(self, candidate, FALSE);
                 goto add;
             }
-            return;
+            goto out;
         } else if (nm_device_realize_start(candidate,
                                            plink,
                                            FALSE, /* assume_state_guess_assume */
@@ -3666,7 +3906,7 @@ platform_link_added(NMManager                     *self,
                                            &compatible,
                                            &error)) {
             _device_realize_finish(self, candidate, plink);
-            return;
+            goto out;
         }
 
         _LOGD(LOGD_DEVICE, "(%s): failed to realize from plink: '%s'", plink->name, error->message);
@@ -3675,6 +3915,16 @@ platform_link_added(NMManager                     *self,
     }
 
 add:
+    /* Links matching main.ignore-devices are only tracked in the platform
+     * cache. No NMDevice is created for them, so they are neither exported on
+     * D-Bus nor matched against settings. */
+    if (nm_utils_ignored_links_check(priv->ignored_links,
+                                     nm_config_data_get_ignore_devices_matcher(NM_CONFIG_GET_DATA),
+                                     plink)) {
+        _LOGT(LOGD_DEVICE, "(%s): ignoring link %d by configuration", plink->name, ifindex);
+        goto out;
+    }
+
     /* Try registered device factories */
     factory = nm_device_factory_manager_find_factory_for_link_type(plink->type);
     if (factory) {
@@ -3695,7 +3945,7 @@ add:
                       plink->name,
                       error->message);
             }
-            return;
+            goto out;
         }
     }
 
@@ -3753,6 +4003,12 @@ add:
         }
         g_object_unref(device);
     }
+
+out:
+    if (candidates) {
+        for (i = 0; i < len; i++)
+            g_object_unref(candidates[i]);
+    }
 }
 
 typedef struct {
@@ -3822,6 +4078,8 @@ _platform_link_cb_idle(PlatformLinkCbData *data)
         NMDevice *device;
         GError   *error = NULL;
 
+        g_hash_table_remove(priv->ignored_links, GINT_TO_POINTER(ifindex));
+
         device = nm_manager_get_device_by_ifindex(self, ifindex);
         if (device) {
             if (nm_device_is_software(device)) {
@@ -3859,21 +4117,29 @@ platform_link_cb(NMPlatform     *platform,
     const NMPlatformSignalChangeType change_type = change_type_i;
     PlatformLinkCbData              *data;
 
+    self = NM_MANAGER(user_data);
+    priv = NM_MANAGER_GET_PRIVATE(self);
+
     switch (change_type) {
     case NM_PLATFORM_SIGNAL_ADDED:
     case NM_PLATFORM_SIGNAL_REMOVED:
-        self = NM_MANAGER(user_data);
-        priv = NM_MANAGER_GET_PRIVATE(self);
-
-        data          = g_slice_new(PlatformLinkCbData);
-        data->self    = self;
-        data->ifindex = ifindex;
-        c_list_link_tail(&priv->link_cb_lst, &data->lst);
-        data->idle_id = g_idle_add((GSourceFunc) _platform_link_cb_idle, data);
         break;
+    case NM_PLATFORM_SIGNAL_CHANGED:
+        /* An ignored link that gets renamed (for example by udev right after
+         * it was created) might no longer match main.ignore-devices. Handle
+         * it like a new link, which creates the device if necessary. */
+        if (nm_utils_ignored_links_renamed(priv->ignored_links, plink))
+            break;
+        return;
     default:
-        break;
+        return;
     }
+
+    data          = g_slice_new(PlatformLinkCbData);
+    data->self    = self;
+    data->ifindex = ifindex;
+    c_list_link_tail(&priv->link_cb_lst, &data->lst);
+    data->idle_id = g_idle_add((GSourceFunc) _platform_link_cb_idle, data);
 }
 
 static void
@@ -7925,6 +8191,15 @@ nm_manager_emit_device_ifindex_changed(NMManager *self, NMDevice *device)
     g_signal_emit(self, signals[DEVICE_IFINDEX_CHANGED], 0, device);
 }
 
+/* The IP interface name of a device is not always exposed via the
+ * NM_DEVICE_IP_IFACE property, so the device notifies the manager
+ * directly to keep the index up to date. */
+void
+nm_manager_device_ip_iface_updated(NMManager *self, NMDevice *device)
+{
+    _device_idx_update(self, device, FALSE);
+}
+
 /*****************************************************************************/
 
 NM_DEFINE_SINGLETON_REGISTER(NMManager);
@@ -8070,6 +8345,16 @@ nm_manager_init(NMManager *self)
 
     priv->capabilities = g_array_new(FALSE, FALSE, sizeof(guint32));
 
+    priv->devices_idx = g_hash_table_new_full(nm_direct_hash, NULL, NULL, _device_idx_free);
+
+    priv->devices_by_ifindex           = nm_utils_key_idx_new_int();
+    priv->devices_by_iface             = nm_utils_key_idx_new_str();
+    priv->devices_by_ip_iface          = nm_utils_key_idx_new_str();
+    priv->devices_by_perm_hw_addr      = nm_utils_key_idx_new_str();
+    priv->devices_perm_hw_addr_unknown = g_hash_table_new(nm_direct_hash, NULL);
+
+    priv->ignored_links = g_hash_table_new_full(nm_direct_hash, NULL, NULL, g_free);
+
     priv->radio_states[NM_RFKILL_TYPE_WLAN] = (RfkillRadioState){
         .user_enabled = TRUE,
         .sw_enabled   = FALSE,
@@ -8427,6 +8712,15 @@ finalize(GObject *object)
 
     g_array_free(priv->capabilities, TRUE);
 
+    nm_assert(g_hash_table_size(priv->devices_idx) == 0);
+    g_hash_table_unref(priv->devices_idx);
+    nm_utils_key_idx_free(priv->devices_by_ifindex);
+    nm_utils_key_idx_free(priv->devices_by_iface);
+    nm_utils_key_idx_free(priv->devices_by_ip_iface);
+    nm_utils_key_idx_free(priv->devices_by_perm_hw_addr);
+    g_hash_table_unref(priv->devices_perm_hw_addr_unknown);
+    g_hash_table_unref(priv->ignored_links);
+
     G_OBJECT_CLASS(nm_manager_parent_class)->finalize(object);
 
     g_object_unref(priv->platform);
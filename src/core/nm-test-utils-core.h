@@ -345,4 +345,70 @@ nmtst_ip6_config_new(int ifindex)
 
 #endif
 
+/*****************************************************************************/
+
+#include <sys/socket.h>
+
+static inline void
+_nmtst_dbus_peer_connection_new_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    GDBusConnection     **p_connection = user_data;
+    gs_free_error GError *error        = NULL;
+
+    *p_connection = g_dbus_connection_new_finish(result, &error);
+    g_assert_no_error(error);
+    g_assert(G_IS_DBUS_CONNECTION(*p_connection));
+}
+
+/* Creates two GDBusConnections that talk to each other over a socketpair,
+ * without a bus daemon. The server side plays NetworkManager, the client
+ * side the peer (a client, or a service like polkit). */
+static inline void
+nmtst_dbus_peer_connections_new(GDBusConnection **out_server, GDBusConnection **out_client)
+{
+    gs_unref_object GSocketConnection *stream_server = NULL;
+    gs_unref_object GSocketConnection *stream_client = NULL;
+    gs_unref_object GSocket           *socket_server = NULL;
+    gs_unref_object GSocket           *socket_client = NULL;
+    gs_free_error GError              *error         = NULL;
+    gs_free char                      *guid          = NULL;
+    GDBusConnection                   *server        = NULL;
+    GDBusConnection                   *client;
+    int                                fds[2];
+
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+        g_assert_not_reached();
+
+    socket_server = g_socket_new_from_fd(fds[0], &error);
+    g_assert_no_error(error);
+    socket_client = g_socket_new_from_fd(fds[1], &error);
+    g_assert_no_error(error);
+
+    stream_server = g_socket_connection_factory_create_connection(socket_server);
+    stream_client = g_socket_connection_factory_create_connection(socket_client);
+
+    /* The server side authenticates in a worker thread, while we block on the
+     * client side. */
+    guid = g_dbus_generate_guid();
+    g_dbus_connection_new(G_IO_STREAM(stream_server),
+                          guid,
+                          G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_SERVER,
+                          NULL,
+                          NULL,
+                          _nmtst_dbus_peer_connection_new_cb,
+                          &server);
+    client = g_dbus_connection_new_sync(G_IO_STREAM(stream_client),
+                                        NULL,
+                                        G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT,
+                                        NULL,
+                                        NULL,
+                                        &error);
+    g_assert_no_error(error);
+
+    nmtst_main_context_iterate_until_assert(NULL, 5000, server);
+
+    *out_server = server;
+    *out_client = client;
+}
+
 #endif /* __NM_TEST_UTILS_CORE_H__ */
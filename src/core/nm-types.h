@@ -47,6 +47,8 @@ struct _NMDedupMultiIndex;
 
 typedef struct _NMRefString NMRefString;
 
+typedef struct _NMMatchSpecDeviceMatcher NMMatchSpecDeviceMatcher;
+
 /*****************************************************************************/
 
 typedef enum {
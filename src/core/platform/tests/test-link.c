@@ -3260,6 +3260,77 @@ test_netns_bind_to_path(gpointer fixture, gconstpointer test_data)
 
 /*****************************************************************************/
 
+static void
+_assert_link_stats_dump(NMPlatform *platform, guint n_links)
+{
+    gs_unref_array GArray       *stats_arr = NULL;
+    const NMDedupMultiHeadEntry *head_entry;
+    NMDedupMultiIter             iter;
+    const NMPObject             *obj;
+    guint                        i;
+
+    stats_arr = nm_platform_link_stats_dump(platform);
+    if (!stats_arr) {
+        /* RTM_GETSTATS is not supported by the kernel. */
+        return;
+    }
+
+    /* the dump must be of the platform's netns, not of the current one. */
+    head_entry = nm_platform_lookup_obj_type(platform, NMP_OBJECT_TYPE_LINK);
+    g_assert(head_entry);
+    g_assert_cmpint(head_entry->len, ==, n_links);
+    g_assert_cmpint(stats_arr->len, ==, n_links);
+
+    for (i = 1; i < stats_arr->len; i++) {
+        g_assert_cmpint(g_array_index(stats_arr, NMPlatformLinkStats, i - 1).ifindex,
+                        <,
+                        g_array_index(stats_arr, NMPlatformLinkStats, i).ifindex);
+    }
+
+    nmp_cache_iter_for_each (&iter, head_entry, &obj) {
+        const NMPlatformLinkStats needle = {.ifindex = obj->link.ifindex};
+
+        g_assert(bsearch(&needle,
+                         stats_arr->data,
+                         stats_arr->len,
+                         sizeof(NMPlatformLinkStats),
+                         nm_platform_link_stats_cmp_ifindex));
+    }
+}
+
+static void
+test_netns_link_stats_dump(gpointer fixture, gconstpointer test_data)
+{
+    gs_unref_object NMPlatform *platform_1 = NULL;
+    gs_unref_object NMPlatform *platform_2 = NULL;
+    char                        sbuf[100];
+    guint                       n_dummies;
+    guint                       i;
+
+    if (_test_netns_check_skip())
+        return;
+
+    platform_1 = _test_netns_create_platform();
+    platform_2 = _test_netns_create_platform();
+
+    /* the netns have a different number of links besides "lo". */
+    _ADD_DUMMY(platform_1, "dummy1_");
+    n_dummies = 2 + nmtst_get_rand_uint32() % 5;
+    for (i = 0; i < n_dummies; i++)
+        _ADD_DUMMY(platform_2, nm_sprintf_buf(sbuf, "dummy2_%02u", i));
+
+    /* dump while being in the initial netns, in random order. */
+    if (nmtst_get_rand_bool()) {
+        _assert_link_stats_dump(platform_1, 2);
+        _assert_link_stats_dump(platform_2, 1 + n_dummies);
+    } else {
+        _assert_link_stats_dump(platform_2, 1 + n_dummies);
+        _assert_link_stats_dump(platform_1, 2);
+    }
+}
+
+/*****************************************************************************/
+
 static void
 test_sysctl_rename(void)
 {
@@ -3869,6 +3940,13 @@ _nmtstp_setup_tests(void)
                           test_netns_bind_to_path,
                           _test_netns_teardown);
 
+        g_test_add_vtable("/general/netns/link-stats-dump",
+                          0,
+                          NULL,
+                          _test_netns_setup,
+                          test_netns_link_stats_dump,
+                          _test_netns_teardown);
+
         g_test_add_func("/general/netns/mt", test_netns_mt);
 
         g_test_add_func("/general/sysctl/rename", test_sysctl_rename);
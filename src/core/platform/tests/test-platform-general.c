@@ -9,6 +9,9 @@
 
 #include "libnm-platform/nm-platform-utils.h"
 #include "libnm-platform/nm-linux-platform.h"
+#include "libnm-platform/nm-platform-private.h"
+#include "libnm-platform/nm-netlink.h"
+#include "libnm-std-aux/nm-linux-compat.h"
 
 #include "nm-test-utils-core.h"
 
@@ -846,6 +849,226 @@ test_nmp_genl_family_type_from_name(void)
 
 /*****************************************************************************/
 
+static void
+_ethtool_cache_add_ring(NMPlatform *platform, int ifindex, guint32 rx_pending)
+{
+    const NMEthtoolRingState ring = {.rx_pending = rx_pending};
+    gs_free gpointer         data = NULL;
+    guint                    gen;
+
+    data = _nm_platform_ethtool_cache_lookup_for_testing(platform,
+                                                         ifindex,
+                                                         NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                                         &gen);
+    g_assert(!data);
+    _nm_platform_ethtool_cache_add_for_testing(platform,
+                                               ifindex,
+                                               NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                               &ring,
+                                               gen);
+}
+
+static void
+_ethtool_cache_add_pause(NMPlatform *platform, int ifindex, bool autoneg)
+{
+    const NMEthtoolPauseState pause = {.autoneg = autoneg};
+    gs_free gpointer          data  = NULL;
+    guint                     gen;
+
+    data = _nm_platform_ethtool_cache_lookup_for_testing(platform,
+                                                         ifindex,
+                                                         NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE,
+                                                         &gen);
+    g_assert(!data);
+    _nm_platform_ethtool_cache_add_for_testing(platform,
+                                               ifindex,
+                                               NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE,
+                                               &pause,
+                                               gen);
+}
+
+static gboolean
+_ethtool_cache_has(NMPlatform *platform, int ifindex, NMPlatformEthtoolCacheType type)
+{
+    gs_free gpointer data = NULL;
+    guint            gen;
+
+    data = _nm_platform_ethtool_cache_lookup_for_testing(platform, ifindex, type, &gen);
+    return !!data;
+}
+
+static void
+_ethtool_cache_notify(NMPlatform *platform, guint8 cmd, int ifindex)
+{
+    nm_auto_nlmsg struct nl_msg *msg = NULL;
+    struct nlattr               *nest;
+
+    msg = nlmsg_alloc();
+    if (!genlmsg_put(msg, 0, 0, 0x42, 0, 0, cmd, ETHTOOL_GENL_VERSION))
+        goto nla_put_failure;
+    nest = nla_nest_start(msg, ETHTOOL_A_FEATURES_HEADER);
+    if (!nest)
+        goto nla_put_failure;
+    NLA_PUT_U32(msg, ETHTOOL_A_HEADER_DEV_INDEX, ifindex);
+    NLA_NEST_END(msg, nest);
+
+    _nm_linux_platform_genl_handle_ethtool_msg_for_testing(platform, nlmsg_hdr(msg));
+    return;
+
+nla_put_failure:
+    g_assert_not_reached();
+}
+
+static void
+test_ethtool_cache_notify(void)
+{
+    gs_unref_object NMPlatform *platform = NULL;
+
+    platform = nm_linux_platform_new(TRUE, NM_PLATFORM_NETNS_SUPPORT_DEFAULT, TRUE);
+    nm_platform_ethtool_cache_set_enabled(platform, TRUE);
+
+    _ethtool_cache_add_ring(platform, 100, 512);
+    _ethtool_cache_add_pause(platform, 100, TRUE);
+    _ethtool_cache_add_ring(platform, 101, 1024);
+
+    /* A notification only drops the type it is about, for its link. */
+    _ethtool_cache_notify(platform, ETHTOOL_MSG_RINGS_NTF, 100);
+    g_assert(!_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+    g_assert(_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE));
+    g_assert(_ethtool_cache_has(platform, 101, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+
+    /* Other ethtool messages don't invalidate anything. */
+    _ethtool_cache_notify(platform, ETHTOOL_MSG_LINKINFO_NTF, 100);
+    g_assert(_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE));
+
+    _ethtool_cache_notify(platform, ETHTOOL_MSG_PAUSE_NTF, 100);
+    g_assert(!_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE));
+    g_assert(_ethtool_cache_has(platform, 101, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+
+    /* After an overflow of the socket, nothing can be trusted. */
+    _ethtool_cache_add_pause(platform, 100, FALSE);
+    nm_platform_ethtool_cache_flush(platform);
+    g_assert(!_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE));
+    g_assert(!_ethtool_cache_has(platform, 101, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+}
+
+static void
+test_ethtool_cache_generation(void)
+{
+    gs_unref_object NMPlatform *platform = NULL;
+    gs_free NMEthtoolRingState *cached   = NULL;
+    const NMEthtoolRingState    ring     = {.rx_pending = 256};
+    guint                       gen;
+
+    platform = nm_linux_platform_new(TRUE, NM_PLATFORM_NETNS_SUPPORT_DEFAULT, TRUE);
+    nm_platform_ethtool_cache_set_enabled(platform, TRUE);
+
+    /* A value read from kernel while an invalidation came in might be outdated
+     * and is not cached. Even if the invalidation was for another link or type. */
+    g_assert(!_nm_platform_ethtool_cache_lookup_for_testing(platform,
+                                                            100,
+                                                            NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                                            &gen));
+    nm_platform_ethtool_cache_invalidate(platform, 101, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE);
+    _nm_platform_ethtool_cache_add_for_testing(platform,
+                                               100,
+                                               NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                               &ring,
+                                               gen);
+    g_assert(!_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+
+    /* the same for a flush. */
+    g_assert(!_nm_platform_ethtool_cache_lookup_for_testing(platform,
+                                                            100,
+                                                            NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                                            &gen));
+    nm_platform_ethtool_cache_flush(platform);
+    _nm_platform_ethtool_cache_add_for_testing(platform,
+                                               100,
+                                               NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                               &ring,
+                                               gen);
+    g_assert(!_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+
+    /* without interference, the value is cached. And returned as a copy. */
+    _ethtool_cache_add_ring(platform, 100, 256);
+    cached = _nm_platform_ethtool_cache_lookup_for_testing(platform,
+                                                           100,
+                                                           NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                                           &gen);
+    g_assert(cached);
+    g_assert(cached != &ring);
+    g_assert_cmpint(cached->rx_pending, ==, 256);
+
+    /* a disabled cache caches nothing. */
+    nm_platform_ethtool_cache_set_enabled(platform, FALSE);
+    g_assert(!_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+    _nm_platform_ethtool_cache_add_for_testing(platform,
+                                               100,
+                                               NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+                                               &ring,
+                                               gen);
+    g_assert(!_ethtool_cache_has(platform, 100, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING));
+}
+
+static void
+test_ethtool_features_dup(void)
+{
+    gs_free NMEthtoolFeatureStates *features = NULL;
+    gs_free NMEthtoolFeatureStates *copy     = NULL;
+    gs_unref_array GArray          *offsets  = NULL;
+    guint                           n_states;
+    guint                           i_id;
+    guint                           i;
+    guint                           k;
+
+    /* the loopback device has offload features in every netns. */
+    features = nmp_utils_ethtool_get_features(1);
+    if (!features) {
+        g_test_skip("cannot read the ethtool features of the loopback device");
+        return;
+    }
+
+    copy = nmp_utils_ethtool_features_dup(features);
+    g_assert(copy);
+    g_assert(copy != features);
+    g_assert_cmpint(copy->n_states, ==, features->n_states);
+    g_assert_cmpint(copy->n_ss_features, ==, features->n_ss_features);
+
+    /* remember where the original pointers point to, then drop the original.
+     * The copy must not refer to it. */
+    n_states = features->n_states;
+    offsets  = g_array_new(FALSE, FALSE, sizeof(gssize));
+    for (i_id = 0; i_id < _NM_ETHTOOL_ID_FEATURE_NUM; i_id++) {
+        const NMEthtoolFeatureState *const *plist = features->states_indexed[i_id];
+
+        for (i = 0; plist && plist[i]; i++) {
+            gssize offset = plist[i] - features->states_list;
+
+            g_array_append_val(offsets, offset);
+        }
+    }
+    nm_clear_g_free(&features);
+
+    k = 0;
+    for (i_id = 0; i_id < _NM_ETHTOOL_ID_FEATURE_NUM; i_id++) {
+        const NMEthtoolFeatureState *const *plist = copy->states_indexed[i_id];
+
+        for (i = 0; plist && plist[i]; i++) {
+            const NMEthtoolFeatureState *state = plist[i];
+
+            g_assert_cmpint(k, <, offsets->len);
+            g_assert(state >= &copy->states_list[0] && state < &copy->states_list[n_states]);
+            g_assert_cmpint(state - copy->states_list, ==, g_array_index(offsets, gssize, k));
+            g_assert_cmpint(state->info->ethtool_id, ==, _NM_ETHTOOL_ID_FEATURE_FIRST + i_id);
+            k++;
+        }
+    }
+    g_assert_cmpint(k, ==, offsets->len);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -868,6 +1091,9 @@ main(int argc, char **argv)
     g_test_add_func("/general/test_route_type_is_nodev", test_route_type_is_nodev);
     g_test_add_func("/nm-platform/test_nmp_genl_family_type_from_name",
                     test_nmp_genl_family_type_from_name);
+    g_test_add_func("/nm-platform/ethtool-cache/notify", test_ethtool_cache_notify);
+    g_test_add_func("/nm-platform/ethtool-cache/generation", test_ethtool_cache_generation);
+    g_test_add_func("/nm-platform/ethtool-features-dup", test_ethtool_features_dup);
 
     return g_test_run();
 }
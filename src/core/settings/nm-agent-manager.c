@@ -15,6 +15,7 @@
 #include "nm-auth-utils.h"
 #include "nm-setting-vpn.h"
 #include "nm-auth-manager.h"
+#include "nm-config.h"
 #include "nm-dbus-manager.h"
 #include "nm-session-monitor.h"
 #include "nm-simple-connection.h"
@@ -136,6 +137,11 @@ static void _con_del_request_start(Request *req);
 
 static gboolean _con_get_try_complete_early(Request *req);
 
+static gboolean _con_get_parallel_enabled(void);
+static void     _con_get_parallel_start(Request *req);
+static void     _con_get_parallel_call_start(Request *req, NMSecretAgent *agent);
+static void     _con_get_parallel_check_done(Request *req);
+
 static void agent_disconnected_cb(NMSecretAgent *agent, gpointer user_data);
 
 /*****************************************************************************/
@@ -188,12 +194,19 @@ struct _NMAgentManagerCallId {
     /* Current agent being asked for secrets */
     NMSecretAgent       *current;
     NMSecretAgentCallId *current_call_id;
+    gint64               current_start_msec;
 
     /* Stores the sorted list of NMSecretAgents which will be asked for secrets */
     GSList *pending;
 
+    /* In parallel mode, the list of ParallelCall for the agents that are
+     * asked concurrently. @current is unused then. */
+    CList parallel_lst_head;
+
     guint idle_id;
 
+    bool parallel : 1;
+
     union {
         struct {
             char         *path;
@@ -222,6 +235,16 @@ struct _NMAgentManagerCallId {
     };
 };
 
+typedef struct {
+    CList                parallel_lst;
+    Request             *req;
+    NMSecretAgent       *agent;
+    NMSecretAgentCallId *call_id;
+    NMAuthChain         *chain;
+    gint64               start_msec;
+    bool                 has_modify : 1;
+} ParallelCall;
+
 /*****************************************************************************/
 
 static NMSecretAgent *
@@ -264,6 +287,16 @@ _agent_remove(NMAgentManager *self, NMSecretAgent *agent)
 
     _LOGD(agent, "agent unregistered or disappeared");
 
+    if (agent->stats.n_calls > 0) {
+        _LOGD(agent,
+              "agent answered %" G_GUINT64_FORMAT " of %" G_GUINT64_FORMAT
+              " secrets requests (average latency %" G_GUINT64_FORMAT " msec, max %u msec)",
+              agent->stats.n_succeeded,
+              agent->stats.n_calls,
+              agent->stats.latency_sum_msec / agent->stats.n_calls,
+              (guint) agent->stats.latency_max_msec);
+    }
+
     nm_clear_pointer(&agent->auth_chain, nm_auth_chain_destroy);
 
     c_list_unlink(&agent->agent_lst);
@@ -290,6 +323,32 @@ maybe_remove_agent_on_error(NMAgentManager *self, NMSecretAgent *agent, GError *
         _agent_remove(self, agent);
 }
 
+static void
+_agent_stats_record(NMAgentManager *self,
+                    NMSecretAgent  *agent,
+                    gint64          start_msec,
+                    gboolean        succeeded)
+{
+    gint64 latency;
+
+    latency = nm_utils_get_monotonic_timestamp_msec() - start_msec;
+    latency = CLAMP(latency, 0, (gint64) G_MAXUINT32);
+
+    agent->stats.n_calls++;
+    if (succeeded)
+        agent->stats.n_succeeded++;
+    agent->stats.latency_sum_msec += latency;
+    agent->stats.latency_max_msec = MAX(agent->stats.latency_max_msec, (guint32) latency);
+
+    _LOGD(agent,
+          "secrets request %s after %" G_GINT64_FORMAT " msec (average %" G_GUINT64_FORMAT
+          " msec, max %u msec)",
+          succeeded ? "answered" : "failed",
+          latency,
+          agent->stats.latency_sum_msec / agent->stats.n_calls,
+          (guint) agent->stats.latency_max_msec);
+}
+
 /*****************************************************************************/
 
 static gboolean
@@ -348,6 +407,24 @@ validate_identifier(const char *identifier, GError **error)
     return TRUE;
 }
 
+static void
+_agent_registered(NMAgentManager *self, NMSecretAgent *agent)
+{
+    NMAgentManagerPrivate *priv = NM_AGENT_MANAGER_GET_PRIVATE(self);
+    Request               *request;
+
+    _LOGI(agent, "agent registered");
+
+    agent->fully_registered = TRUE;
+
+    priv->agent_version_id += 1;
+
+    c_list_for_each_entry (request, &priv->request_lst_head, request_lst)
+        request_add_agent(request, agent);
+
+    g_signal_emit(self, signals[AGENT_REGISTERED], 0, agent);
+}
+
 static void
 _agent_permissions_check_done(NMAuthChain           *chain,
                               GDBusMethodInvocation *context,
@@ -356,7 +433,6 @@ _agent_permissions_check_done(NMAuthChain           *chain,
     NMAgentManager        *self = NM_AGENT_MANAGER(user_data);
     NMAgentManagerPrivate *priv = NM_AGENT_MANAGER_GET_PRIVATE(self);
     NMSecretAgent         *agent;
-    Request               *request;
 
     nm_assert(!context || G_IS_DBUS_METHOD_INVOCATION(context));
 
@@ -385,18 +461,9 @@ _agent_permissions_check_done(NMAuthChain           *chain,
         return;
     }
 
-    _LOGI(agent, "agent registered");
-
-    agent->fully_registered = TRUE;
-
-    priv->agent_version_id += 1;
-
     g_dbus_method_invocation_return_value(context, NULL);
 
-    c_list_for_each_entry (request, &priv->request_lst_head, request_lst)
-        request_add_agent(request, agent);
-
-    g_signal_emit(self, signals[AGENT_REGISTERED], 0, agent);
+    _agent_registered(self, agent);
 }
 
 static NMAuthChain *
@@ -483,6 +550,32 @@ agent_manager_register_with_capabilities(NMAgentManager        *self,
     _agent_create_auth_chain(self, agent, context);
 }
 
+/**
+ * _nm_agent_manager_add_agent_for_testing:
+ * @self: the #NMAgentManager
+ * @agent: the agent to add
+ *
+ * Registers @agent like a successful RegisterWithCapabilities() call, but
+ * without checking the agent's permissions. Only for unit tests.
+ */
+void
+_nm_agent_manager_add_agent_for_testing(NMAgentManager *self, NMSecretAgent *agent)
+{
+    NMAgentManagerPrivate *priv;
+
+    g_return_if_fail(NM_IS_AGENT_MANAGER(self));
+    g_return_if_fail(NM_IS_SECRET_AGENT(agent));
+    g_return_if_fail(c_list_is_empty(&agent->agent_lst));
+
+    priv = NM_AGENT_MANAGER_GET_PRIVATE(self);
+
+    g_object_ref(agent);
+    g_signal_connect(agent, NM_SECRET_AGENT_DISCONNECTED, G_CALLBACK(agent_disconnected_cb), self);
+    c_list_link_tail(&priv->agent_lst_head, &agent->agent_lst);
+
+    _agent_registered(self, agent);
+}
+
 static void
 impl_agent_manager_register(NMDBusObject                      *obj,
                             const NMDBusInterfaceInfoExtended *interface_info,
@@ -559,13 +652,31 @@ request_new(NMAgentManager *self,
     req->request_type = request_type;
     req->detail       = g_strdup(detail);
     req->subject      = g_object_ref(subject);
+    c_list_init(&req->parallel_lst_head);
     c_list_link_tail(&NM_AGENT_MANAGER_GET_PRIVATE(self)->request_lst_head, &req->request_lst);
     return req;
 }
 
+static void
+_parallel_call_free(ParallelCall *pcall)
+{
+    c_list_unlink_stale(&pcall->parallel_lst);
+    nm_clear_pointer(&pcall->chain, nm_auth_chain_destroy);
+
+    /* cancelling invokes the done-callback synchronously, which ignores
+     * the cancellation. */
+    nm_secret_agent_cancel_call(pcall->agent, pcall->call_id);
+
+    g_object_unref(pcall->agent);
+    nm_g_slice_free(pcall);
+}
+
 static void
 request_free(Request *req)
 {
+    ParallelCall *pcall;
+    ParallelCall *pcall_safe;
+
     switch (req->request_type) {
     case REQUEST_TYPE_CON_GET:
     case REQUEST_TYPE_CON_SAVE:
@@ -592,6 +703,9 @@ request_free(Request *req)
      * Hence, we can proceed to free @req... */
     nm_secret_agent_cancel_call(req->current, req->current_call_id);
 
+    c_list_for_each_entry_safe (pcall, pcall_safe, &req->parallel_lst_head, parallel_lst)
+        _parallel_call_free(pcall);
+
     g_object_unref(req->subject);
 
     g_free(req->detail);
@@ -765,6 +879,13 @@ request_add_agent(Request *req, NMSecretAgent *agent)
 
     _LOGD(agent, "agent allowed for secrets request " LOG_REQ_FMT, LOG_REQ_ARG(req));
 
+    if (req->parallel) {
+        /* The request is already in progress and asks all agents at once.
+         * Also ask the new one right away. */
+        _con_get_parallel_call_start(req, agent);
+        return;
+    }
+
     /* Add this agent to the list, sorted appropriately */
     req->pending =
         g_slist_insert_sorted_with_data(req->pending, g_object_ref(agent), agent_compare_func, req);
@@ -831,12 +952,24 @@ static void
 request_remove_agent(Request *req, NMSecretAgent *agent)
 {
     NMAgentManager *self;
+    ParallelCall   *pcall;
 
     g_return_if_fail(req != NULL);
     g_return_if_fail(agent != NULL);
 
     self = req->self;
 
+    if (req->parallel) {
+        c_list_for_each_entry (pcall, &req->parallel_lst_head, parallel_lst) {
+            if (pcall->agent == agent) {
+                _LOGD(agent, "agent removed from secrets request " LOG_REQ_FMT, LOG_REQ_ARG(req));
+                _parallel_call_free(pcall);
+                _con_get_parallel_check_done(req);
+                return;
+            }
+        }
+    }
+
     if (agent == req->current) {
         nm_assert(!g_slist_find(req->pending, agent));
 
@@ -874,6 +1007,10 @@ request_start(gpointer user_data)
     case REQUEST_TYPE_CON_GET:
         if (_con_get_try_complete_early(req))
             goto out;
+        if (req->pending && req->pending->next && _con_get_parallel_enabled()) {
+            _con_get_parallel_start(req);
+            goto out;
+        }
         break;
     default:
         break;
@@ -918,6 +1055,8 @@ _con_get_request_done(NMSecretAgent       *agent,
               LOG_REQ_ARG(req),
               error->message);
 
+        _agent_stats_record(self, agent, req->current_start_msec, FALSE);
+
         if (g_error_matches(error, NM_SECRET_AGENT_ERROR, NM_SECRET_AGENT_ERROR_USER_CANCELED)) {
             error = g_error_new_literal(NM_AGENT_MANAGER_ERROR,
                                         NM_AGENT_MANAGER_ERROR_USER_CANCELED,
@@ -940,12 +1079,14 @@ _con_get_request_done(NMSecretAgent       *agent,
         g_variant_lookup_value(secrets, req->con.get.setting_name, NM_VARIANT_TYPE_SETTING);
     if (!setting_secrets || !g_variant_n_children(setting_secrets)) {
         _LOGD(agent, "agent returned no secrets for request " LOG_REQ_FMT, LOG_REQ_ARG(req));
+        _agent_stats_record(self, agent, req->current_start_msec, FALSE);
         /* Try the next agent */
         request_next_agent(req);
         return;
     }
 
     _LOGD(agent, "agent returned secrets for request " LOG_REQ_FMT, LOG_REQ_ARG(req));
+    _agent_stats_record(self, agent, req->current_start_msec, TRUE);
 
     agent_name = nm_utils_uid_to_name(nm_secret_agent_get_owner_uid(agent));
     if (agent_name && !g_utf8_validate(agent_name, -1, NULL)) {
@@ -1005,13 +1146,11 @@ set_secrets_not_required(NMConnection *connection, GVariant *dict)
     }
 }
 
-static void
-_con_get_request_start_proceed(Request *req, gboolean include_system_secrets)
+static NMConnection *
+_con_get_agent_connection_new(Request *req, gboolean include_system_secrets)
 {
     NMConnection *tmp;
 
-    g_return_if_fail(req->request_type == REQUEST_TYPE_CON_GET);
-
     tmp = nm_simple_connection_new_clone(req->con.connection);
     nm_connection_clear_secrets(tmp);
     if (include_system_secrets) {
@@ -1028,21 +1167,31 @@ _con_get_request_start_proceed(Request *req, gboolean include_system_secrets)
         if (req->con.get.existing_secrets)
             set_secrets_not_required(tmp, req->con.get.existing_secrets);
     }
+    return tmp;
+}
 
-    req->current_call_id = nm_secret_agent_get_secrets(req->current,
-                                                       req->con.path,
-                                                       tmp,
-                                                       req->con.get.setting_name,
-                                                       (const char **) req->con.get.hints,
-                                                       req->con.get.flags,
-                                                       _con_get_request_done,
-                                                       req);
+static void
+_con_get_request_start_proceed(Request *req, gboolean include_system_secrets)
+{
+    gs_unref_object NMConnection *tmp = NULL;
+
+    g_return_if_fail(req->request_type == REQUEST_TYPE_CON_GET);
+
+    tmp = _con_get_agent_connection_new(req, include_system_secrets);
+
+    req->current_start_msec = nm_utils_get_monotonic_timestamp_msec();
+    req->current_call_id    = nm_secret_agent_get_secrets(req->current,
+                                                          req->con.path,
+                                                          tmp,
+                                                          req->con.get.setting_name,
+                                                          (const char **) req->con.get.hints,
+                                                          req->con.get.flags,
+                                                          _con_get_request_done,
+                                                          req);
     if (!req->current_call_id) {
         g_warn_if_reached();
         request_next_agent(req);
     }
-
-    g_object_unref(tmp);
 }
 
 static void
@@ -1077,12 +1226,43 @@ _con_get_request_start_validated(NMAuthChain           *chain,
     _con_get_request_start_proceed(req, req->con.current_has_modify);
 }
 
+/* Returns the permission that an agent needs to be sent the system secrets,
+ * or %NULL if the request doesn't involve system secrets. */
+static const char *
+_con_get_modify_permission(Request *req)
+{
+    NMSettingConnection *s_con;
+
+    /* If the request flags allow user interaction, and there are existing
+     * system secrets (or blank secrets that are supposed to be system-owned),
+     * check whether the agent has the 'modify' permission before sending those
+     * secrets to the agent.  We shouldn't leak system-owned secrets to
+     * unprivileged users.
+     */
+    if (req->con.get.flags == NM_SECRET_AGENT_GET_SECRETS_FLAG_NONE)
+        return NULL;
+    if (!req->con.get.existing_secrets
+        && !_nm_connection_aggregate(req->con.connection,
+                                     NM_CONNECTION_AGGREGATE_ANY_SYSTEM_SECRET_FLAGS,
+                                     NULL))
+        return NULL;
+
+    /* If the caller is the only user in the connection's permissions, then
+     * we use the 'modify.own' permission instead of 'modify.system'.  If the
+     * request affects more than just the caller, require 'modify.system'.
+     */
+    s_con = nm_connection_get_setting_connection(req->con.connection);
+    g_assert(s_con);
+    if (nm_setting_connection_get_num_permissions(s_con) == 1)
+        return NM_AUTH_PERMISSION_SETTINGS_MODIFY_OWN;
+    return NM_AUTH_PERMISSION_SETTINGS_MODIFY_SYSTEM;
+}
+
 static void
 _con_get_request_start(Request *req)
 {
-    NMAgentManager      *self;
-    NMSettingConnection *s_con;
-    const char          *agent_dbus_owner, *perm;
+    NMAgentManager *self;
+    const char     *agent_dbus_owner, *perm;
 
     self = req->self;
 
@@ -1090,17 +1270,8 @@ _con_get_request_start(Request *req)
 
     agent_dbus_owner = nm_secret_agent_get_dbus_owner(req->current);
 
-    /* If the request flags allow user interaction, and there are existing
-     * system secrets (or blank secrets that are supposed to be system-owned),
-     * check whether the agent has the 'modify' permission before sending those
-     * secrets to the agent.  We shouldn't leak system-owned secrets to
-     * unprivileged users.
-     */
-    if ((req->con.get.flags != NM_SECRET_AGENT_GET_SECRETS_FLAG_NONE)
-        && (req->con.get.existing_secrets
-            || _nm_connection_aggregate(req->con.connection,
-                                        NM_CONNECTION_AGGREGATE_ANY_SYSTEM_SECRET_FLAGS,
-                                        NULL))) {
+    perm = _con_get_modify_permission(req);
+    if (perm) {
         _LOGD(NULL,
               "(" LOG_REQ_FMT ") request has system secrets; checking agent %s for MODIFY",
               LOG_REQ_ARG(req),
@@ -1112,16 +1283,6 @@ _con_get_request_start(Request *req)
                                                    req);
         nm_assert(req->con.chain);
 
-        /* If the caller is the only user in the connection's permissions, then
-         * we use the 'modify.own' permission instead of 'modify.system'.  If the
-         * request affects more than just the caller, require 'modify.system'.
-         */
-        s_con = nm_connection_get_setting_connection(req->con.connection);
-        g_assert(s_con);
-        if (nm_setting_connection_get_num_permissions(s_con) == 1)
-            perm = NM_AUTH_PERMISSION_SETTINGS_MODIFY_OWN;
-        else
-            perm = NM_AUTH_PERMISSION_SETTINGS_MODIFY_SYSTEM;
         nm_auth_chain_set_data(req->con.chain, "perm", (gpointer) perm, NULL);
 
         nm_auth_chain_add_call_unsafe(req->con.chain, perm, TRUE);
@@ -1135,6 +1296,223 @@ _con_get_request_start(Request *req)
     }
 }
 
+/*****************************************************************************/
+
+static gboolean
+_con_get_parallel_enabled(void)
+{
+    return nm_config_data_get_value_boolean(NM_CONFIG_GET_DATA,
+                                            NM_CONFIG_KEYFILE_GROUP_MAIN,
+                                            NM_CONFIG_KEYFILE_KEY_MAIN_SECRET_AGENTS_PARALLEL,
+                                            FALSE);
+}
+
+static void
+_con_get_parallel_check_done(Request *req)
+{
+    gs_free_error GError *error = NULL;
+
+    nm_assert(req->parallel);
+
+    if (!c_list_is_empty(&req->parallel_lst_head))
+        return;
+
+    /* All agents failed or returned nothing. */
+    error = g_error_new_literal(NM_AGENT_MANAGER_ERROR,
+                                NM_AGENT_MANAGER_ERROR_NO_SECRETS,
+                                "No agents were available for this request.");
+    req_complete_error(req, error);
+}
+
+static void
+_con_get_parallel_call_done(NMSecretAgent       *agent,
+                            NMSecretAgentCallId *call_id,
+                            GVariant            *secrets,
+                            GError              *error,
+                            gpointer             user_data)
+{
+    ParallelCall              *pcall = user_data;
+    Request                   *req;
+    NMAgentManager            *self;
+    gs_unref_variant GVariant *setting_secrets = NULL;
+    gs_free char              *agent_name      = NULL;
+    gs_free_error GError      *local           = NULL;
+
+    /* Cancellation happens only while freeing @pcall. Don't touch it. */
+    if (g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+        return;
+
+    g_return_if_fail(call_id == pcall->call_id);
+    g_return_if_fail(agent == pcall->agent);
+
+    req  = pcall->req;
+    self = req->self;
+
+    pcall->call_id = NULL;
+
+    if (!error) {
+        setting_secrets =
+            g_variant_lookup_value(secrets, req->con.get.setting_name, NM_VARIANT_TYPE_SETTING);
+    }
+
+    if (!setting_secrets || !g_variant_n_children(setting_secrets)) {
+        if (error) {
+            _LOGD(agent,
+                  "agent failed secrets request " LOG_REQ_FMT ": %s",
+                  LOG_REQ_ARG(req),
+                  error->message);
+            if (g_error_matches(error,
+                                NM_SECRET_AGENT_ERROR,
+                                NM_SECRET_AGENT_ERROR_USER_CANCELED)) {
+                /* Like in serial mode, the user declining to provide secrets
+                 * ends the request. Completing it cancels the other calls. */
+                _agent_stats_record(self, agent, pcall->start_msec, FALSE);
+                local = g_error_new_literal(NM_AGENT_MANAGER_ERROR,
+                                            NM_AGENT_MANAGER_ERROR_USER_CANCELED,
+                                            "User canceled the secrets request.");
+                req_complete_error(req, local);
+                return;
+            }
+        } else
+            _LOGD(agent, "agent returned no secrets for request " LOG_REQ_FMT, LOG_REQ_ARG(req));
+
+        _agent_stats_record(self, agent, pcall->start_msec, FALSE);
+        _parallel_call_free(pcall);
+        _con_get_parallel_check_done(req);
+        if (error)
+            maybe_remove_agent_on_error(self, agent, error);
+        return;
+    }
+
+    _LOGD(agent, "agent returned secrets for request " LOG_REQ_FMT, LOG_REQ_ARG(req));
+    _agent_stats_record(self, agent, pcall->start_msec, TRUE);
+
+    agent_name = nm_utils_uid_to_name(nm_secret_agent_get_owner_uid(agent));
+    if (agent_name && !g_utf8_validate(agent_name, -1, NULL)) {
+        /* Needs to be UTF-8 valid since it may be pushed through D-Bus */
+        nm_clear_g_free(&agent_name);
+    }
+
+    /* The first answer wins. Completing the request cancels the calls
+     * to all other agents. */
+    req->con.current_has_modify = pcall->has_modify;
+    req_complete(req, secrets, nm_secret_agent_get_dbus_owner(agent), agent_name, NULL);
+}
+
+static gboolean
+_con_get_parallel_call_proceed(ParallelCall *pcall)
+{
+    Request                      *req = pcall->req;
+    gs_unref_object NMConnection *tmp = NULL;
+
+    tmp = _con_get_agent_connection_new(req, pcall->has_modify);
+
+    pcall->start_msec = nm_utils_get_monotonic_timestamp_msec();
+    pcall->call_id    = nm_secret_agent_get_secrets(pcall->agent,
+                                                    req->con.path,
+                                                    tmp,
+                                                    req->con.get.setting_name,
+                                                    (const char **) req->con.get.hints,
+                                                    req->con.get.flags,
+                                                    _con_get_parallel_call_done,
+                                                    pcall);
+    if (!pcall->call_id) {
+        g_warn_if_reached();
+        _parallel_call_free(pcall);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static void
+_con_get_parallel_call_validated(NMAuthChain           *chain,
+                                 GDBusMethodInvocation *context,
+                                 gpointer               user_data)
+{
+    ParallelCall   *pcall = user_data;
+    Request        *req   = pcall->req;
+    NMAgentManager *self  = req->self;
+    const char     *perm;
+
+    pcall->chain = NULL;
+
+    perm = nm_auth_chain_get_data(chain, "perm");
+    nm_assert(perm);
+    pcall->has_modify = (nm_auth_chain_get_result(chain, perm) == NM_AUTH_CALL_RESULT_YES);
+
+    _LOGD(pcall->agent,
+          "agent " LOG_REQ_FMT " MODIFY check result %s",
+          LOG_REQ_ARG(req),
+          pcall->has_modify ? "YES" : "NO");
+
+    if (!_con_get_parallel_call_proceed(pcall))
+        _con_get_parallel_check_done(req);
+}
+
+static void
+_con_get_parallel_call_start(Request *req, NMSecretAgent *agent)
+{
+    NMAgentManager *self = req->self;
+    ParallelCall   *pcall;
+    const char     *perm;
+
+    nm_assert(req->parallel);
+
+    pcall  = g_slice_new(ParallelCall);
+    *pcall = (ParallelCall){
+        .req   = req,
+        .agent = g_object_ref(agent),
+    };
+    c_list_link_tail(&req->parallel_lst_head, &pcall->parallel_lst);
+
+    _LOGD(agent, "agent getting secrets for request " LOG_REQ_FMT " (parallel)", LOG_REQ_ARG(req));
+
+    perm = _con_get_modify_permission(req);
+    if (!perm) {
+        _con_get_parallel_call_proceed(pcall);
+        return;
+    }
+
+    pcall->chain = nm_auth_chain_new_subject(nm_secret_agent_get_subject(agent),
+                                             NULL,
+                                             _con_get_parallel_call_validated,
+                                             pcall);
+    nm_assert(pcall->chain);
+    nm_auth_chain_set_data(pcall->chain, "perm", (gpointer) perm, NULL);
+    nm_auth_chain_add_call_unsafe(pcall->chain, perm, TRUE);
+}
+
+static void
+_con_get_parallel_start(Request *req)
+{
+    NMAgentManager *self = req->self;
+    NMSecretAgent  *agent;
+
+    nm_assert(req->request_type == REQUEST_TYPE_CON_GET);
+    nm_assert(!req->parallel);
+    nm_assert(!req->current);
+
+    _LOGD(NULL,
+          "(" LOG_REQ_FMT ") asking %u agents in parallel",
+          LOG_REQ_ARG(req),
+          g_slist_length(req->pending));
+
+    req->parallel = TRUE;
+
+    /* Start the calls in order of preference. Calls that fail synchronously
+     * are dropped without completing the request, that is checked at the end. */
+    while (req->pending) {
+        agent        = req->pending->data;
+        req->pending = g_slist_delete_link(req->pending, req->pending);
+        _con_get_parallel_call_start(req, agent);
+        g_object_unref(agent);
+    }
+
+    _con_get_parallel_check_done(req);
+}
+
+/*****************************************************************************/
+
 static gboolean
 _con_get_try_complete_early(Request *req)
 {
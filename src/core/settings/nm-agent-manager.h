@@ -33,6 +33,8 @@ NMAgentManager *nm_agent_manager_get(void);
 
 guint64 nm_agent_manager_get_agent_version_id(NMAgentManager *self);
 
+void _nm_agent_manager_add_agent_for_testing(NMAgentManager *self, NMSecretAgent *agent);
+
 /* If no agent fulfilled the secrets request, agent_dbus_owner will be NULL */
 typedef void (*NMAgentSecretsResultFunc)(NMAgentManager              *manager,
                                          NMAgentManagerCallId         call_id,
@@ -662,11 +662,11 @@ get_name_owner_cb(const char *name_owner, GError *error, gpointer user_data)
 
 /*****************************************************************************/
 
-NMSecretAgent *
-nm_secret_agent_new(GDBusMethodInvocation    *context,
-                    NMAuthSubject            *subject,
-                    const char               *identifier,
-                    NMSecretAgentCapabilities capabilities)
+static NMSecretAgent *
+_secret_agent_new(GDBusConnection          *dbus_connection,
+                  NMAuthSubject            *subject,
+                  const char               *identifier,
+                  NMSecretAgentCapabilities capabilities)
 {
     NMSecretAgent        *self;
     NMSecretAgentPrivate *priv;
@@ -676,19 +676,14 @@ nm_secret_agent_new(GDBusMethodInvocation    *context,
     char                  buf_subject[64];
     char                  buf_caps[150];
     gulong                uid;
-    GDBusConnection      *dbus_connection;
 
-    g_return_val_if_fail(context != NULL, NULL);
+    g_return_val_if_fail(G_IS_DBUS_CONNECTION(dbus_connection), NULL);
     g_return_val_if_fail(NM_IS_AUTH_SUBJECT(subject), NULL);
     g_return_val_if_fail(nm_auth_subject_get_subject_type(subject)
                              == NM_AUTH_SUBJECT_TYPE_UNIX_PROCESS,
                          NULL);
     g_return_val_if_fail(identifier != NULL, NULL);
 
-    dbus_connection = g_dbus_method_invocation_get_connection(context);
-
-    g_return_val_if_fail(G_IS_DBUS_CONNECTION(dbus_connection), NULL);
-
     uid = nm_auth_subject_get_unix_process_uid(subject);
 
     owner_username = nm_utils_uid_to_name(uid);
@@ -733,6 +728,41 @@ nm_secret_agent_new(GDBusMethodInvocation    *context,
     return self;
 }
 
+NMSecretAgent *
+nm_secret_agent_new(GDBusMethodInvocation    *context,
+                    NMAuthSubject            *subject,
+                    const char               *identifier,
+                    NMSecretAgentCapabilities capabilities)
+{
+    g_return_val_if_fail(context != NULL, NULL);
+
+    return _secret_agent_new(g_dbus_method_invocation_get_connection(context),
+                             subject,
+                             identifier,
+                             capabilities);
+}
+
+/**
+ * _nm_secret_agent_new_for_testing:
+ * @dbus_connection: the (message bus) connection on which the agent is reachable
+ * @subject: the unix-process subject of the agent, with its unique D-Bus name
+ * @identifier: the agent identifier
+ * @capabilities: the agent capabilities
+ *
+ * Like nm_secret_agent_new(), but without a RegisterWithCapabilities() call
+ * that provides the connection. Only for unit tests.
+ *
+ * Returns: (transfer full): the new agent.
+ */
+NMSecretAgent *
+_nm_secret_agent_new_for_testing(GDBusConnection          *dbus_connection,
+                                 NMAuthSubject            *subject,
+                                 const char               *identifier,
+                                 NMSecretAgentCapabilities capabilities)
+{
+    return _secret_agent_new(dbus_connection, subject, identifier, capabilities);
+}
+
 static void
 nm_secret_agent_init(NMSecretAgent *self)
 {
@@ -33,7 +33,16 @@ struct _NMSecretAgent {
     CList                         agent_lst;
     struct _NMAuthChain          *auth_chain;
     struct _NMSecretAgentPrivate *_priv;
-    bool                          fully_registered : 1;
+
+    /* Latency statistics of get-secrets requests, maintained by NMAgentManager. */
+    struct {
+        guint64 n_calls;
+        guint64 n_succeeded;
+        guint64 latency_sum_msec;
+        guint32 latency_max_msec;
+    } stats;
+
+    bool fully_registered : 1;
 };
 
 GType nm_secret_agent_get_type(void);
@@ -43,6 +52,11 @@ NMSecretAgent *nm_secret_agent_new(GDBusMethodInvocation    *context,
                                    const char               *identifier,
                                    NMSecretAgentCapabilities capabilities);
 
+NMSecretAgent *_nm_secret_agent_new_for_testing(GDBusConnection          *dbus_connection,
+                                                NMAuthSubject            *subject,
+                                                const char               *identifier,
+                                                NMSecretAgentCapabilities capabilities);
+
 const char *nm_secret_agent_get_description(NMSecretAgent *agent);
 
 const char *nm_secret_agent_get_dbus_owner(NMSecretAgent *agent);
@@ -388,6 +388,9 @@ typedef struct {
     GSList *unmanaged_specs;
     GSList *unrecognized_specs;
 
+    NMMatchSpecDeviceMatcher *unmanaged_matcher;
+    NMMatchSpecDeviceMatcher *unrecognized_matcher;
+
     gint64      startup_complete_start_timestamp_msec;
     GHashTable *startup_complete_idx;
     CList       startup_complete_scd_lst_head;
@@ -752,8 +755,19 @@ nm_settings_get_unmanaged_specs(NMSettings *self)
     return priv->unmanaged_specs;
 }
 
+const NMMatchSpecDeviceMatcher *
+nm_settings_get_unmanaged_matcher(NMSettings *self)
+{
+    NMSettingsPrivate *priv = NM_SETTINGS_GET_PRIVATE(self);
+
+    return priv->unmanaged_matcher;
+}
+
 static gboolean
-update_specs(NMSettings *self, GSList **specs_ptr, GSList *(*get_specs_func)(NMSettingsPlugin *) )
+update_specs(NMSettings                *self,
+             GSList                   **specs_ptr,
+             NMMatchSpecDeviceMatcher **matcher_ptr,
+             GSList *(*get_specs_func)(NMSettingsPlugin *) )
 {
     NMSettingsPrivate *priv = NM_SETTINGS_GET_PRIVATE(self);
     GSList *new             = NULL;
@@ -784,6 +798,8 @@ update_specs(NMSettings *self, GSList **specs_ptr, GSList *(*get_specs_func)(NMS
 
     g_slist_free_full(*specs_ptr, g_free);
     *specs_ptr = new;
+    nm_match_spec_device_matcher_free(*matcher_ptr);
+    *matcher_ptr = nm_match_spec_device_matcher_new(new);
     return TRUE;
 }
 
@@ -793,7 +809,10 @@ _plugin_unmanaged_specs_changed(NMSettingsPlugin *config, gpointer user_data)
     NMSettings        *self = NM_SETTINGS(user_data);
     NMSettingsPrivate *priv = NM_SETTINGS_GET_PRIVATE(self);
 
-    if (update_specs(self, &priv->unmanaged_specs, nm_settings_plugin_get_unmanaged_specs))
+    if (update_specs(self,
+                     &priv->unmanaged_specs,
+                     &priv->unmanaged_matcher,
+                     nm_settings_plugin_get_unmanaged_specs))
         _notify(self, PROP_UNMANAGED_SPECS);
 }
 
@@ -803,7 +822,10 @@ _plugin_unrecognized_specs_changed(NMSettingsPlugin *config, gpointer user_data)
     NMSettings        *self = NM_SETTINGS(user_data);
     NMSettingsPrivate *priv = NM_SETTINGS_GET_PRIVATE(self);
 
-    update_specs(self, &priv->unrecognized_specs, nm_settings_plugin_get_unrecognized_specs);
+    update_specs(self,
+                 &priv->unrecognized_specs,
+                 &priv->unrecognized_matcher,
+                 nm_settings_plugin_get_unrecognized_specs);
 }
 
 /*****************************************************************************/
@@ -1454,6 +1476,8 @@ _plugin_connections_reload(NMSettings *self)
 {
     NMSettingsPrivate *priv = NM_SETTINGS_GET_PRIVATE(self);
     GSList            *iter;
+    guint              verify_hits;
+    guint              verify_misses;
 
     for (iter = priv->plugins; iter; iter = iter->next) {
         nm_settings_plugin_reload_connections(iter->data, _plugin_connections_reload_cb, self);
@@ -1471,6 +1495,11 @@ _plugin_connections_reload(NMSettings *self)
 
     for (iter = priv->plugins; iter; iter = iter->next)
         nm_settings_plugin_load_connections_done(iter->data);
+
+    _nm_connection_verify_cache_get_stats(&verify_hits, &verify_misses);
+    _LOGD("reload: connection verification cache has %u hits and %u misses",
+          verify_hits,
+          verify_misses);
 }
 
 /*****************************************************************************/
@@ -2751,36 +2780,28 @@ impl_settings_add_connection_unsaved(NMDBusObject                      *obj,
                                    NM_SETTINGS_ADD_CONNECTION2_FLAG_IN_MEMORY);
 }
 
-static void
-impl_settings_add_connection2(NMDBusObject                      *obj,
-                              const NMDBusInterfaceInfoExtended *interface_info,
-                              const NMDBusMethodInfoExtended    *method_info,
-                              GDBusConnection                   *connection,
-                              const char                        *sender,
-                              GDBusMethodInvocation             *invocation,
-                              GVariant                          *parameters)
+static gboolean
+_add_connection2_parse_args(guint32                        flags_u,
+                            GVariant                      *args,
+                            NMSettingsAddConnection2Flags *out_flags,
+                            char                         **out_plugin,
+                            GError                       **error)
 {
-    NMSettings                   *self     = NM_SETTINGS(obj);
-    gs_unref_variant GVariant    *settings = NULL;
-    gs_unref_variant GVariant    *args     = NULL;
-    gs_free char                 *plugin   = NULL;
+    gs_free char                 *plugin = NULL;
     NMSettingsAddConnection2Flags flags;
     const char                   *args_name;
     GVariant                     *args_value;
     GVariantIter                  iter;
-    guint32                       flags_u;
-
-    g_variant_get(parameters, "(@a{sa{sv}}u@a{sv})", &settings, &flags_u, &args);
 
     if (NM_FLAGS_ANY(flags_u,
                      ~((guint32) (NM_SETTINGS_ADD_CONNECTION2_FLAG_TO_DISK
                                   | NM_SETTINGS_ADD_CONNECTION2_FLAG_IN_MEMORY
                                   | NM_SETTINGS_ADD_CONNECTION2_FLAG_BLOCK_AUTOCONNECT)))) {
-        g_dbus_method_invocation_take_error(invocation,
-                                            g_error_new_literal(NM_SETTINGS_ERROR,
-                                                                NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
-                                                                "Unknown flags"));
-        return;
+        g_set_error_literal(error,
+                            NM_SETTINGS_ERROR,
+                            NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
+                            "Unknown flags");
+        return FALSE;
     }
 
     flags = flags_u;
@@ -2788,23 +2809,21 @@ impl_settings_add_connection2(NMDBusObject                      *obj,
     if (!NM_FLAGS_ANY(flags,
                       NM_SETTINGS_ADD_CONNECTION2_FLAG_TO_DISK
                           | NM_SETTINGS_ADD_CONNECTION2_FLAG_IN_MEMORY)) {
-        g_dbus_method_invocation_take_error(
-            invocation,
-            g_error_new_literal(NM_SETTINGS_ERROR,
-                                NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
-                                "Requires either to-disk (0x1) or in-memory (0x2) flags"));
-        return;
+        g_set_error_literal(error,
+                            NM_SETTINGS_ERROR,
+                            NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
+                            "Requires either to-disk (0x1) or in-memory (0x2) flags");
+        return FALSE;
     }
 
     if (NM_FLAGS_ALL(flags,
                      NM_SETTINGS_ADD_CONNECTION2_FLAG_TO_DISK
                          | NM_SETTINGS_ADD_CONNECTION2_FLAG_IN_MEMORY)) {
-        g_dbus_method_invocation_take_error(
-            invocation,
-            g_error_new_literal(NM_SETTINGS_ERROR,
-                                NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
-                                "Cannot set to-disk (0x1) and in-memory (0x2) flags together"));
-        return;
+        g_set_error_literal(error,
+                            NM_SETTINGS_ERROR,
+                            NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
+                            "Cannot set to-disk (0x1) and in-memory (0x2) flags together");
+        return FALSE;
     }
 
     nm_assert(g_variant_is_of_type(args, G_VARIANT_TYPE("a{sv}")));
@@ -2814,14 +2833,45 @@ impl_settings_add_connection2(NMDBusObject                      *obj,
         if (plugin == NULL && nm_streq(args_name, "plugin")
             && g_variant_is_of_type(args_value, G_VARIANT_TYPE_STRING)) {
             plugin = g_variant_dup_string(args_value, NULL);
+            g_variant_unref(args_value);
             continue;
         }
 
-        g_dbus_method_invocation_take_error(invocation,
-                                            g_error_new(NM_SETTINGS_ERROR,
-                                                        NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
-                                                        "Unsupported argument '%s'",
-                                                        args_name));
+        g_variant_unref(args_value);
+        g_set_error(error,
+                    NM_SETTINGS_ERROR,
+                    NM_SETTINGS_ERROR_INVALID_ARGUMENTS,
+                    "Unsupported argument '%s'",
+                    args_name);
+        return FALSE;
+    }
+
+    *out_flags  = flags;
+    *out_plugin = g_steal_pointer(&plugin);
+    return TRUE;
+}
+
+static void
+impl_settings_add_connection2(NMDBusObject                      *obj,
+                              const NMDBusInterfaceInfoExtended *interface_info,
+                              const NMDBusMethodInfoExtended    *method_info,
+                              GDBusConnection                   *connection,
+                              const char                        *sender,
+                              GDBusMethodInvocation             *invocation,
+                              GVariant                          *parameters)
+{
+    NMSettings                   *self     = NM_SETTINGS(obj);
+    gs_unref_variant GVariant    *settings = NULL;
+    gs_unref_variant GVariant    *args     = NULL;
+    gs_free char                 *plugin   = NULL;
+    GError                       *error    = NULL;
+    NMSettingsAddConnection2Flags flags;
+    guint32                       flags_u;
+
+    g_variant_get(parameters, "(@a{sa{sv}}u@a{sv})", &settings, &flags_u, &args);
+
+    if (!_add_connection2_parse_args(flags_u, args, &flags, &plugin, &error)) {
+        g_dbus_method_invocation_take_error(invocation, error);
         return;
     }
 
@@ -2830,6 +2880,220 @@ impl_settings_add_connection2(NMDBusObject                      *obj,
 
 /*****************************************************************************/
 
+static void
+pk_add_connections_cb(NMAuthChain *chain, GDBusMethodInvocation *context, gpointer user_data)
+{
+    NMSettings                     *self  = NM_SETTINGS(user_data);
+    gs_free_error GError           *error = NULL;
+    gs_unref_ptrarray GPtrArray    *added = NULL;
+    GPtrArray                      *connections;
+    NMAuthSubject                  *subject;
+    const char                     *perm;
+    const char                     *plugin;
+    NMSettingsConnectionPersistMode persist_mode;
+    NMSettingsConnectionAddReason   add_reason;
+    GVariantBuilder                 builder_paths;
+    GVariantBuilder                 builder_result;
+    guint                           i;
+
+    nm_assert(G_IS_DBUS_METHOD_INVOCATION(context));
+
+    c_list_unlink(nm_auth_chain_parent_lst_list(chain));
+
+    perm = nm_auth_chain_get_data(chain, "perm");
+    nm_assert(perm);
+
+    subject = nm_auth_chain_get_data(chain, "subject");
+
+    if (nm_auth_chain_get_result(chain, perm) != NM_AUTH_CALL_RESULT_YES) {
+        error = g_error_new_literal(NM_SETTINGS_ERROR,
+                                    NM_SETTINGS_ERROR_PERMISSION_DENIED,
+                                    NM_UTILS_ERROR_MSG_INSUFF_PRIV);
+        goto out_error;
+    }
+
+    connections  = nm_auth_chain_get_data(chain, "connections");
+    plugin       = nm_auth_chain_get_data(chain, "plugin");
+    persist_mode = GPOINTER_TO_UINT(nm_auth_chain_get_data(chain, "persist-mode"));
+    add_reason   = GPOINTER_TO_UINT(nm_auth_chain_get_data(chain, "add-reason"));
+
+    added = g_ptr_array_new_full(connections->len, g_object_unref);
+
+    /* Freeze the property notifications while adding the batch, so that
+     * "Connections" changes (and is announced on D-Bus) only once. */
+    g_object_freeze_notify(G_OBJECT(self));
+    for (i = 0; i < connections->len; i++) {
+        NMSettingsConnection *sett_conn;
+
+        if (!nm_settings_add_connection(self,
+                                        plugin,
+                                        connections->pdata[i],
+                                        persist_mode,
+                                        add_reason,
+                                        NM_SETTINGS_CONNECTION_INT_FLAGS_NONE,
+                                        &sett_conn,
+                                        &error)) {
+            g_prefix_error(&error, "connection #%u: ", i);
+            break;
+        }
+        g_ptr_array_add(added, g_object_ref(sett_conn));
+    }
+    g_object_thaw_notify(G_OBJECT(self));
+
+    for (i = 0; i < added->len; i++) {
+        NMSettingsConnection *sett_conn = added->pdata[i];
+
+        nm_audit_log_connection_op(NM_AUDIT_OP_CONN_ADD, sett_conn, TRUE, NULL, subject, NULL);
+        if (nm_settings_has_connection(self, sett_conn))
+            send_agent_owned_secrets(self, sett_conn, subject);
+    }
+
+    if (error) {
+        _LOGD("add-connections: added %u of %u connections before failure: %s",
+              added->len,
+              connections->len,
+              error->message);
+        goto out_error;
+    }
+
+    _LOGD("add-connections: added %u connections", added->len);
+
+    g_variant_builder_init(&builder_paths, G_VARIANT_TYPE("ao"));
+    for (i = 0; i < added->len; i++)
+        g_variant_builder_add(&builder_paths,
+                              "o",
+                              nm_dbus_object_get_path(NM_DBUS_OBJECT(added->pdata[i])));
+    g_variant_builder_init(&builder_result, G_VARIANT_TYPE_VARDICT);
+    g_dbus_method_invocation_return_value(context,
+                                          g_variant_new("(aoa{sv})", &builder_paths, &builder_result));
+    return;
+
+out_error:
+    g_dbus_method_invocation_return_gerror(context, error);
+    nm_audit_log_connection_op(NM_AUDIT_OP_CONN_ADD, NULL, FALSE, NULL, subject, error->message);
+}
+
+static void
+impl_settings_add_connections(NMDBusObject                      *obj,
+                              const NMDBusInterfaceInfoExtended *interface_info,
+                              const NMDBusMethodInfoExtended    *method_info,
+                              GDBusConnection                   *dbus_connection,
+                              const char                        *sender,
+                              GDBusMethodInvocation             *invocation,
+                              GVariant                          *parameters)
+{
+    NMSettings                     *self         = NM_SETTINGS(obj);
+    NMSettingsPrivate              *priv         = NM_SETTINGS_GET_PRIVATE(self);
+    gs_unref_variant GVariant      *settings_arr = NULL;
+    gs_unref_variant GVariant      *args         = NULL;
+    gs_free char                   *plugin       = NULL;
+    gs_unref_object NMAuthSubject  *subject      = NULL;
+    gs_unref_ptrarray GPtrArray    *connections  = NULL;
+    gs_unref_hashtable GHashTable  *uuids        = NULL;
+    GError                         *error        = NULL;
+    const char                     *perm         = NM_AUTH_PERMISSION_SETTINGS_MODIFY_OWN;
+    NMSettingsAddConnection2Flags   flags;
+    NMSettingsConnectionPersistMode persist_mode;
+    NMSettingsConnectionAddReason   add_reason;
+    NMAuthChain                    *chain;
+    GVariantIter                    iter;
+    GVariant                       *settings;
+    guint32                         flags_u;
+
+    g_variant_get(parameters, "(@aa{sa{sv}}u@a{sv})", &settings_arr, &flags_u, &args);
+
+    if (!_add_connection2_parse_args(flags_u, args, &flags, &plugin, &error))
+        goto out_error;
+
+    subject = nm_dbus_manager_new_auth_subject_from_context(invocation);
+    if (!subject) {
+        error = g_error_new_literal(NM_SETTINGS_ERROR,
+                                    NM_SETTINGS_ERROR_PERMISSION_DENIED,
+                                    NM_UTILS_ERROR_MSG_REQ_UID_UKNOWN);
+        goto out_error;
+    }
+
+    /* Parse, normalize and verify all profiles upfront. The batch is rejected
+     * as a whole if any of them is invalid, before asking for authorization. */
+    connections = g_ptr_array_new_full(g_variant_n_children(settings_arr), g_object_unref);
+    uuids       = g_hash_table_new(nm_str_hash, g_str_equal);
+
+    g_variant_iter_init(&iter, settings_arr);
+    while ((settings = g_variant_iter_next_value(&iter))) {
+        gs_unref_variant GVariant    *settings_free = settings;
+        gs_unref_object NMConnection *connection    = NULL;
+        NMSettingConnection          *s_con;
+        const char                   *uuid;
+
+        connection = _nm_simple_connection_new_from_dbus(settings,
+                                                         NM_SETTING_PARSE_FLAGS_STRICT
+                                                             | NM_SETTING_PARSE_FLAGS_NORMALIZE,
+                                                         &error);
+        if (!connection || !nm_connection_verify_secrets(connection, &error)) {
+            g_prefix_error(&error, "connection #%u: ", connections->len);
+            goto out_error;
+        }
+
+        uuid = nm_connection_get_uuid(connection);
+        if (!g_hash_table_add(uuids, (gpointer) uuid)) {
+            error = g_error_new(NM_SETTINGS_ERROR,
+                                NM_SETTINGS_ERROR_UUID_EXISTS,
+                                "connection #%u: duplicate UUID %s in request",
+                                connections->len,
+                                uuid);
+            goto out_error;
+        }
+
+        if (!nm_auth_is_subject_in_acl_set_error(connection,
+                                                 subject,
+                                                 NM_SETTINGS_ERROR,
+                                                 NM_SETTINGS_ERROR_PERMISSION_DENIED,
+                                                 &error)) {
+            g_prefix_error(&error, "connection #%u: ", connections->len);
+            goto out_error;
+        }
+
+        /* A single authorization covers the whole batch. It only needs 'modify.own'
+         * if every profile is restricted to the caller alone. */
+        s_con = nm_connection_get_setting_connection(connection);
+        nm_assert(s_con);
+        if (nm_setting_connection_get_num_permissions(s_con) != 1)
+            perm = NM_AUTH_PERMISSION_SETTINGS_MODIFY_SYSTEM;
+
+        g_ptr_array_add(connections, g_steal_pointer(&connection));
+    }
+
+    if (NM_FLAGS_HAS(flags, NM_SETTINGS_ADD_CONNECTION2_FLAG_TO_DISK))
+        persist_mode = NM_SETTINGS_CONNECTION_PERSIST_MODE_TO_DISK;
+    else
+        persist_mode = NM_SETTINGS_CONNECTION_PERSIST_MODE_IN_MEMORY_ONLY;
+
+    add_reason = NM_FLAGS_HAS(flags, NM_SETTINGS_ADD_CONNECTION2_FLAG_BLOCK_AUTOCONNECT)
+                     ? NM_SETTINGS_CONNECTION_ADD_REASON_BLOCK_AUTOCONNECT
+                     : NM_SETTINGS_CONNECTION_ADD_REASON_NONE;
+
+    chain = nm_auth_chain_new_subject(subject, invocation, pk_add_connections_cb, self);
+
+    c_list_link_tail(&priv->auth_lst_head, nm_auth_chain_parent_lst_list(chain));
+    nm_auth_chain_set_data(chain, "perm", (gpointer) perm, NULL);
+    nm_auth_chain_set_data(chain,
+                           "connections",
+                           g_steal_pointer(&connections),
+                           (GDestroyNotify) g_ptr_array_unref);
+    nm_auth_chain_set_data(chain, "subject", g_object_ref(subject), g_object_unref);
+    nm_auth_chain_set_data(chain, "persist-mode", GUINT_TO_POINTER(persist_mode), NULL);
+    nm_auth_chain_set_data(chain, "add-reason", GUINT_TO_POINTER(add_reason), NULL);
+    nm_auth_chain_set_data(chain, "plugin", g_steal_pointer(&plugin), g_free);
+    nm_auth_chain_add_call_unsafe(chain, perm, TRUE);
+    return;
+
+out_error:
+    nm_audit_log_connection_op(NM_AUDIT_OP_CONN_ADD, NULL, FALSE, NULL, subject, error->message);
+    g_dbus_method_invocation_take_error(invocation, error);
+}
+
+/*****************************************************************************/
+
 static void
 impl_settings_load_connections(NMDBusObject                      *obj,
                                const NMDBusInterfaceInfoExtended *interface_info,
@@ -3640,7 +3904,7 @@ have_connection_for_device(NMSettings *self, NMDevice *device)
     }
 
     /* See if there's a known non-NetworkManager configuration for the device */
-    if (nm_device_spec_match_list(device, priv->unrecognized_specs))
+    if (nm_device_spec_match_matcher(device, priv->unrecognized_matcher, FALSE))
         return TRUE;
 
     return FALSE;
@@ -4202,6 +4466,8 @@ finalize(GObject *object)
 
     g_slist_free_full(priv->unmanaged_specs, g_free);
     g_slist_free_full(priv->unrecognized_specs, g_free);
+    nm_match_spec_device_matcher_free(priv->unmanaged_matcher);
+    nm_match_spec_device_matcher_free(priv->unrecognized_matcher);
 
     while ((iter = priv->plugins)) {
         gs_unref_object NMSettingsPlugin *plugin = iter->data;
@@ -4285,6 +4551,17 @@ static const NMDBusInterfaceInfoExtended interface_info_settings = {
                         NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("path", "o"),
                                                   NM_DEFINE_GDBUS_ARG_INFO("result", "a{sv}"), ), ),
                 .handle = impl_settings_add_connection2, ),
+            NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
+                NM_DEFINE_GDBUS_METHOD_INFO_INIT(
+                    "AddConnections",
+                    .in_args =
+                        NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("settings", "aa{sa{sv}}"),
+                                                  NM_DEFINE_GDBUS_ARG_INFO("flags", "u"),
+                                                  NM_DEFINE_GDBUS_ARG_INFO("args", "a{sv}"), ),
+                    .out_args =
+                        NM_DEFINE_GDBUS_ARG_INFOS(NM_DEFINE_GDBUS_ARG_INFO("paths", "ao"),
+                                                  NM_DEFINE_GDBUS_ARG_INFO("result", "a{sv}"), ), ),
+                .handle = impl_settings_add_connections, ),
             NM_DEFINE_DBUS_METHOD_INFO_EXTENDED(
                 NM_DEFINE_GDBUS_METHOD_INFO_INIT(
                     "LoadConnections",
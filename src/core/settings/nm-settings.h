@@ -122,7 +122,8 @@ const char *nm_settings_get_dbus_path_for_uuid(NMSettings *self, const char *uui
 
 gboolean nm_settings_has_connection(NMSettings *self, NMSettingsConnection *connection);
 
-const GSList *nm_settings_get_unmanaged_specs(NMSettings *self);
+const GSList                   *nm_settings_get_unmanaged_specs(NMSettings *self);
+const NMMatchSpecDeviceMatcher *nm_settings_get_unmanaged_matcher(NMSettings *self);
 
 void nm_settings_device_added(NMSettings *self, NMDevice *device);
 
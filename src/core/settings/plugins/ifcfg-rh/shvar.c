@@ -51,18 +51,33 @@ struct _shvarLine {
      * 3) like 2, but if the value was deleted via svSetValue(), the entry is not removed,
      *   but only marked for deletion. That is done by clearing @line but preserving
      *   @key/@key_with_prefix.
+     *
+     * Lines that were parsed from a file point into the file content of the
+     * shvarFile (which is modified in place to NUL terminate them). Only
+     * lines that were set later are allocated (see @line_owned, @key_owned).
      * */
     char *line;
     char *key_with_prefix;
 
+    /* The unescaped value of @line. It is evaluated lazily by svGetValue() and
+     * cached, so that looking up the same key again does not unescape the
+     * value again. If unescaping was not necessary, this points to @line,
+     * otherwise it is @value_free (or the empty string, for invalid values). */
+    const char *value;
+    char       *value_free;
+
     /* svSetValue() will clear the dirty flag. */
     bool dirty : 1;
+
+    bool line_owned : 1;
+    bool key_owned : 1;
 };
 
 typedef struct _shvarLine shvarLine;
 
 struct _shvarFile {
     char       *fileName;
+    char       *content;
     CList       lst_head;
     GHashTable *lst_idx;
     int         fd;
@@ -71,7 +86,7 @@ struct _shvarFile {
 
 /*****************************************************************************/
 
-static void _line_link_parse(shvarFile *s, const char *value, gsize len);
+static void _line_link_parse(shvarFile *s, char *value, gsize len);
 
 /*****************************************************************************/
 
@@ -702,12 +717,12 @@ out_error:
 
 /*****************************************************************************/
 
-shvarFile *
-svFile_new(const char *name, int fd, const char *content)
+static shvarFile *
+_svFile_new_take(const char *name, int fd, char *content_take)
 {
-    shvarFile  *s;
-    const char *p;
-    const char *q;
+    shvarFile *s;
+    char      *p;
+    char      *q;
 
     nm_assert(name);
     nm_assert(fd >= -1);
@@ -715,13 +730,16 @@ svFile_new(const char *name, int fd, const char *content)
     s  = g_slice_new(shvarFile);
     *s = (shvarFile){
         .fileName = g_strdup(name),
+        .content  = content_take,
         .fd       = fd,
         .lst_head = C_LIST_INIT(s->lst_head),
         .lst_idx  = g_hash_table_new(nm_pstr_hash, nm_pstr_equal),
     };
 
-    if (content) {
-        for (p = content; (q = strchr(p, '\n')) != NULL; p = q + 1)
+    if (s->content) {
+        /* The lines are parsed in place. _line_link_parse() terminates them
+         * inside s->content, so that we don't need to clone each line. */
+        for (p = s->content; (q = strchr(p, '\n')) != NULL; p = q + 1)
             _line_link_parse(s, p, q - p);
         if (p[0])
             _line_link_parse(s, p, strlen(p));
@@ -730,6 +748,12 @@ svFile_new(const char *name, int fd, const char *content)
     return s;
 }
 
+shvarFile *
+svFile_new(const char *name, int fd, const char *content)
+{
+    return _svFile_new_take(name, fd, g_strdup(content));
+}
+
 const char *
 svFileGetName(const shvarFile *s)
 {
@@ -779,12 +803,17 @@ ASSERT_shvarLine(const shvarLine *line)
 }
 
 static shvarLine *
-line_new_parse(const char *value, gsize len)
+line_new_parse(char *value, gsize len)
 {
     shvarLine *line;
     gsize      k, e;
 
     nm_assert(value);
+    nm_assert(NM_IN_SET(value[len], '\0', '\n'));
+
+    /* @value points into the content of the shvarFile, which we may modify.
+     * Terminate the line in place. */
+    value[len] = '\0';
 
     line  = g_slice_new(shvarLine);
     *line = (shvarLine){
@@ -800,8 +829,9 @@ line_new_parse(const char *value, gsize len)
             for (e = k + 1; e < len; e++) {
                 if (value[e] == '=') {
                     nm_assert(_shell_is_name(&value[k], e - k));
-                    line->line            = g_strndup(&value[e + 1], len - e - 1);
-                    line->key_with_prefix = g_strndup(value, e);
+                    value[e]              = '\0';
+                    line->line            = &value[e + 1];
+                    line->key_with_prefix = value;
                     line->key             = &line->key_with_prefix[k];
                     ASSERT_shvarLine(line);
                     return line;
@@ -812,7 +842,7 @@ line_new_parse(const char *value, gsize len)
         }
         break;
     }
-    line->line = g_strndup(value, len);
+    line->line = value;
     ASSERT_shvarLine(line);
     return line;
 }
@@ -833,11 +863,50 @@ line_new_build(const char *key, const char *value)
                                  .key_with_prefix = new_key,
                                  .key             = new_key,
                                  .dirty           = FALSE,
+                                 .line_owned      = TRUE,
+                                 .key_owned       = TRUE,
                              };
     ASSERT_shvarLine(line);
     return line;
 }
 
+static gboolean
+_line_clear_value(shvarLine *line)
+{
+    line->value = NULL;
+    nm_clear_g_free(&line->value_free);
+
+    if (!line->line)
+        return FALSE;
+
+    if (line->line_owned)
+        g_free(line->line);
+    line->line       = NULL;
+    line->line_owned = FALSE;
+    return TRUE;
+}
+
+static const char *
+_line_get_value(shvarLine *line)
+{
+    const char *v;
+
+    nm_assert(line->line);
+
+    if (!line->value) {
+        nm_assert(!line->value_free);
+        v = svUnescape(line->line, &line->value_free);
+        if (!v) {
+            /* a wrongly quoted value or non-UTF-8 is treated like the empty string.
+             * See also svWriteFile(), which handles unparsable values that way. */
+            nm_assert(!line->value_free);
+            v = "";
+        }
+        line->value = v;
+    }
+    return line->value;
+}
+
 static gboolean
 line_set(shvarLine *line, const char *value)
 {
@@ -863,10 +932,11 @@ line_set(shvarLine *line, const char *value)
             g_free(value_escaped);
             return changed;
         }
-        g_free(line->line);
+        _line_clear_value(line);
     }
 
-    line->line = value_escaped ?: g_strdup(value);
+    line->line       = value_escaped ?: g_strdup(value);
+    line->line_owned = TRUE;
     ASSERT_shvarLine(line);
     return TRUE;
 }
@@ -876,15 +946,16 @@ line_free(shvarLine *line)
 {
     ASSERT_shvarLine(line);
     c_list_unlink_stale(&line->lst);
-    g_free(line->line);
-    g_free(line->key_with_prefix);
+    _line_clear_value(line);
+    if (line->key_owned)
+        g_free(line->key_with_prefix);
     g_slice_free(shvarLine, line);
 }
 
 /*****************************************************************************/
 
 static void
-_line_link_parse(shvarFile *s, const char *value, gsize len)
+_line_link_parse(shvarFile *s, char *value, gsize len)
 {
     shvarLine *line;
 
@@ -979,7 +1050,7 @@ svOpenFileInternal(const char *name, gboolean create, GError **error)
     /* closefd is set if we opened the file read-only, so go ahead and
      * close it, because we can't write to it anyway */
     nm_assert(closefd || fd >= 0);
-    return svFile_new(name, !closefd ? nm_steal_fd(&fd) : -1, content);
+    return _svFile_new_take(name, !closefd ? nm_steal_fd(&fd) : -1, g_steal_pointer(&content));
 }
 
 /* Open the file <name>, return shvarFile on success, NULL on failure */
@@ -1136,8 +1207,7 @@ svFindFirstNumberedKey(shvarFile *s, const char *key_prefix)
 static const char *
 _svGetValue(shvarFile *s, const char *key, char **to_free)
 {
-    const shvarLine *line;
-    const char      *v;
+    shvarLine *line;
 
     nm_assert(s);
     nm_assert(_shell_is_name(key, -1));
@@ -1147,17 +1217,9 @@ _svGetValue(shvarFile *s, const char *key, char **to_free)
 
     line = g_hash_table_lookup(s->lst_idx, &key);
 
-    if (line && line->line) {
-        v = svUnescape(line->line, to_free);
-        if (!v) {
-            /* a wrongly quoted value or non-UTF-8 is treated like the empty string.
-             * See also svWriteFile(), which handles unparsable values that way. */
-            nm_assert(!*to_free);
-            return "";
-        }
-        return v;
-    }
     *to_free = NULL;
+    if (line && line->line)
+        return _line_get_value(line);
     return NULL;
 }
 
@@ -1362,7 +1424,7 @@ svUnsetAll(shvarFile *s, SvKeyType match_key_type)
     c_list_for_each_entry (line, &s->lst_head, lst) {
         ASSERT_shvarLine(line);
         if (line->key && _svKeyMatchesType(line->key, match_key_type)) {
-            if (nm_clear_g_free(&line->line)) {
+            if (_line_clear_value(line)) {
                 ASSERT_shvarLine(line);
                 changed = TRUE;
             }
@@ -1390,7 +1452,7 @@ svUnsetDirtyWellknown(shvarFile *s, NMTernary new_dirty_value)
         if (line->dirty && line->key && line->line
             && (ti = nms_ifcfg_rh_utils_is_well_known_key(line->key))
             && !NM_FLAGS_HAS(ti->key_flags, NMS_IFCFG_KEY_TYPE_KEEP_WHEN_DIRTY)) {
-            if (nm_clear_g_free(&line->line)) {
+            if (_line_clear_value(line)) {
                 ASSERT_shvarLine(line);
                 changed = TRUE;
             }
@@ -1439,7 +1501,7 @@ svSetValue(shvarFile *s, const char *key, const char *value)
         if (line) {
             /* We only clear the value, but leave the line entry. This way, if we
              * happen to re-add the value, we write it to the same line again. */
-            if (nm_clear_g_free(&line->line)) {
+            if (_line_clear_value(line)) {
                 changed = TRUE;
             }
         }
@@ -1723,5 +1785,6 @@ svCloseFile(shvarFile *s)
     g_hash_table_destroy(s->lst_idx);
     while ((line = c_list_first_entry(&s->lst_head, shvarLine, lst)))
         line_free(line);
+    g_free(s->content);
     g_slice_free(shvarFile, s);
 }
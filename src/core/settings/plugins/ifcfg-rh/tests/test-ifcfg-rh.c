@@ -2774,6 +2774,106 @@ test_ifcfg_no_trailing_newline(void)
     svCloseFile(sv);
 }
 
+static void
+test_svfile_value_cache(void)
+{
+    shvarFile  *sv;
+    const char *v1;
+    const char *v2;
+    char       *to_free1 = NULL;
+    char       *to_free2 = NULL;
+
+    sv = svFile_new(TEST_SCRATCH_DIR "/ifcfg-value-cache",
+                    -1,
+                    "DEVICE=eth0\n"
+                    "NAME=\"quoted name\"\n"
+                    "# comment\n"
+                    "BOOTPROTO='dhcp'");
+
+    /* the unescaped value is cached and owned by @sv. */
+    v1 = svGetValue(sv, "NAME", &to_free1);
+    g_assert_cmpstr(v1, ==, "quoted name");
+    g_assert(!to_free1);
+    v2 = svGetValue(sv, "NAME", &to_free2);
+    g_assert(v1 == v2);
+    g_assert(!to_free2);
+
+    _svGetValue_check(sv, "DEVICE", "eth0");
+    _svGetValue_check(sv, "BOOTPROTO", "dhcp");
+
+    svSetValue(sv, "NAME", "new name");
+    _svGetValue_check(sv, "NAME", "new name");
+    svSetValue(sv, "NAME", NULL);
+    _svGetValue_check(sv, "NAME", NULL);
+
+    svCloseFile(sv);
+}
+
+static void
+test_svfile_parse_performance(void)
+{
+    static const char *const KEYS[] = {
+        "DEVICE",
+        "TYPE",
+        "NAME",
+        "UUID",
+        "ONBOOT",
+        "BOOTPROTO",
+        "HWADDR",
+        "IPADDR",
+        "NETMASK",
+        "GATEWAY",
+        "DNS1",
+        "DOMAIN",
+    };
+    const guint                  N_FILES   = 10000;
+    gs_unref_ptrarray GPtrArray *filenames = NULL;
+    const char                  *filename;
+    GDir                        *dir;
+    gint64                       start_time;
+    guint                        n_values = 0;
+    guint                        i;
+
+    if (nmtst_test_skip_slow())
+        return;
+
+    filenames = g_ptr_array_new_with_free_func(g_free);
+    dir       = g_dir_open(TEST_IFCFG_DIR, 0, NULL);
+    g_assert(dir);
+    while ((filename = g_dir_read_name(dir))) {
+        if (NM_STR_HAS_PREFIX(filename, "ifcfg-"))
+            g_ptr_array_add(filenames, g_build_filename(TEST_IFCFG_DIR, filename, NULL));
+    }
+    g_dir_close(dir);
+    g_assert_cmpint(filenames->len, >, 0);
+
+    /* parse the test files over and over, until we parsed N_FILES. Like the reader,
+     * look up each key more than once. */
+    start_time = nmtst_benchmark_start();
+    for (i = 0; i < N_FILES; i++) {
+        shvarFile *sv;
+        guint      j;
+        guint      k;
+
+        sv = _svOpenFile(filenames->pdata[i % filenames->len]);
+        for (k = 0; k < 2; k++) {
+            for (j = 0; j < G_N_ELEMENTS(KEYS); j++) {
+                gs_free char *to_free = NULL;
+
+                if (svGetValue(sv, KEYS[j], &to_free))
+                    n_values++;
+            }
+        }
+        svCloseFile(sv);
+    }
+    nmtst_benchmark_report(start_time,
+                           N_FILES,
+                           "files",
+                           "parsed %u ifcfg files (%u values)",
+                           N_FILES,
+                           n_values);
+}
+
 static void
 test_read_wifi_wpa_psk(void)
 {
@@ -10669,6 +10769,8 @@ main(int argc, char **argv)
                          test_write_mobile_broadband);
 
     g_test_add_func(TPATH "no-trailing-newline", test_ifcfg_no_trailing_newline);
+    g_test_add_func(TPATH "svfile/value-cache", test_svfile_value_cache);
+    g_test_add_func(TPATH "svfile/parse-performance", test_svfile_parse_performance);
 
     g_test_add_func(TPATH "utils/name", test_utils_name);
     g_test_add_func(TPATH "utils/path", test_utils_path);
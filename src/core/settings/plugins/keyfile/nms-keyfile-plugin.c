@@ -59,6 +59,17 @@ typedef struct {
 
     NMSettUtilStorages storages;
 
+    /* With "keyfile.incremental-reload", we watch the directories and remember
+     * which files changed. A reload then only re-reads those files. */
+    GPtrArray  *watch_monitors;
+    GHashTable *watch_dirty_filenames;
+
+    bool watch_enabled : 1;
+
+    /* whether we did a full reload while watching the directories. Only
+     * then the dirty-filenames are complete and we can reload incrementally. */
+    bool watch_synced : 1;
+
 } NMSKeyfilePluginPrivate;
 
 struct _NMSKeyfilePlugin {
@@ -462,6 +473,17 @@ _load_dir(NMSKeyfilePlugin     *self,
 
 /*****************************************************************************/
 
+static void _load_connections(NMSKeyfilePlugin                      *self,
+                              NMSettingsPluginConnectionLoadEntry   *entries,
+                              gsize                                  n_entries,
+                              gboolean                               unload_failed,
+                              NMSettingsPluginConnectionLoadCallback callback,
+                              gpointer                               user_data);
+
+static void _watch_stop(NMSKeyfilePlugin *self);
+
+/*****************************************************************************/
+
 static void
 _storages_consolidate(NMSKeyfilePlugin                      *self,
                       NMSettUtilStorages                    *storages_new,
@@ -573,6 +595,176 @@ _storages_consolidate(NMSKeyfilePlugin                      *self,
     }
 }
 
+static gboolean
+_watch_path_is_dir(NMSKeyfilePluginPrivate *priv, const char *path)
+{
+    guint i;
+
+    if (NM_IN_STRSET(path, priv->dirname_run, priv->dirname_etc))
+        return TRUE;
+    for (i = 0; priv->dirname_libs[i]; i++) {
+        if (nm_streq(path, priv->dirname_libs[i]))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static void
+_watch_dir_changed_cb(GFileMonitor     *monitor,
+                      GFile            *file,
+                      GFile            *other_file,
+                      GFileMonitorEvent event_type,
+                      gpointer          user_data)
+{
+    NMSKeyfilePlugin        *self = user_data;
+    NMSKeyfilePluginPrivate *priv = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
+    GFile                   *files[2];
+    guint                    i;
+
+    switch (event_type) {
+    case G_FILE_MONITOR_EVENT_CHANGED:
+    case G_FILE_MONITOR_EVENT_ATTRIBUTE_CHANGED:
+    case G_FILE_MONITOR_EVENT_PRE_UNMOUNT:
+        /* we wait for CHANGES_DONE_HINT, or don't care. */
+        return;
+    case G_FILE_MONITOR_EVENT_UNMOUNTED:
+        _LOGT("watch: directory unmounted. Require full reload");
+        priv->watch_synced = FALSE;
+        return;
+    default:
+        break;
+    }
+
+    files[0] = file;
+    files[1] = other_file;
+    for (i = 0; i < G_N_ELEMENTS(files); i++) {
+        char *path;
+
+        if (!files[i])
+            continue;
+
+        path = g_file_get_path(files[i]);
+        if (!path)
+            continue;
+
+        if (_watch_path_is_dir(priv, path)) {
+            /* the directory itself changed (e.g. it was deleted). We don't know
+             * which files are affected. */
+            _LOGT("watch: directory \"%s\" changed. Require full reload", path);
+            priv->watch_synced = FALSE;
+            g_free(path);
+            continue;
+        }
+
+        _LOGT("watch: \"%s\" changed (event %d)", path, (int) event_type);
+        g_hash_table_add(priv->watch_dirty_filenames, path);
+    }
+}
+
+static void
+_watch_start(NMSKeyfilePlugin *self)
+{
+    NMSKeyfilePluginPrivate *priv = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
+    const char              *dirnames[G_N_ELEMENTS(priv->dirname_libs) + 2];
+    guint                    n_dirnames = 0;
+    guint                    i;
+
+    if (priv->watch_monitors)
+        return;
+
+    dirnames[n_dirnames++] = priv->dirname_run;
+    if (priv->dirname_etc)
+        dirnames[n_dirnames++] = priv->dirname_etc;
+    for (i = 0; priv->dirname_libs[i]; i++)
+        dirnames[n_dirnames++] = priv->dirname_libs[i];
+
+    priv->watch_monitors = g_ptr_array_new_with_free_func(g_object_unref);
+
+    for (i = 0; i < n_dirnames; i++) {
+        gs_unref_object GFile *file  = NULL;
+        gs_free_error GError  *error = NULL;
+        GFileMonitor          *monitor;
+
+        file    = g_file_new_for_path(dirnames[i]);
+        monitor = g_file_monitor_directory(file, G_FILE_MONITOR_NONE, NULL, &error);
+        if (!monitor) {
+            _LOGW("watch: cannot watch directory \"%s\", always do full reload: %s",
+                  dirnames[i],
+                  error->message);
+            priv->watch_enabled = FALSE;
+            _watch_stop(self);
+            return;
+        }
+
+        g_signal_connect(monitor, "changed", G_CALLBACK(_watch_dir_changed_cb), self);
+        g_ptr_array_add(priv->watch_monitors, monitor);
+    }
+
+    _LOGD("watch: watching %u directories for incremental reload", n_dirnames);
+}
+
+static void
+_watch_stop(NMSKeyfilePlugin *self)
+{
+    NMSKeyfilePluginPrivate *priv = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
+    guint                    i;
+
+    if (priv->watch_monitors) {
+        for (i = 0; i < priv->watch_monitors->len; i++) {
+            GFileMonitor *monitor = priv->watch_monitors->pdata[i];
+
+            g_signal_handlers_disconnect_by_func(monitor, _watch_dir_changed_cb, self);
+            g_file_monitor_cancel(monitor);
+        }
+        nm_clear_pointer(&priv->watch_monitors, g_ptr_array_unref);
+    }
+
+    priv->watch_synced = FALSE;
+    if (priv->watch_dirty_filenames)
+        g_hash_table_remove_all(priv->watch_dirty_filenames);
+}
+
+static void
+_reload_connections_incremental(NMSKeyfilePlugin                      *self,
+                                NMSettingsPluginConnectionLoadCallback callback,
+                                gpointer                               user_data)
+{
+    NMSKeyfilePluginPrivate                     *priv      = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
+    gs_unref_hashtable GHashTable               *dirty     = NULL;
+    gs_free const char                         **filenames = NULL;
+    gs_free NMSettingsPluginConnectionLoadEntry *entries   = NULL;
+    gsize                                        n_entries;
+    gsize                                        i;
+
+    dirty                       = g_steal_pointer(&priv->watch_dirty_filenames);
+    priv->watch_dirty_filenames = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, NULL);
+
+    if (g_hash_table_size(dirty) == 0) {
+        _LOGD("reload: no files changed since last reload");
+        return;
+    }
+
+    _LOGD("reload: incrementally reload %u changed files", g_hash_table_size(dirty));
+
+    filenames = nm_strdict_get_keys(dirty, TRUE, NULL);
+    entries   = nm_settings_plugin_create_connection_load_entries(filenames, &n_entries);
+
+    /* _load_connections() handles deleted files (by unloading the profile) and
+     * reloads other files with the same UUID. That is what we need here. A file
+     * that now fails to load is unloaded too, as a full reload would not find it
+     * either. */
+    _load_connections(self, entries, n_entries, TRUE, callback, user_data);
+
+    for (i = 0; i < n_entries; i++) {
+        NMSettingsPluginConnectionLoadEntry *entry = &entries[i];
+
+        if (entry->error) {
+            _LOGT("reload: \"%s\": %s", entry->filename, entry->error->message);
+            g_clear_error(&entry->error);
+        }
+    }
+}
+
 static void
 reload_connections(NMSettingsPlugin                      *plugin,
                    NMSettingsPluginConnectionLoadCallback callback,
@@ -584,6 +776,20 @@ reload_connections(NMSettingsPlugin                      *plugin,
         NM_SETT_UTIL_STORAGES_INIT(storages_new, nms_keyfile_storage_destroy);
     int i;
 
+    if (priv->watch_enabled) {
+        if (priv->watch_synced) {
+            _reload_connections_incremental(self, callback, user_data);
+            return;
+        }
+
+        /* Start watching before reading the directories. Events that arrive
+         * for files that we read below only cause an unnecessary re-read
+         * on the next reload. */
+        _watch_start(self);
+        if (priv->watch_dirty_filenames)
+            g_hash_table_remove_all(priv->watch_dirty_filenames);
+    }
+
     _load_dir(self, NMS_KEYFILE_STORAGE_TYPE_RUN, priv->dirname_run, &storages_new);
     if (priv->dirname_etc)
         _load_dir(self, NMS_KEYFILE_STORAGE_TYPE_ETC, priv->dirname_etc, &storages_new);
@@ -591,16 +797,19 @@ reload_connections(NMSettingsPlugin                      *plugin,
         _load_dir(self, NMS_KEYFILE_STORAGE_TYPE_LIB(i), priv->dirname_libs[i], &storages_new);
 
     _storages_consolidate(self, &storages_new, TRUE, NULL, callback, user_data);
+
+    if (priv->watch_enabled)
+        priv->watch_synced = TRUE;
 }
 
 static void
-load_connections(NMSettingsPlugin                      *plugin,
-                 NMSettingsPluginConnectionLoadEntry   *entries,
-                 gsize                                  n_entries,
-                 NMSettingsPluginConnectionLoadCallback callback,
-                 gpointer                               user_data)
+_load_connections(NMSKeyfilePlugin                      *self,
+                  NMSettingsPluginConnectionLoadEntry   *entries,
+                  gsize                                  n_entries,
+                  gboolean                               unload_failed,
+                  NMSettingsPluginConnectionLoadCallback callback,
+                  gpointer                               user_data)
 {
-    NMSKeyfilePlugin                                   *self = NMS_KEYFILE_PLUGIN(plugin);
     NMSKeyfilePluginPrivate                            *priv = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
     nm_auto_clear_sett_util_storages NMSettUtilStorages storages_new =
         NM_SETT_UTIL_STORAGES_INIT(storages_new, nms_keyfile_storage_destroy);
@@ -676,17 +885,19 @@ load_connections(NMSettingsPlugin                      *plugin,
 
         storage = _load_file(self, f_dirname, f_filename, storage_type, &local);
         if (!storage) {
-            if (nm_utils_file_stat(full_filename, NULL) == -ENOENT) {
-                NMSKeyfileStorage *storage2;
+            gboolean           not_found;
+            NMSKeyfileStorage *storage2;
 
-                /* the file does not exist. We take that as indication to unload the file
-                 * that was previously loaded... */
+            not_found = (nm_utils_file_stat(full_filename, NULL) == -ENOENT);
+            if (not_found || unload_failed) {
+                /* the file does not exist (or cannot be loaded anymore). We take that as
+                 * indication to unload the file that was previously loaded... */
                 storage2 = nm_sett_util_storages_lookup_by_filename(&priv->storages, full_filename);
                 if (storage2)
                     g_hash_table_add(storages_replaced, g_object_ref(storage2));
-                continue;
             }
-            g_propagate_error(&entry->error, g_steal_pointer(&local));
+            if (!not_found)
+                g_propagate_error(&entry->error, g_steal_pointer(&local));
             continue;
         }
 
@@ -741,6 +952,16 @@ load_connections(NMSettingsPlugin                      *plugin,
     _storages_consolidate(self, &storages_new, FALSE, storages_replaced, callback, user_data);
 }
 
+static void
+load_connections(NMSettingsPlugin                      *plugin,
+                 NMSettingsPluginConnectionLoadEntry   *entries,
+                 gsize                                  n_entries,
+                 NMSettingsPluginConnectionLoadCallback callback,
+                 gpointer                               user_data)
+{
+    _load_connections(NMS_KEYFILE_PLUGIN(plugin), entries, n_entries, FALSE, callback, user_data);
+}
+
 gboolean
 nms_keyfile_plugin_add_connection(NMSKeyfilePlugin   *self,
                                   NMConnection       *connection,
@@ -1295,6 +1516,14 @@ constructed(GObject *object)
                                  NM_CONFIG_GET_VALUE_RAW))
         _LOGW("'monitor-connection-files' option is deprecated and has no effect");
 
+    priv->watch_enabled =
+        nm_config_data_get_value_boolean(nm_config_get_data_orig(priv->config),
+                                         NM_CONFIG_KEYFILE_GROUP_KEYFILE,
+                                         NM_CONFIG_KEYFILE_KEY_KEYFILE_INCREMENTAL_RELOAD,
+                                         FALSE);
+    if (priv->watch_enabled)
+        priv->watch_dirty_filenames = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, NULL);
+
     g_signal_connect(G_OBJECT(priv->config),
                      NM_CONFIG_SIGNAL_CONFIG_CHANGED,
                      G_CALLBACK(config_changed_cb),
@@ -1307,6 +1536,26 @@ nms_keyfile_plugin_new(void)
     return g_object_new(NMS_TYPE_KEYFILE_PLUGIN, NULL);
 }
 
+void
+_nms_keyfile_plugin_set_dirnames_for_testing(NMSKeyfilePlugin *self,
+                                             const char       *dirname_run,
+                                             const char       *dirname_etc,
+                                             const char       *dirname_lib)
+{
+    NMSKeyfilePluginPrivate *priv = NMS_KEYFILE_PLUGIN_GET_PRIVATE(self);
+
+    g_return_if_fail(dirname_run && dirname_run[0] == '/');
+
+    /* must be called before the first reload, which starts the watches. */
+    nm_assert(!priv->watch_monitors);
+
+    nm_strdup_reset_take(&priv->dirname_run, nm_path_simplify(g_strdup(dirname_run)));
+    nm_strdup_reset_take(&priv->dirname_etc,
+                         dirname_etc ? nm_path_simplify(g_strdup(dirname_etc)) : NULL);
+    nm_strdup_reset_take(&priv->dirname_libs[0],
+                         dirname_lib ? nm_path_simplify(g_strdup(dirname_lib)) : NULL);
+}
+
 static void
 dispose(GObject *object)
 {
@@ -1316,6 +1565,9 @@ dispose(GObject *object)
     if (priv->config)
         g_signal_handlers_disconnect_by_func(priv->config, config_changed_cb, object);
 
+    _watch_stop(self);
+    nm_clear_pointer(&priv->watch_dirty_filenames, g_hash_table_destroy);
+
     nm_sett_util_storages_clear(&priv->storages);
 
     nm_clear_g_free(&priv->dirname_libs[0]);
@@ -30,6 +30,11 @@ GType nms_keyfile_plugin_get_type(void);
 
 NMSKeyfilePlugin *nms_keyfile_plugin_new(void);
 
+void _nms_keyfile_plugin_set_dirnames_for_testing(NMSKeyfilePlugin *self,
+                                                  const char       *dirname_run,
+                                                  const char       *dirname_etc,
+                                                  const char       *dirname_lib);
+
 gboolean nms_keyfile_plugin_add_connection(NMSKeyfilePlugin   *self,
                                            NMConnection       *connection,
                                            gboolean            in_memory,
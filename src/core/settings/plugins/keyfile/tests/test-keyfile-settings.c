@@ -21,6 +21,8 @@
 #include "settings/plugins/keyfile/nms-keyfile-reader.h"
 #include "settings/plugins/keyfile/nms-keyfile-writer.h"
 #include "settings/plugins/keyfile/nms-keyfile-utils.h"
+#include "settings/plugins/keyfile/nms-keyfile-plugin.h"
+#include "nm-config.h"
 
 #include "nm-test-utils-core.h"
 
@@ -2827,6 +2829,190 @@ test_nmmeta(void)
 
 /*****************************************************************************/
 
+static NMConfig *
+_setup_config(const char *config_file)
+{
+    const char *argv_data[] = {
+        "test-keyfile-settings",
+        "--config",
+        config_file,
+        "--intern-config",
+        "",
+        "--config-dir",
+        "/no/such/dir",
+        "--system-config-dir",
+        "",
+        NULL,
+    };
+    char                  **argv  = (char **) argv_data;
+    int                     argc  = G_N_ELEMENTS(argv_data) - 1;
+    gs_free_error GError   *error = NULL;
+    NMConfigCmdLineOptions *cli;
+    GOptionContext         *context;
+    NMConfig               *config;
+
+    cli     = nm_config_cmd_line_options_new(FALSE);
+    context = g_option_context_new(NULL);
+    nm_config_cmd_line_options_add_to_entries(cli, context);
+    g_assert(g_option_context_parse(context, &argc, &argv, NULL));
+    g_option_context_free(context);
+
+    config = nm_config_setup(cli, NULL, &error);
+    g_assert_no_error(error);
+    g_assert(config);
+    nm_config_cmd_line_options_free(cli);
+    return config;
+}
+
+static void
+_write_keyfile(const char *dirname, const char *name, const char *contents)
+{
+    gs_free char         *filename = g_build_filename(dirname, name, NULL);
+    gs_free_error GError *error    = NULL;
+
+    nm_utils_file_set_contents(filename, contents, -1, 0600, NULL, NULL, &error);
+    g_assert_no_error(error);
+}
+
+static void
+_write_keyfile_profile(const char *dirname, const char *name, const char *uuid, const char *id)
+{
+    gs_free char *contents = NULL;
+
+    contents = g_strdup_printf("[connection]\n"
+                               "id=%s\n"
+                               "uuid=%s\n"
+                               "type=ethernet\n",
+                               id,
+                               uuid);
+    _write_keyfile(dirname, name, contents);
+}
+
+static void
+_reload_cb(NMSettingsPlugin  *plugin,
+           NMSettingsStorage *storage,
+           NMConnection      *connection,
+           gpointer           user_data)
+{
+    GHashTable *loaded = user_data;
+
+    if (connection) {
+        g_hash_table_insert(loaded,
+                            g_strdup(nm_settings_storage_get_uuid(storage)),
+                            g_strdup(nm_connection_get_id(connection)));
+    } else
+        g_hash_table_remove(loaded, nm_settings_storage_get_uuid(storage));
+}
+
+/* @expected is a NULL terminated list of UUID and ID pairs. */
+static gboolean
+_reload_and_check(NMSettingsPlugin *plugin, GHashTable *loaded, const char *const *expected)
+{
+    guint n;
+
+    nm_settings_plugin_reload_connections(plugin, _reload_cb, loaded);
+
+    for (n = 0; expected[n]; n += 2) {
+        if (!nm_streq0(g_hash_table_lookup(loaded, expected[n]), expected[n + 1]))
+            return FALSE;
+    }
+    return g_hash_table_size(loaded) == n / 2;
+}
+
+#define UUID_A "a6a5e1fc-6b9c-4d0e-9f5c-000000000001"
+#define UUID_B "a6a5e1fc-6b9c-4d0e-9f5c-000000000002"
+#define UUID_C "a6a5e1fc-6b9c-4d0e-9f5c-000000000003"
+#define UUID_D "a6a5e1fc-6b9c-4d0e-9f5c-000000000004"
+
+static void
+test_incremental_reload(void)
+{
+    gs_unref_object NMConfig         *config  = NULL;
+    gs_unref_object NMSKeyfilePlugin *plugin  = NULL;
+    gs_unref_hashtable GHashTable    *loaded  = NULL;
+    gs_free_error GError             *error   = NULL;
+    gs_free char                     *tmpdir  = NULL;
+    gs_free char                     *conf    = NULL;
+    gs_free char                     *dir_run = NULL;
+    gs_free char                     *dir_etc = NULL;
+
+    tmpdir = g_dir_make_tmp("nm-test-keyfile-XXXXXX", &error);
+    g_assert_no_error(error);
+    conf    = g_build_filename(tmpdir, "NetworkManager.conf", NULL);
+    dir_run = g_build_filename(tmpdir, "run", NULL);
+    dir_etc = g_build_filename(tmpdir, "etc", NULL);
+    g_assert_cmpint(g_mkdir(dir_run, 0755), ==, 0);
+    g_assert_cmpint(g_mkdir(dir_etc, 0755), ==, 0);
+
+    _write_keyfile(tmpdir, "NetworkManager.conf", "[keyfile]\nincremental-reload=true\n");
+    config = _setup_config(conf);
+
+    _write_keyfile_profile(dir_etc, "a.nmconnection", UUID_A, "a");
+    _write_keyfile_profile(dir_etc, "b.nmconnection", UUID_B, "b");
+    _write_keyfile_profile(dir_run, "d.nmconnection", UUID_D, "d");
+
+    plugin = nms_keyfile_plugin_new();
+    _nms_keyfile_plugin_set_dirnames_for_testing(plugin, dir_run, dir_etc, NULL);
+    loaded = g_hash_table_new_full(nm_str_hash, g_str_equal, g_free, g_free);
+
+    /* The first reload reads everything and starts watching the directories. */
+    g_assert(_reload_and_check(NM_SETTINGS_PLUGIN(plugin),
+                               loaded,
+                               NM_MAKE_STRV(UUID_A, "a", UUID_B, "b", UUID_D, "d")));
+
+    /* Without changes, nothing is reloaded. */
+    g_assert(_reload_and_check(NM_SETTINGS_PLUGIN(plugin),
+                               loaded,
+                               NM_MAKE_STRV(UUID_A, "a", UUID_B, "b", UUID_D, "d")));
+
+    /* Add, modify and delete files. The watch events arrive asynchronously, so
+     * reload until all are seen. */
+    _write_keyfile_profile(dir_etc, "c.nmconnection", UUID_C, "c");
+    _write_keyfile_profile(dir_etc, "a.nmconnection", UUID_A, "a-modified");
+    g_assert_cmpint(unlink(nm_sprintf_bufa(1024, "%s/b.nmconnection", dir_etc)), ==, 0);
+
+    nmtst_main_context_iterate_until_assert_full(
+        NULL,
+        5000,
+        50,
+        _reload_and_check(NM_SETTINGS_PLUGIN(plugin),
+                          loaded,
+                          NM_MAKE_STRV(UUID_A, "a-modified", UUID_C, "c", UUID_D, "d")));
+
+    /* A file that fails to parse gets unloaded. Let the event arrive first, so that
+     * the file is read (and warned about) only once. */
+    _write_keyfile(dir_run, "d.nmconnection", "this is not a keyfile\n");
+    nmtst_main_context_iterate_until(NULL, 300, FALSE);
+
+    NMTST_EXPECT_NM_WARN("*d.nmconnection*failed to load connection*");
+    g_assert(_reload_and_check(NM_SETTINGS_PLUGIN(plugin),
+                               loaded,
+                               NM_MAKE_STRV(UUID_A, "a-modified", UUID_C, "c")));
+    g_test_assert_expected_messages();
+
+    /* A file that parses again is loaded again. */
+    _write_keyfile_profile(dir_run, "d.nmconnection", UUID_D, "d-fixed");
+    nmtst_main_context_iterate_until_assert_full(
+        NULL,
+        5000,
+        50,
+        _reload_and_check(NM_SETTINGS_PLUGIN(plugin),
+                          loaded,
+                          NM_MAKE_STRV(UUID_A, "a-modified", UUID_C, "c", UUID_D, "d-fixed")));
+
+    g_clear_object(&plugin);
+
+    (void) unlink(nm_sprintf_bufa(1024, "%s/a.nmconnection", dir_etc));
+    (void) unlink(nm_sprintf_bufa(1024, "%s/c.nmconnection", dir_etc));
+    (void) unlink(nm_sprintf_bufa(1024, "%s/d.nmconnection", dir_run));
+    (void) rmdir(dir_etc);
+    (void) rmdir(dir_run);
+    (void) unlink(conf);
+    (void) rmdir(tmpdir);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -2928,6 +3114,7 @@ main(int argc, char **argv)
                     test_nm_keyfile_plugin_utils_escape_filename);
 
     g_test_add_func("/keyfile/test_nmmeta", test_nmmeta);
+    g_test_add_func("/keyfile/test_incremental_reload", test_incremental_reload);
 
     return g_test_run();
 }
@@ -14,6 +14,7 @@
 
 struct _NMTestDevice {
     NMDevice parent;
+    char    *s390_subchannels;
 };
 
 struct _NMTestDeviceClass {
@@ -32,6 +33,18 @@ get_generic_capabilities(NMDevice *device)
     return NM_DEVICE_CAP_IS_NON_KERNEL;
 }
 
+static const char *
+get_s390_subchannels(NMDevice *device)
+{
+    return NM_TEST_DEVICE(device)->s390_subchannels;
+}
+
+void
+nm_test_device_set_s390_subchannels(NMDevice *device, const char *s390_subchannels)
+{
+    nm_strdup_reset(&NM_TEST_DEVICE(device)->s390_subchannels, s390_subchannels);
+}
+
 /*****************************************************************************/
 
 static void
@@ -50,6 +63,8 @@ constructed(GObject *object)
 static void
 dispose(GObject *object)
 {
+    nm_clear_g_free(&NM_TEST_DEVICE(object)->s390_subchannels);
+
     PARENT_CLASS->dispose(object);
 }
 
@@ -76,4 +91,5 @@ nm_test_device_class_init(NMTestDeviceClass *klass)
     object_class->dispose     = dispose;
 
     device_class->get_generic_capabilities = get_generic_capabilities;
+    device_class->get_s390_subchannels     = get_s390_subchannels;
 }
@@ -24,4 +24,6 @@ GType nm_test_device_get_type(void);
 
 NMDevice *nm_test_device_new(const char *hwaddr);
 
+void nm_test_device_set_s390_subchannels(NMDevice *device, const char *s390_subchannels);
+
 #endif /* __NETWORKMANAGER_TEST_DEVICE_H__ */
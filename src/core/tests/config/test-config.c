@@ -253,6 +253,67 @@ test_config_simple(void)
     g_assert_cmpstr(cvalue, ==, "60");
 }
 
+static void
+_assert_match_cache(NMConfigData *config_data,
+                    NMDevice     *device,
+                    const char   *expected,
+                    gboolean      expect_hit)
+{
+    guint64 hits;
+    guint64 evaluations;
+    guint64 hits_after;
+    guint64 evaluations_after;
+
+    _nm_config_data_get_match_cache_stats_for_testing(config_data, &hits, &evaluations);
+    g_assert_cmpstr(nm_config_data_get_connection_default(config_data, "ipv4.route-metric", device),
+                    ==,
+                    expected);
+    _nm_config_data_get_match_cache_stats_for_testing(config_data,
+                                                      &hits_after,
+                                                      &evaluations_after);
+
+    if (expect_hit) {
+        g_assert_cmpint(hits_after, >, hits);
+        g_assert_cmpint(evaluations_after, ==, evaluations);
+    } else {
+        g_assert_cmpint(hits_after, ==, hits);
+        g_assert_cmpint(evaluations_after, >, evaluations);
+    }
+}
+
+static void
+test_config_match_cache(void)
+{
+    gs_unref_object NMConfig *config = NULL;
+    gs_unref_object NMDevice *dev53a = nm_test_device_new("00:00:00:00:00:53");
+    gs_unref_object NMDevice *dev53b = nm_test_device_new("00:00:00:00:00:53");
+    NMConfigData             *config_data;
+
+    config =
+        setup_config(NULL, TEST_DIR "/NetworkManager.conf", "", NULL, "/no/such/dir", "", NULL);
+    config_data = nm_config_get_data_orig(config);
+
+    _assert_match_cache(config_data, dev53a, "50", FALSE);
+    _assert_match_cache(config_data, dev53a, "50", TRUE);
+
+    /* The results only depend on the properties of the device, so a
+     * device that looks the same shares them. */
+    _assert_match_cache(config_data, dev53b, "50", TRUE);
+
+    /* A changed property gives a new result... */
+    nm_test_device_set_s390_subchannels(dev53a, "0.0.1000,0.0.1001,0.0.1002");
+    _assert_match_cache(config_data, dev53a, "53", FALSE);
+    _assert_match_cache(config_data, dev53a, "53", TRUE);
+    _assert_match_cache(config_data, dev53b, "50", TRUE);
+
+    /* ...and changing it back reuses the old one. */
+    nm_test_device_set_s390_subchannels(dev53a, NULL);
+    _assert_match_cache(config_data, dev53a, "50", TRUE);
+
+    nm_test_device_set_s390_subchannels(dev53b, "0.0.1000,0.0.1001,0.0.1002");
+    _assert_match_cache(config_data, dev53b, "53", TRUE);
+}
+
 static void
 test_config_non_existent(void)
 {
@@ -498,6 +559,7 @@ test_config_confdir(void)
 {
     gs_unref_object NMConfig *config  = NULL;
     gs_strfreev char        **plugins = NULL;
+    const GSList             *ignore_devices;
     char                     *value;
     GSList                   *specs;
 
@@ -554,6 +616,17 @@ test_config_confdir(void)
     g_assert_cmpstr(g_slist_nth_data(specs, 1), ==, " space2\t");
     g_slist_free_full(specs, g_free);
 
+    ignore_devices = nm_config_data_get_ignore_devices(nm_config_get_data_orig(config));
+    g_assert_cmpint(g_slist_length((GSList *) ignore_devices), ==, 2);
+    g_assert_cmpstr(g_slist_nth_data((GSList *) ignore_devices, 0), ==, "interface-name:veth*");
+    g_assert_cmpstr(g_slist_nth_data((GSList *) ignore_devices, 1), ==, "driver:veth");
+    g_assert(nm_match_spec_device(ignore_devices, "veth0", NULL, NULL, NULL, NULL, NULL, NULL)
+             == NM_MATCH_SPEC_MATCH);
+    g_assert(nm_match_spec_device(ignore_devices, "eth0", NULL, "veth", NULL, NULL, NULL, NULL)
+             == NM_MATCH_SPEC_MATCH);
+    g_assert(nm_match_spec_device(ignore_devices, "eth0", NULL, "e1000e", NULL, NULL, NULL, NULL)
+             == NM_MATCH_SPEC_NO_MATCH);
+
     value = nm_config_data_get_value(nm_config_get_data_orig(config),
                                      NM_CONFIG_KEYFILE_GROUPPREFIX_TEST_APPEND_STRINGLIST ".0",
                                      "new",
@@ -1363,6 +1436,7 @@ main(int argc, char **argv)
     nm_fake_platform_setup();
 
     g_test_add_func("/config/simple", test_config_simple);
+    g_test_add_func("/config/match-cache", test_config_match_cache);
     g_test_add_func("/config/non-existent", test_config_non_existent);
     g_test_add_func("/config/parse-error", test_config_parse_error);
     g_test_add_func("/config/no-auto-default", test_config_no_auto_default);
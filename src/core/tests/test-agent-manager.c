@@ -0,0 +1,529 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "src/core/nm-default-daemon.h"
+
+#include <unistd.h>
+
+#include "nm-auth-manager.h"
+#include "nm-config.h"
+#include "nm-dbus-manager.h"
+#include "settings/nm-agent-manager.h"
+#include "libnm-core-aux-intern/nm-auth-subject.h"
+#include "libnm-core-intern/nm-core-internal.h"
+
+#include "nm-test-utils-core.h"
+
+/*****************************************************************************/
+
+/* The agents need unique names on a message bus: NMSecretAgent watches them
+ * with NameOwnerChanged. Hence the test runs its own dbus-daemon. */
+static struct {
+    GTestDBus       *test_dbus;
+    GDBusConnection *server;
+    NMConfig        *config;
+    bool             initialized;
+} gl;
+
+static GDBusConnection *
+_bus_connection_new(void)
+{
+    gs_free_error GError *error = NULL;
+    GDBusConnection      *connection;
+
+    connection = g_dbus_connection_new_for_address_sync(
+        g_test_dbus_get_bus_address(gl.test_dbus),
+        G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT
+            | G_DBUS_CONNECTION_FLAGS_MESSAGE_BUS_CONNECTION,
+        NULL,
+        NULL,
+        &error);
+    g_assert_no_error(error);
+    return connection;
+}
+
+static NMConfig *
+_setup_config(const char *config_file)
+{
+    const char *argv_data[] = {
+        "test-agent-manager",
+        "--config",
+        config_file,
+        "--intern-config",
+        "",
+        "--config-dir",
+        "/no/such/dir",
+        "--system-config-dir",
+        "",
+        NULL,
+    };
+    char                  **argv  = (char **) argv_data;
+    int                     argc  = G_N_ELEMENTS(argv_data) - 1;
+    gs_free_error GError   *error = NULL;
+    NMConfigCmdLineOptions *cli;
+    GOptionContext         *context;
+    NMConfig               *config;
+
+    cli     = nm_config_cmd_line_options_new(FALSE);
+    context = g_option_context_new(NULL);
+    nm_config_cmd_line_options_add_to_entries(cli, context);
+    g_assert(g_option_context_parse(context, &argc, &argv, NULL));
+    g_option_context_free(context);
+
+    config = nm_config_setup(cli, NULL, &error);
+    g_assert_no_error(error);
+    g_assert(config);
+    nm_config_cmd_line_options_free(cli);
+    return config;
+}
+
+static gboolean
+_setup(void)
+{
+    gs_free_error GError *error  = NULL;
+    gs_free char         *tmpdir = NULL;
+    gs_free char         *conf   = NULL;
+    gs_free char         *prog   = NULL;
+
+    if (gl.initialized)
+        return !!gl.test_dbus;
+    gl.initialized = TRUE;
+
+    prog = g_find_program_in_path("dbus-daemon");
+    if (!prog)
+        return FALSE;
+
+    gl.test_dbus = g_test_dbus_new(G_TEST_DBUS_NONE);
+    g_test_dbus_up(gl.test_dbus);
+
+    tmpdir = g_dir_make_tmp("nm-test-agent-manager-XXXXXX", &error);
+    g_assert_no_error(error);
+    conf = g_build_filename(tmpdir, "NetworkManager.conf", NULL);
+    nm_utils_file_set_contents(conf,
+                               "[main]\n" NM_CONFIG_KEYFILE_KEY_MAIN_SECRET_AGENTS_PARALLEL
+                               "=true\n",
+                               -1,
+                               0600,
+                               NULL,
+                               NULL,
+                               &error);
+    g_assert_no_error(error);
+    gl.config = _setup_config(conf);
+    (void) unlink(conf);
+    (void) rmdir(tmpdir);
+
+    gl.server = _bus_connection_new();
+    g_assert(_nm_dbus_manager_set_connection_for_testing(nm_dbus_manager_get(), gl.server));
+    nm_dbus_manager_start(nm_dbus_manager_get(), NULL, NULL);
+
+    nm_auth_manager_setup(NM_AUTH_POLKIT_MODE_ROOT_ONLY);
+    return TRUE;
+}
+
+/*****************************************************************************/
+
+static const char *const fake_agent_xml =
+    "<node>"
+    "  <interface name='" NM_DBUS_INTERFACE_SECRET_AGENT "'>"
+    "    <method name='GetSecrets'>"
+    "      <arg name='connection' type='a{sa{sv}}' direction='in'/>"
+    "      <arg name='connection_path' type='o' direction='in'/>"
+    "      <arg name='setting_name' type='s' direction='in'/>"
+    "      <arg name='hints' type='as' direction='in'/>"
+    "      <arg name='flags' type='u' direction='in'/>"
+    "      <arg name='secrets' type='a{sa{sv}}' direction='out'/>"
+    "    </method>"
+    "    <method name='CancelGetSecrets'>"
+    "      <arg name='connection_path' type='o' direction='in'/>"
+    "      <arg name='setting_name' type='s' direction='in'/>"
+    "    </method>"
+    "  </interface>"
+    "</node>";
+
+typedef enum {
+    FAKE_AGENT_SECRETS,
+    FAKE_AGENT_NO_SECRETS,
+    FAKE_AGENT_FAILED,
+    FAKE_AGENT_USER_CANCELED,
+    FAKE_AGENT_HANG,
+} FakeAgentBehavior;
+
+typedef struct {
+    GDBusConnection       *connection;
+    NMSecretAgent         *agent;
+    GDBusMethodInvocation *pending;
+    FakeAgentBehavior      behavior;
+    guint                  registration_id;
+    guint                  delay_id;
+    guint                  delay_msec;
+    guint                  n_get_secrets;
+    guint                  n_cancel;
+} FakeAgent;
+
+static void
+_fake_agent_return_secrets(FakeAgent *fake)
+{
+    g_dbus_method_invocation_return_value(
+        g_steal_pointer(&fake->pending),
+        g_variant_new_parsed("({'802-1x': {'password': <'secret'>}},)"));
+}
+
+static gboolean
+_fake_agent_delay_cb(gpointer user_data)
+{
+    FakeAgent *fake = user_data;
+
+    fake->delay_id = 0;
+    _fake_agent_return_secrets(fake);
+    return G_SOURCE_REMOVE;
+}
+
+static void
+_fake_agent_method_call(GDBusConnection       *connection,
+                        const char            *sender,
+                        const char            *object_path,
+                        const char            *interface_name,
+                        const char            *method_name,
+                        GVariant              *parameters,
+                        GDBusMethodInvocation *invocation,
+                        gpointer               user_data)
+{
+    FakeAgent *fake = user_data;
+
+    if (nm_streq(method_name, "CancelGetSecrets")) {
+        fake->n_cancel++;
+        if (fake->pending) {
+            g_dbus_method_invocation_return_error_literal(g_steal_pointer(&fake->pending),
+                                                          NM_SECRET_AGENT_ERROR,
+                                                          NM_SECRET_AGENT_ERROR_AGENT_CANCELED,
+                                                          "canceled");
+        }
+        g_dbus_method_invocation_return_value(invocation, NULL);
+        return;
+    }
+
+    g_assert_cmpstr(method_name, ==, "GetSecrets");
+    g_assert(!fake->pending);
+
+    fake->n_get_secrets++;
+
+    switch (fake->behavior) {
+    case FAKE_AGENT_SECRETS:
+        fake->pending = invocation;
+        if (fake->delay_msec > 0)
+            fake->delay_id = g_timeout_add(fake->delay_msec, _fake_agent_delay_cb, fake);
+        else
+            _fake_agent_return_secrets(fake);
+        return;
+    case FAKE_AGENT_NO_SECRETS:
+        g_dbus_method_invocation_return_value(invocation, g_variant_new_parsed("(@a{sa{sv}} {},)"));
+        return;
+    case FAKE_AGENT_FAILED:
+        g_dbus_method_invocation_return_error_literal(invocation,
+                                                      NM_SECRET_AGENT_ERROR,
+                                                      NM_SECRET_AGENT_ERROR_FAILED,
+                                                      "failed");
+        return;
+    case FAKE_AGENT_USER_CANCELED:
+        g_dbus_method_invocation_return_error_literal(invocation,
+                                                      NM_SECRET_AGENT_ERROR,
+                                                      NM_SECRET_AGENT_ERROR_USER_CANCELED,
+                                                      "user canceled");
+        return;
+    case FAKE_AGENT_HANG:
+        fake->pending = invocation;
+        return;
+    }
+    g_assert_not_reached();
+}
+
+static const GDBusInterfaceVTable fake_agent_vtable = {
+    .method_call = _fake_agent_method_call,
+};
+
+static FakeAgent *
+_fake_agent_new(const char *identifier, FakeAgentBehavior behavior, guint delay_msec)
+{
+    gs_unref_object NMAuthSubject *subject = NULL;
+    gs_free_error GError          *error   = NULL;
+    GDBusNodeInfo                 *node_info;
+    FakeAgent                     *fake;
+
+    fake  = g_slice_new(FakeAgent);
+    *fake = (FakeAgent){
+        .connection = _bus_connection_new(),
+        .behavior   = behavior,
+        .delay_msec = delay_msec,
+    };
+
+    node_info = g_dbus_node_info_new_for_xml(fake_agent_xml, &error);
+    g_assert_no_error(error);
+    fake->registration_id = g_dbus_connection_register_object(fake->connection,
+                                                              NM_DBUS_PATH_SECRET_AGENT,
+                                                              node_info->interfaces[0],
+                                                              &fake_agent_vtable,
+                                                              fake,
+                                                              NULL,
+                                                              &error);
+    g_assert_no_error(error);
+    g_dbus_node_info_unref(node_info);
+
+    subject = nm_auth_subject_new_unix_process(g_dbus_connection_get_unique_name(fake->connection),
+                                               getpid(),
+                                               getuid());
+    fake->agent = _nm_secret_agent_new_for_testing(gl.server,
+                                                   subject,
+                                                   identifier,
+                                                   NM_SECRET_AGENT_CAPABILITY_NONE);
+    _nm_agent_manager_add_agent_for_testing(nm_agent_manager_get(), fake->agent);
+    return fake;
+}
+
+static void
+_fake_agent_free(FakeAgent *fake)
+{
+    gs_free_error GError *error = NULL;
+
+    g_assert(!fake->pending);
+    g_assert(!fake->delay_id);
+
+    g_dbus_connection_unregister_object(fake->connection, fake->registration_id);
+
+    /* Dropping off the bus makes the agent manager forget the agent. */
+    g_dbus_connection_close_sync(fake->connection, NULL, &error);
+    g_assert_no_error(error);
+    nmtst_main_context_iterate_until_assert(NULL,
+                                            5000,
+                                            c_list_is_empty(&fake->agent->agent_lst));
+
+    g_object_unref(fake->agent);
+    g_object_unref(fake->connection);
+    nm_g_slice_free(fake);
+}
+
+NM_AUTO_DEFINE_FCN0(FakeAgent *, _nm_auto_free_fake_agent, _fake_agent_free);
+#define nm_auto_free_fake_agent nm_auto(_nm_auto_free_fake_agent)
+
+/*****************************************************************************/
+
+typedef struct {
+    GVariant *secrets;
+    GError   *error;
+    char     *agent_dbus_owner;
+    bool      completed;
+} GetSecretsData;
+
+static void
+_get_secrets_cb(NMAgentManager              *manager,
+                NMAgentManagerCallId         call_id,
+                const char                  *agent_dbus_owner,
+                const char                  *agent_uname,
+                gboolean                     agent_has_modify,
+                const char                  *setting_name,
+                NMSecretAgentGetSecretsFlags flags,
+                GVariant                    *secrets,
+                GError                      *error,
+                gpointer                     user_data)
+{
+    GetSecretsData *data = user_data;
+
+    g_assert(!data->completed);
+    g_assert_cmpstr(setting_name, ==, NM_SETTING_802_1X_SETTING_NAME);
+
+    data->completed        = TRUE;
+    data->secrets          = nm_g_variant_ref(secrets);
+    data->error            = error ? g_error_copy(error) : NULL;
+    data->agent_dbus_owner = g_strdup(agent_dbus_owner);
+}
+
+static void
+_get_secrets(GetSecretsData *data)
+{
+    gs_unref_object NMConnection  *connection = NULL;
+    gs_unref_object NMAuthSubject *subject    = NULL;
+
+    connection = nmtst_create_minimal_connection("test-agent-manager",
+                                                 NULL,
+                                                 NM_SETTING_WIRED_SETTING_NAME,
+                                                 NULL);
+    subject    = nm_auth_subject_new_internal();
+
+    *data = (GetSecretsData){};
+    nm_agent_manager_get_secrets(nm_agent_manager_get(),
+                                 "/org/freedesktop/NetworkManager/Settings/1",
+                                 connection,
+                                 subject,
+                                 NULL,
+                                 NM_SETTING_802_1X_SETTING_NAME,
+                                 NM_SECRET_AGENT_GET_SECRETS_FLAG_NONE,
+                                 NULL,
+                                 _get_secrets_cb,
+                                 data);
+    nmtst_main_context_iterate_until_assert(NULL, 5000, data->completed);
+}
+
+static void
+_get_secrets_data_clear(GetSecretsData *data)
+{
+    nm_clear_pointer(&data->secrets, g_variant_unref);
+    g_clear_error(&data->error);
+    nm_clear_g_free(&data->agent_dbus_owner);
+}
+
+static void
+_assert_stats(FakeAgent *fake, guint64 n_calls, guint64 n_succeeded)
+{
+    g_assert_cmpint(fake->agent->stats.n_calls, ==, n_calls);
+    g_assert_cmpint(fake->agent->stats.n_succeeded, ==, n_succeeded);
+    g_assert_cmpint(fake->agent->stats.latency_sum_msec,
+                    >=,
+                    fake->agent->stats.latency_max_msec);
+}
+
+/*****************************************************************************/
+
+static void
+test_parallel_first_wins(void)
+{
+    nm_auto_free_fake_agent FakeAgent *a = NULL;
+    nm_auto_free_fake_agent FakeAgent *b = NULL;
+    nm_auto_free_fake_agent FakeAgent *c = NULL;
+    GetSecretsData                     data;
+    gs_unref_variant GVariant         *setting = NULL;
+    const char                        *password;
+
+    if (!_setup()) {
+        g_test_skip("dbus-daemon not available");
+        return;
+    }
+
+    a = _fake_agent_new("org.nmtst.a", FAKE_AGENT_HANG, 0);
+    b = _fake_agent_new("org.nmtst.b", FAKE_AGENT_SECRETS, 50);
+    c = _fake_agent_new("org.nmtst.c", FAKE_AGENT_HANG, 0);
+
+    _get_secrets(&data);
+
+    g_assert_no_error(data.error);
+    g_assert_cmpstr(data.agent_dbus_owner,
+                    ==,
+                    g_dbus_connection_get_unique_name(b->connection));
+    setting = g_variant_lookup_value(data.secrets,
+                                     NM_SETTING_802_1X_SETTING_NAME,
+                                     NM_VARIANT_TYPE_SETTING);
+    g_assert(setting);
+    g_assert(g_variant_lookup(setting, "password", "&s", &password));
+    g_assert_cmpstr(password, ==, "secret");
+
+    /* All agents were asked at once, and the answer cancelled the others. */
+    g_assert_cmpint(a->n_get_secrets, ==, 1);
+    g_assert_cmpint(b->n_get_secrets, ==, 1);
+    g_assert_cmpint(c->n_get_secrets, ==, 1);
+    nmtst_main_context_iterate_until_assert(NULL, 5000, a->n_cancel == 1 && c->n_cancel == 1);
+    g_assert_cmpint(b->n_cancel, ==, 0);
+
+    /* Only the answered call counts, with at least the delay of the agent. */
+    _assert_stats(a, 0, 0);
+    _assert_stats(b, 1, 1);
+    _assert_stats(c, 0, 0);
+    g_assert_cmpint(b->agent->stats.latency_max_msec, >=, 50);
+    g_assert_cmpint(b->agent->stats.latency_sum_msec, ==, b->agent->stats.latency_max_msec);
+
+    _get_secrets_data_clear(&data);
+}
+
+static void
+test_parallel_no_secrets(void)
+{
+    nm_auto_free_fake_agent FakeAgent *a = NULL;
+    nm_auto_free_fake_agent FakeAgent *b = NULL;
+    GetSecretsData                     data;
+
+    if (!_setup()) {
+        g_test_skip("dbus-daemon not available");
+        return;
+    }
+
+    a = _fake_agent_new("org.nmtst.a", FAKE_AGENT_FAILED, 0);
+    b = _fake_agent_new("org.nmtst.b", FAKE_AGENT_NO_SECRETS, 0);
+
+    _get_secrets(&data);
+
+    g_assert_error(data.error, NM_AGENT_MANAGER_ERROR, NM_AGENT_MANAGER_ERROR_NO_SECRETS);
+    g_assert(!data.secrets);
+    g_assert(!data.agent_dbus_owner);
+
+    g_assert_cmpint(a->n_get_secrets, ==, 1);
+    g_assert_cmpint(b->n_get_secrets, ==, 1);
+    _assert_stats(a, 1, 0);
+    _assert_stats(b, 1, 0);
+
+    /* A failing agent stays registered and is asked again. */
+    _get_secrets_data_clear(&data);
+    b->behavior   = FAKE_AGENT_SECRETS;
+    b->delay_msec = 50;
+    _get_secrets(&data);
+    g_assert_no_error(data.error);
+    g_assert_cmpstr(data.agent_dbus_owner,
+                    ==,
+                    g_dbus_connection_get_unique_name(b->connection));
+    _assert_stats(a, 2, 0);
+    _assert_stats(b, 2, 1);
+
+    _get_secrets_data_clear(&data);
+}
+
+static void
+test_parallel_user_canceled(void)
+{
+    nm_auto_free_fake_agent FakeAgent *a = NULL;
+    nm_auto_free_fake_agent FakeAgent *b = NULL;
+    GetSecretsData                     data;
+
+    if (!_setup()) {
+        g_test_skip("dbus-daemon not available");
+        return;
+    }
+
+    a = _fake_agent_new("org.nmtst.a", FAKE_AGENT_HANG, 0);
+    b = _fake_agent_new("org.nmtst.b", FAKE_AGENT_USER_CANCELED, 0);
+
+    /* Like in serial mode, the user canceling ends the request right away,
+     * without waiting for the other agents. */
+    _get_secrets(&data);
+
+    g_assert_error(data.error, NM_AGENT_MANAGER_ERROR, NM_AGENT_MANAGER_ERROR_USER_CANCELED);
+    g_assert(!data.secrets);
+
+    nmtst_main_context_iterate_until_assert(NULL, 5000, a->n_cancel == 1);
+    g_assert_cmpint(b->n_cancel, ==, 0);
+    _assert_stats(a, 0, 0);
+    _assert_stats(b, 1, 0);
+
+    _get_secrets_data_clear(&data);
+}
+
+/*****************************************************************************/
+
+NMTST_DEFINE();
+
+int
+main(int argc, char **argv)
+{
+    int result;
+
+    nmtst_init_with_logging(&argc, &argv, NULL, "ALL");
+
+    g_test_add_func("/agent-manager/parallel/first-wins", test_parallel_first_wins);
+    g_test_add_func("/agent-manager/parallel/no-secrets", test_parallel_no_secrets);
+    g_test_add_func("/agent-manager/parallel/user-canceled", test_parallel_user_canceled);
+
+    result = g_test_run();
+
+    if (gl.test_dbus) {
+        g_clear_object(&gl.server);
+        g_test_dbus_down(gl.test_dbus);
+        g_clear_object(&gl.test_dbus);
+    }
+    g_clear_object(&gl.config);
+
+    return result;
+}
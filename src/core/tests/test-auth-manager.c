@@ -0,0 +1,199 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "src/core/nm-default-daemon.h"
+
+#include "nm-auth-manager.h"
+#include "nm-dbus-manager.h"
+#include "libnm-core-aux-intern/nm-auth-subject.h"
+
+#include "nm-test-utils-core.h"
+
+/*****************************************************************************/
+
+#define POLKIT_OBJECT_PATH "/org/freedesktop/PolicyKit1/Authority"
+
+static const char *const fake_polkit_xml =
+    "<node>"
+    "  <interface name='org.freedesktop.PolicyKit1.Authority'>"
+    "    <method name='CheckAuthorization'>"
+    "      <arg name='subject' type='(sa{sv})' direction='in'/>"
+    "      <arg name='action_id' type='s' direction='in'/>"
+    "      <arg name='details' type='a{ss}' direction='in'/>"
+    "      <arg name='flags' type='u' direction='in'/>"
+    "      <arg name='cancellation_id' type='s' direction='in'/>"
+    "      <arg name='result' type='(bba{ss})' direction='out'/>"
+    "    </method>"
+    "  </interface>"
+    "</node>";
+
+typedef struct {
+    guint n_calls;
+    bool  is_authorized;
+    bool  is_challenge;
+
+    /* an optional key of the result details, with value "true". */
+    const char *detail;
+} FakePolkit;
+
+static void
+_fake_polkit_method_call(GDBusConnection       *connection,
+                         const char            *sender,
+                         const char            *object_path,
+                         const char            *interface_name,
+                         const char            *method_name,
+                         GVariant              *parameters,
+                         GDBusMethodInvocation *invocation,
+                         gpointer               user_data)
+{
+    FakePolkit     *polkit = user_data;
+    GVariantBuilder builder;
+
+    g_assert_cmpstr(method_name, ==, "CheckAuthorization");
+
+    polkit->n_calls++;
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a{ss}"));
+    if (polkit->detail)
+        g_variant_builder_add(&builder, "{ss}", polkit->detail, "true");
+
+    g_dbus_method_invocation_return_value(invocation,
+                                          g_variant_new("((bba{ss}))",
+                                                        (gboolean) polkit->is_authorized,
+                                                        (gboolean) polkit->is_challenge,
+                                                        &builder));
+}
+
+static const GDBusInterfaceVTable fake_polkit_vtable = {
+    .method_call = _fake_polkit_method_call,
+};
+
+/*****************************************************************************/
+
+typedef struct {
+    bool completed;
+    bool is_authorized;
+} CheckData;
+
+static void
+_check_authorization_cb(NMAuthManager       *auth_manager,
+                        NMAuthManagerCallId *call_id,
+                        gboolean             is_authorized,
+                        gboolean             is_challenge,
+                        GError              *error,
+                        gpointer             user_data)
+{
+    CheckData *data = user_data;
+
+    g_assert_no_error(error);
+    data->completed     = TRUE;
+    data->is_authorized = is_authorized;
+}
+
+static gboolean
+_check(NMAuthManager *auth_manager,
+       NMAuthSubject *subject,
+       const char    *action_id,
+       gboolean       allow_user_interaction)
+{
+    CheckData data = {};
+
+    nm_auth_manager_check_authorization(auth_manager,
+                                        subject,
+                                        action_id,
+                                        allow_user_interaction,
+                                        _check_authorization_cb,
+                                        &data);
+    nmtst_main_context_iterate_until_assert(NULL, 5000, data.completed);
+    return data.is_authorized;
+}
+
+static void
+test_auth_cache(void)
+{
+    gs_unref_object GDBusConnection *server  = NULL;
+    gs_unref_object GDBusConnection *client  = NULL;
+    gs_unref_object NMAuthSubject   *subject = NULL;
+    gs_free_error GError            *error   = NULL;
+    FakePolkit                       polkit  = {};
+    GDBusNodeInfo                   *node_info;
+    NMAuthManager                   *auth_manager;
+    guint                            registration_id;
+
+    nmtst_dbus_peer_connections_new(&server, &client);
+
+    node_info = g_dbus_node_info_new_for_xml(fake_polkit_xml, &error);
+    g_assert_no_error(error);
+    registration_id = g_dbus_connection_register_object(client,
+                                                        POLKIT_OBJECT_PATH,
+                                                        node_info->interfaces[0],
+                                                        &fake_polkit_vtable,
+                                                        &polkit,
+                                                        NULL,
+                                                        &error);
+    g_assert_no_error(error);
+    g_dbus_node_info_unref(node_info);
+
+    g_assert(_nm_dbus_manager_set_connection_for_testing(nm_dbus_manager_get(), server));
+    auth_manager = nm_auth_manager_setup(NM_AUTH_POLKIT_MODE_USE_POLKIT);
+    g_assert(nm_auth_manager_get_polkit_enabled(auth_manager));
+
+    subject = nm_auth_subject_new_unix_process(":1.42", getpid(), 1000);
+
+    /* A grant for a request that allows user interaction may come from the user
+     * typing the password. It must not be reused, neither for another interactive
+     * request, nor for a non-interactive one. */
+    polkit.is_authorized = TRUE;
+    g_assert(_check(auth_manager, subject, "org.nmtst.interactive", TRUE));
+    g_assert(_check(auth_manager, subject, "org.nmtst.interactive", TRUE));
+    g_assert_cmpint(polkit.n_calls, ==, 2);
+    polkit.is_authorized = FALSE;
+    g_assert(!_check(auth_manager, subject, "org.nmtst.interactive", FALSE));
+    g_assert_cmpint(polkit.n_calls, ==, 3);
+
+    /* An implicit answer without interaction is cached, "yes" and "no". */
+    polkit.is_authorized = TRUE;
+    g_assert(_check(auth_manager, subject, "org.nmtst.implicit-yes", FALSE));
+    polkit.is_authorized = FALSE;
+    g_assert(_check(auth_manager, subject, "org.nmtst.implicit-yes", FALSE));
+    g_assert_cmpint(polkit.n_calls, ==, 4);
+    g_assert(!_check(auth_manager, subject, "org.nmtst.implicit-no", TRUE));
+    polkit.is_authorized = TRUE;
+    g_assert(!_check(auth_manager, subject, "org.nmtst.implicit-no", TRUE));
+    g_assert_cmpint(polkit.n_calls, ==, 5);
+
+    /* A grant based on a temporary authorization may be revoked at any time. */
+    polkit.detail = "polkit.temporary_authorization_id";
+    g_assert(_check(auth_manager, subject, "org.nmtst.temporary", FALSE));
+    g_assert(_check(auth_manager, subject, "org.nmtst.temporary", FALSE));
+    g_assert_cmpint(polkit.n_calls, ==, 7);
+
+    /* After the user dismissed the dialog, the next attempt asks again. */
+    polkit.is_authorized = FALSE;
+    polkit.detail        = "polkit.dismissed";
+    g_assert(!_check(auth_manager, subject, "org.nmtst.dismissed", TRUE));
+    g_assert(!_check(auth_manager, subject, "org.nmtst.dismissed", TRUE));
+    g_assert_cmpint(polkit.n_calls, ==, 9);
+
+    /* A challenge is never cached. */
+    polkit.detail       = NULL;
+    polkit.is_challenge = TRUE;
+    g_assert(!_check(auth_manager, subject, "org.nmtst.challenge", FALSE));
+    g_assert(!_check(auth_manager, subject, "org.nmtst.challenge", FALSE));
+    g_assert_cmpint(polkit.n_calls, ==, 11);
+
+    g_dbus_connection_unregister_object(client, registration_id);
+}
+
+/*****************************************************************************/
+
+NMTST_DEFINE();
+
+int
+main(int argc, char **argv)
+{
+    nmtst_init_with_logging(&argc, &argv, NULL, "ALL");
+
+    g_test_add_func("/auth-manager/cache", test_auth_cache);
+
+    return g_test_run();
+}
@@ -7,6 +7,7 @@
 
 #include <net/if.h>
 #include <byteswap.h>
+#include <linux/if_infiniband.h>
 
 /* need math.h for isinf() and INFINITY. No need to link with -lm */
 #include <math.h>
@@ -1238,18 +1239,49 @@ test_connection_sort_autoconnect_priority(void)
 #define MATCH_S390   "S390:"
 #define MATCH_DRIVER "DRIVER:"
 
+static NMMatchSpecMatchType
+_test_match_spec_device_do(const GSList *specs,
+                           const char   *interface_name,
+                           const char   *driver,
+                           const char   *driver_version,
+                           const char   *s390_subchannels)
+{
+    nm_auto_free_match_spec_device_matcher NMMatchSpecDeviceMatcher *matcher = NULL;
+    NMMatchSpecMatchType                                             m;
+
+    m = nm_match_spec_device(specs,
+                             interface_name,
+                             NULL,
+                             driver,
+                             driver_version,
+                             NULL,
+                             s390_subchannels,
+                             NULL);
+
+    /* the compiled matcher must give the same result. */
+    matcher = nm_match_spec_device_matcher_new(specs);
+    g_assert_cmpint(m,
+                    ==,
+                    nm_match_spec_device_matcher_match(matcher,
+                                                       interface_name,
+                                                       NULL,
+                                                       driver,
+                                                       driver_version,
+                                                       NULL,
+                                                       s390_subchannels,
+                                                       NULL));
+    return m;
+}
+
 static NMMatchSpecMatchType
 _test_match_spec_device(const GSList *specs, const char *match_str)
 {
     if (match_str && g_str_has_prefix(match_str, MATCH_S390))
-        return nm_match_spec_device(specs,
-                                    NULL,
-                                    NULL,
-                                    NULL,
-                                    NULL,
-                                    NULL,
-                                    &match_str[NM_STRLEN(MATCH_S390)],
-                                    NULL);
+        return _test_match_spec_device_do(specs,
+                                          NULL,
+                                          NULL,
+                                          NULL,
+                                          &match_str[NM_STRLEN(MATCH_S390)]);
     if (match_str && g_str_has_prefix(match_str, MATCH_DRIVER)) {
         gs_free char *s = g_strdup(&match_str[NM_STRLEN(MATCH_DRIVER)]);
         char         *t;
@@ -1259,9 +1291,9 @@ _test_match_spec_device(const GSList *specs, const char *match_str)
             t[0] = '\0';
             t++;
         }
-        return nm_match_spec_device(specs, NULL, NULL, s, t, NULL, NULL, NULL);
+        return _test_match_spec_device_do(specs, NULL, s, t, NULL);
     }
-    return nm_match_spec_device(specs, match_str, NULL, NULL, NULL, NULL, NULL, NULL);
+    return _test_match_spec_device_do(specs, match_str, NULL, NULL, NULL);
 }
 
 static void
@@ -1459,6 +1491,303 @@ test_match_spec_device(void)
                                NULL);
 }
 
+static void
+_assert_match_spec_device_matcher(const GSList                   *specs,
+                                  const NMMatchSpecDeviceMatcher *matcher,
+                                  const char                     *interface_name,
+                                  const char                     *device_type,
+                                  const char                     *driver,
+                                  const char                     *driver_version,
+                                  const char                     *hwaddr,
+                                  const char                     *s390_subchannels)
+{
+    const char *dhcp_plugin = nmtst_get_rand_bool() ? "internal" : "dhclient";
+
+    g_assert_cmpint(nm_match_spec_device_matcher_match(matcher,
+                                                       interface_name,
+                                                       device_type,
+                                                       driver,
+                                                       driver_version,
+                                                       hwaddr,
+                                                       s390_subchannels,
+                                                       dhcp_plugin),
+                    ==,
+                    nm_match_spec_device(specs,
+                                         interface_name,
+                                         device_type,
+                                         driver,
+                                         driver_version,
+                                         hwaddr,
+                                         s390_subchannels,
+                                         dhcp_plugin));
+}
+
+static char *
+_rand_infiniband_hwaddr(const char *prefix)
+{
+    /* the port GUIDs in the last 8 bytes. */
+    static const guint8 guids[][8] = {
+        {0x00, 0x02, 0xc9, 0x03, 0x00, 0x01, 0x2f, 0x4b},
+        {0x00, 0x02, 0xc9, 0x03, 0x00, 0x01, 0x2f, 0x4c},
+    };
+    guint8 addr[INFINIBAND_ALEN];
+    char   buf[INFINIBAND_ALEN * 3];
+
+    /* randomize the QPN and the subnet prefix, which don't matter for matching. */
+    nmtst_rand_buf(NULL, addr, INFINIBAND_ALEN - 8);
+    memcpy(&addr[INFINIBAND_ALEN - 8], guids[nmtst_get_rand_uint32() % G_N_ELEMENTS(guids)], 8);
+
+    return g_strconcat(
+        prefix,
+        _nm_utils_hwaddr_ntoa(addr, INFINIBAND_ALEN, nmtst_get_rand_bool(), buf, sizeof(buf)),
+        NULL);
+}
+
+static void
+test_match_spec_device_matcher(void)
+{
+    static const char *const spec_strs[] = {
+        "*",
+        "em1",
+        "00:11:22:33:44:55",
+        "mac:00:11:22:33:44:66",
+        "MAC:aa:bb:cc:dd:ee:ff",
+        "interface-name:veth*",
+        "interface-name:=cali*",
+        "interface-name:~e?0",
+        "interface-name:*1",
+        "type:ethernet",
+        "driver:veth",
+        "driver:e1000/2.*",
+        "dhcp-plugin:internal",
+        "s390-subchannels:0.0.1000",
+        "except:em1",
+        "except:interface-name:veth1*",
+        "except:type:bond",
+        "except:mac:00:11:22:33:44:55",
+        "except:driver:virtio_net",
+        "except:*",
+        "mac:80:00:02:08:fe:80:00:00:00:00:00:00:00:02:c9:03:00:01:2f:4b",
+        "except:mac:80:00:00:48:FE:80:00:00:00:00:00:01:00:02:C9:03:00:01:2F:4C",
+        "mac:00:02:c9:03:00:01:2f:4b",
+    };
+    static const struct {
+        const char *interface_name;
+        const char *device_type;
+        const char *driver;
+        const char *driver_version;
+        const char *hwaddr;
+        const char *s390_subchannels;
+    } devices[] = {
+        {"em1", "ethernet", "e1000", "2.1", "00:11:22:33:44:55", NULL},
+        {"em2", "ethernet", "e1000e", "3.0", "00:11:22:33:44:66", NULL},
+        {"veth0", "veth", "veth", NULL, "AA:BB:CC:DD:EE:FF", NULL},
+        {"veth10", "veth", "veth", "1.0", NULL, NULL},
+        {"cali*", "veth", NULL, NULL, NULL, NULL},
+        {"cali0", "veth", NULL, NULL, NULL, NULL},
+        {"ex0", "bond", "bonding", NULL, "00:11:22:33:44:77", NULL},
+        {"enc1000", "ethernet", "virtio_net", NULL, NULL, "0.0.1000,0.0.1001"},
+        {"ib0",
+         "infiniband",
+         "ib_ipoib",
+         NULL,
+         "80:00:00:48:FE:80:00:00:00:00:00:00:00:02:C9:03:00:01:2F:4B",
+         NULL},
+        {"ib1",
+         "infiniband",
+         "ib_ipoib",
+         NULL,
+         "80:00:02:09:FE:80:00:00:00:00:00:00:00:02:C9:03:00:01:2F:4C",
+         NULL},
+        /* the GUID of ib0, but as a plain 8 byte address. */
+        {"eui0", "ethernet", NULL, NULL, "00:02:C9:03:00:01:2F:4B", NULL},
+        {"", NULL, NULL, NULL, NULL, NULL},
+        {NULL, NULL, NULL, NULL, NULL, NULL},
+    };
+    guint i_run;
+    guint i;
+
+    for (i_run = 0; i_run < 2000; i_run++) {
+        nm_auto_free_match_spec_device_matcher NMMatchSpecDeviceMatcher *matcher   = NULL;
+        GSList                                                          *specs     = NULL;
+        gs_free char                                                    *ib_spec   = NULL;
+        gs_free char                                                    *ib_hwaddr = NULL;
+        guint                                                            n;
+
+        n = nmtst_get_rand_uint32() % 5;
+        for (i = 0; i < n; i++) {
+            specs = g_slist_prepend(specs,
+                                    (char *) spec_strs[nmtst_get_rand_uint32()
+                                                       % G_N_ELEMENTS(spec_strs)]);
+        }
+
+        if (nmtst_get_rand_bool()) {
+            ib_spec = _rand_infiniband_hwaddr(nmtst_get_rand_bool() ? "mac:" : "except:mac:");
+            specs   = g_slist_prepend(specs, ib_spec);
+        }
+
+        matcher = nm_match_spec_device_matcher_new(specs);
+        g_assert(!specs == !matcher);
+
+        for (i = 0; i < G_N_ELEMENTS(devices); i++) {
+            _assert_match_spec_device_matcher(specs,
+                                              matcher,
+                                              devices[i].interface_name,
+                                              devices[i].device_type,
+                                              devices[i].driver,
+                                              devices[i].driver_version,
+                                              devices[i].hwaddr,
+                                              devices[i].s390_subchannels);
+        }
+
+        ib_hwaddr = _rand_infiniband_hwaddr("");
+        _assert_match_spec_device_matcher(specs,
+                                          matcher,
+                                          "ib2",
+                                          "infiniband",
+                                          "ib_ipoib",
+                                          NULL,
+                                          ib_hwaddr,
+                                          NULL);
+
+        g_slist_free(specs);
+    }
+}
+
+static void
+test_match_spec_device_benchmark(void)
+{
+    NMMatchSpecDeviceMatcher *matcher;
+    GSList                   *specs     = NULL;
+    const guint               n_specs   = 200;
+    const guint               n_devices = nmtst_test_quick() ? 1000 : 20000;
+    char                      ifname[IFNAMSIZ];
+    char                      hwaddr[ETH_ALEN * 3];
+    gint64                    start_time;
+    gint64                    time_specs;
+    gint64                    time_matcher;
+    guint                     n_match = 0;
+    guint                     i;
+
+    /* A configuration of a container host: many explicit interface names and
+     * MAC addresses, and a few globs. */
+    for (i = 0; i < n_specs; i++) {
+        if (i % 2 == 0)
+            specs = g_slist_prepend(specs, g_strdup_printf("interface-name:eth%u", i));
+        else
+            specs = g_slist_prepend(
+                specs,
+                g_strdup_printf("mac:02:00:00:00:%02x:%02x", i >> 8, i & 0xFF));
+    }
+    specs = g_slist_prepend(specs, g_strdup("interface-name:veth*"));
+    specs = g_slist_prepend(specs, g_strdup("interface-name:cali*"));
+    specs = g_slist_prepend(specs, g_strdup("except:interface-name:veth0"));
+
+    start_time = nm_utils_get_monotonic_timestamp_nsec();
+    for (i = 0; i < n_devices; i++) {
+        nm_sprintf_buf(ifname, "tap%u", i);
+        nm_sprintf_buf(hwaddr, "02:00:00:01:%02X:%02X", (i >> 8) & 0xFF, i & 0xFF);
+        if (nm_match_spec_device(specs, ifname, "tun", "tun", NULL, hwaddr, NULL, NULL)
+            == NM_MATCH_SPEC_MATCH)
+            n_match++;
+    }
+    time_specs = nm_utils_get_monotonic_timestamp_nsec() - start_time;
+
+    start_time = nm_utils_get_monotonic_timestamp_nsec();
+    matcher    = nm_match_spec_device_matcher_new(specs);
+    for (i = 0; i < n_devices; i++) {
+        nm_sprintf_buf(ifname, "tap%u", i);
+        nm_sprintf_buf(hwaddr, "02:00:00:01:%02X:%02X", (i >> 8) & 0xFF, i & 0xFF);
+        if (nm_match_spec_device_matcher_match(matcher,
+                                               ifname,
+                                               "tun",
+                                               "tun",
+                                               NULL,
+                                               hwaddr,
+                                               NULL,
+                                               NULL)
+            == NM_MATCH_SPEC_MATCH)
+            n_match--;
+    }
+    time_matcher = nm_utils_get_monotonic_timestamp_nsec() - start_time;
+
+    g_assert_cmpint(n_match, ==, 0);
+
+    g_test_message("match %u devices against %u specs: %" G_GINT64_FORMAT
+                   " usec with specs, %" G_GINT64_FORMAT " usec with compiled matcher",
+                   n_devices,
+                   g_slist_length(specs),
+                   time_specs / 1000,
+                   time_matcher / 1000);
+
+    nm_match_spec_device_matcher_free(matcher);
+    g_slist_free_full(specs, g_free);
+}
+
+/*****************************************************************************/
+
+static void
+test_ignored_links(void)
+{
+    gs_unref_hashtable GHashTable *ignored_links = NULL;
+    NMMatchSpecDeviceMatcher      *matcher;
+    GSList                        *specs;
+    NMPlatformLink                 plink;
+
+    ignored_links = g_hash_table_new_full(nm_direct_hash, NULL, NULL, g_free);
+
+    plink = (NMPlatformLink){
+        .ifindex        = 5,
+        .name           = "veth0",
+        .driver         = "veth",
+        .l_address.len  = ETH_ALEN,
+        .l_address.data = {0x02, 0x00, 0x00, 0x00, 0x00, 0x05},
+    };
+
+    specs   = nm_match_spec_split("interface-name:veth*,mac:02:00:00:00:00:06");
+    matcher = nm_match_spec_device_matcher_new(specs);
+    g_slist_free_full(specs, g_free);
+
+    /* without main.ignore-devices, nothing is ignored. */
+    g_assert(!nm_utils_ignored_links_check(ignored_links, NULL, &plink));
+    g_assert(!nm_utils_ignored_links_renamed(ignored_links, &plink));
+
+    /* the link is ignored and remembered, other changes don't matter... */
+    g_assert(nm_utils_ignored_links_check(ignored_links, matcher, &plink));
+    g_assert_cmpint(g_hash_table_size(ignored_links), ==, 1);
+    g_assert(!nm_utils_ignored_links_renamed(ignored_links, &plink));
+
+    /* ...but a rename does. Still ignored with a matching name... */
+    g_strlcpy(plink.name, "veth1", sizeof(plink.name));
+    g_assert(nm_utils_ignored_links_renamed(ignored_links, &plink));
+    g_assert(nm_utils_ignored_links_check(ignored_links, matcher, &plink));
+    g_assert(!nm_utils_ignored_links_renamed(ignored_links, &plink));
+
+    /* ...and no longer ignored without, so the device gets created. */
+    g_strlcpy(plink.name, "eth0", sizeof(plink.name));
+    g_assert(nm_utils_ignored_links_renamed(ignored_links, &plink));
+    g_assert(!nm_utils_ignored_links_check(ignored_links, matcher, &plink));
+    g_assert_cmpint(g_hash_table_size(ignored_links), ==, 0);
+    g_assert(!nm_utils_ignored_links_renamed(ignored_links, &plink));
+
+    /* a link ignored by its MAC address stays ignored after a rename. */
+    plink.l_address.data[5] = 0x06;
+    g_assert(nm_utils_ignored_links_check(ignored_links, matcher, &plink));
+    g_strlcpy(plink.name, "eth1", sizeof(plink.name));
+    g_assert(nm_utils_ignored_links_renamed(ignored_links, &plink));
+    g_assert(nm_utils_ignored_links_check(ignored_links, matcher, &plink));
+
+    /* the type is unknown for a link, so "type:" never matches. */
+    nm_match_spec_device_matcher_free(matcher);
+    specs   = nm_match_spec_split("type:ethernet");
+    matcher = nm_match_spec_device_matcher_new(specs);
+    g_slist_free_full(specs, g_free);
+    g_assert(!nm_utils_ignored_links_check(ignored_links, matcher, &plink));
+    g_assert_cmpint(g_hash_table_size(ignored_links), ==, 0);
+
+    nm_match_spec_device_matcher_free(matcher);
+}
+
 /*****************************************************************************/
 
 static void
@@ -2580,6 +2909,313 @@ test_connectivity_state_cmp(void)
 
 /*****************************************************************************/
 
+#define N_KEY_IDX_LINKS 5000
+
+typedef struct {
+    int  ifindex;
+    char iface[IFNAMSIZ];
+    char hwaddr[ETH_ALEN * 3];
+    bool removed;
+} KeyIdxLink;
+
+static void
+_key_idx_assert_link(const NMUtilsKeyIdx *idx, gconstpointer key, const KeyIdxLink *link)
+{
+    const NMUtilsKeyIdxEntry *entries;
+    guint                     len;
+
+    entries = nm_utils_key_idx_lookup(idx, key, &len);
+    if (link->removed) {
+        g_assert_cmpint(len, ==, 0);
+        g_assert(!entries);
+    } else {
+        g_assert_cmpint(len, ==, 1);
+        g_assert(entries[0].obj == link);
+    }
+}
+
+static void
+test_key_idx_scale(void)
+{
+    nm_auto_free_key_idx NMUtilsKeyIdx *by_ifindex = nm_utils_key_idx_new_int();
+    nm_auto_free_key_idx NMUtilsKeyIdx *by_iface   = nm_utils_key_idx_new_str();
+    nm_auto_free_key_idx NMUtilsKeyIdx *by_hwaddr  = nm_utils_key_idx_new_str();
+    gs_free KeyIdxLink                 *links      = g_new0(KeyIdxLink, N_KEY_IDX_LINKS);
+    const NMUtilsKeyIdxEntry           *entries;
+    KeyIdxLink                          dup1;
+    KeyIdxLink                          dup2;
+    guint                               len;
+    guint                               i;
+
+    /* Simulate the platform links of a container host with thousands of veths. */
+    for (i = 0; i < N_KEY_IDX_LINKS; i++) {
+        KeyIdxLink *link           = &links[i];
+        guint8      addr[ETH_ALEN] = {0x02, 0x42, 0xac, i >> 16, i >> 8, i};
+
+        link->ifindex = i + 2;
+        nm_sprintf_buf(link->iface, "veth%u", i);
+        _nm_utils_hwaddr_ntoa(addr, ETH_ALEN, TRUE, link->hwaddr, sizeof(link->hwaddr));
+
+        nm_utils_key_idx_add(by_ifindex, GINT_TO_POINTER(link->ifindex), link, i);
+        nm_utils_key_idx_add(by_iface, link->iface, link, i);
+        nm_utils_key_idx_add(by_hwaddr, link->hwaddr, link, i);
+    }
+
+    for (i = 0; i < N_KEY_IDX_LINKS; i++) {
+        _key_idx_assert_link(by_ifindex, GINT_TO_POINTER(links[i].ifindex), &links[i]);
+        _key_idx_assert_link(by_iface, links[i].iface, &links[i]);
+        _key_idx_assert_link(by_hwaddr, links[i].hwaddr, &links[i]);
+    }
+
+    /* Rename every second link, remove every third. */
+    for (i = 0; i < N_KEY_IDX_LINKS; i++) {
+        KeyIdxLink *link = &links[i];
+
+        if (i % 3 == 0) {
+            g_assert(nm_utils_key_idx_remove(by_ifindex, GINT_TO_POINTER(link->ifindex), link));
+            g_assert(nm_utils_key_idx_remove(by_iface, link->iface, link));
+            g_assert(nm_utils_key_idx_remove(by_hwaddr, link->hwaddr, link));
+            g_assert(!nm_utils_key_idx_remove(by_iface, link->iface, link));
+            link->removed = TRUE;
+        } else if (i % 2 == 0) {
+            g_assert(nm_utils_key_idx_remove(by_iface, link->iface, link));
+            nm_sprintf_buf(link->iface, "eth%u", i);
+            nm_utils_key_idx_add(by_iface, link->iface, link, i);
+        }
+    }
+
+    for (i = 0; i < N_KEY_IDX_LINKS; i++) {
+        char name[IFNAMSIZ];
+
+        _key_idx_assert_link(by_ifindex, GINT_TO_POINTER(links[i].ifindex), &links[i]);
+        _key_idx_assert_link(by_iface, links[i].iface, &links[i]);
+        _key_idx_assert_link(by_hwaddr, links[i].hwaddr, &links[i]);
+
+        if (i % 3 != 0 && i % 2 == 0) {
+            nm_utils_key_idx_lookup(by_iface, nm_sprintf_buf(name, "veth%u", i), &len);
+            g_assert_cmpint(len, ==, 0);
+        }
+    }
+
+    /* Objects sharing a key are returned in the order of their seq. */
+    dup1 = links[1];
+    dup2 = links[1];
+    nm_utils_key_idx_add(by_iface, links[1].iface, &dup2, N_KEY_IDX_LINKS + 1);
+    nm_utils_key_idx_add(by_iface, links[1].iface, &dup1, 0);
+    entries = nm_utils_key_idx_lookup(by_iface, links[1].iface, &len);
+    g_assert_cmpint(len, ==, 3);
+    g_assert(entries[0].obj == &dup1);
+    g_assert(entries[1].obj == &links[1]);
+    g_assert(entries[2].obj == &dup2);
+
+    g_assert(nm_utils_key_idx_remove(by_iface, links[1].iface, &links[1]));
+    entries = nm_utils_key_idx_lookup(by_iface, links[1].iface, &len);
+    g_assert_cmpint(len, ==, 2);
+    g_assert(entries[0].obj == &dup1);
+    g_assert(entries[1].obj == &dup2);
+
+    nm_utils_key_idx_lookup(by_ifindex, GINT_TO_POINTER(N_KEY_IDX_LINKS + 2), &len);
+    g_assert_cmpint(len, ==, 0);
+    nm_utils_key_idx_lookup(by_iface, NULL, &len);
+    g_assert_cmpint(len, ==, 0);
+}
+
+/*****************************************************************************/
+
+static GVariant *
+_variant_parse(const char *type, const char *str)
+{
+    gs_free_error GError *error = NULL;
+    GVariant             *v;
+
+    if (!str)
+        return NULL;
+
+    v = g_variant_parse(G_VARIANT_TYPE(type), str, NULL, NULL, &error);
+    g_assert_no_error(error);
+    return g_variant_ref_sink(v);
+}
+
+static void
+_assert_variant_array_diff(const char *type,
+                           const char *str_old,
+                           const char *str_new,
+                           const char *str_added,
+                           const char *str_removed)
+{
+    gs_unref_variant GVariant *v_old       = _variant_parse(type, str_old);
+    gs_unref_variant GVariant *v_new       = _variant_parse(type, str_new);
+    gs_unref_variant GVariant *v_added     = NULL;
+    gs_unref_variant GVariant *v_removed   = NULL;
+    gs_unref_variant GVariant *exp_added   = _variant_parse(type, str_added);
+    gs_unref_variant GVariant *exp_removed = _variant_parse(type, str_removed);
+
+    nm_utils_variant_array_diff(G_VARIANT_TYPE(type), v_old, v_new, &v_added, &v_removed);
+    g_assert(g_variant_is_of_type(v_added, G_VARIANT_TYPE(type)));
+    g_assert(g_variant_is_of_type(v_removed, G_VARIANT_TYPE(type)));
+    g_assert(g_variant_equal(v_added, exp_added));
+    g_assert(g_variant_equal(v_removed, exp_removed));
+}
+
+static void
+test_variant_array_diff(void)
+{
+    /* empty or missing arrays */
+    _assert_variant_array_diff("ai", NULL, NULL, "[]", "[]");
+    _assert_variant_array_diff("ai", "[]", "[]", "[]", "[]");
+    _assert_variant_array_diff("ai", NULL, "[1, 2]", "[1, 2]", "[]");
+    _assert_variant_array_diff("ai", "[]", "[1, 2]", "[1, 2]", "[]");
+    _assert_variant_array_diff("ai", "[1, 2]", NULL, "[]", "[1, 2]");
+    _assert_variant_array_diff("ai", "[1, 2]", "[]", "[]", "[1, 2]");
+
+    /* reordering is no change */
+    _assert_variant_array_diff("ai", "[1, 2, 3]", "[3, 1, 2]", "[]", "[]");
+    _assert_variant_array_diff("ai", "[1, 2, 3]", "[3, 4, 1]", "[4]", "[2]");
+
+    /* duplicates are counted */
+    _assert_variant_array_diff("ai", "[1, 1, 2]", "[1, 2]", "[]", "[1]");
+    _assert_variant_array_diff("ai", "[1, 2]", "[2, 1, 1]", "[1]", "[]");
+    _assert_variant_array_diff("ai", "[1, 1, 1]", "[1, 1, 1]", "[]", "[]");
+    _assert_variant_array_diff("ai", "[1, 2, 1, 3, 1]", "[3, 1]", "[]", "[2, 1, 1]");
+    _assert_variant_array_diff("ai", "[2, 2]", "[1, 1, 2, 1]", "[1, 1, 1]", "[2]");
+
+    /* route data */
+    _assert_variant_array_diff(
+        "aa{sv}",
+        "[{'dest': <'10.0.0.0'>, 'prefix': <uint32 8>}, "
+        "{'dest': <'10.0.0.0'>, 'prefix': <uint32 8>}, "
+        "{'dest': <'0.0.0.0'>, 'prefix': <uint32 0>, 'metric': <uint32 100>}]",
+        "[{'dest': <'0.0.0.0'>, 'prefix': <uint32 0>, 'metric': <uint32 50>}, "
+        "{'dest': <'10.0.0.0'>, 'prefix': <uint32 8>}]",
+        "[{'dest': <'0.0.0.0'>, 'prefix': <uint32 0>, 'metric': <uint32 50>}]",
+        "[{'dest': <'10.0.0.0'>, 'prefix': <uint32 8>}, "
+        "{'dest': <'0.0.0.0'>, 'prefix': <uint32 0>, 'metric': <uint32 100>}]");
+}
+
+/*****************************************************************************/
+
+static char *
+_hwaddr_rand(gsize len, const guint8 *base)
+{
+    guint8 addr[INFINIBAND_ALEN];
+    char   buf[INFINIBAND_ALEN * 3];
+
+    g_assert(len <= sizeof(addr));
+
+    if (base) {
+        /* only modify one byte of @base (or none), so that addresses collide. */
+        memcpy(addr, base, len);
+        addr[nmtst_get_rand_uint32() % len] ^= nmtst_get_rand_bool() ? 1 : 0;
+    } else
+        nmtst_rand_buf(NULL, addr, len);
+
+    return g_strdup(_nm_utils_hwaddr_ntoa(addr, len, nmtst_get_rand_bool(), buf, sizeof(buf)));
+}
+
+static void
+test_hwaddr_get_relevant_part(void)
+{
+    const guint8  addr_eth[ETH_ALEN]       = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+    const guint8  addr_ib[INFINIBAND_ALEN] = {0x80, 0x00, 0x02, 0x08, 0xfe, 0x80, 0x00,
+                                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+                                              0xc9, 0x03, 0x00, 0x01, 0x2f, 0x4b};
+    const guint8 *bin;
+    gsize         len;
+
+    len = ETH_ALEN;
+    bin = nm_utils_hwaddr_get_relevant_part(addr_eth, &len);
+    g_assert(bin == addr_eth);
+    g_assert_cmpint(len, ==, ETH_ALEN);
+
+    len = INFINIBAND_ALEN;
+    bin = nm_utils_hwaddr_get_relevant_part(addr_ib, &len);
+    g_assert(bin == &addr_ib[INFINIBAND_ALEN - 8]);
+    g_assert_cmpint(len, ==, 8);
+
+    /* other lengths are not shortened. */
+    len = 8;
+    bin = nm_utils_hwaddr_get_relevant_part(addr_ib, &len);
+    g_assert(bin == addr_ib);
+    g_assert_cmpint(len, ==, 8);
+}
+
+static void
+test_hwaddr_match_key(void)
+{
+    const guint8 base_eth[ETH_ALEN]       = {0x00, 0x11, 0x22, 0x33, 0x44, 0x55};
+    const guint8 base_ib[INFINIBAND_ALEN] = {0x80, 0x00, 0x02, 0x08, 0xfe, 0x80, 0x00,
+                                             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+                                             0xc9, 0x03, 0x00, 0x01, 0x2f, 0x4b};
+    gs_free char *key_a = NULL;
+    gs_free char *key_b = NULL;
+    int           i;
+
+    g_assert(!nm_utils_hwaddr_match_key(NULL));
+    g_assert(!nm_utils_hwaddr_match_key(""));
+    g_assert(!nm_utils_hwaddr_match_key("not-an-address"));
+
+    key_a = nm_utils_hwaddr_match_key("00:11:22:33:44:aa");
+    g_assert_cmpstr(key_a, ==, "00:11:22:33:44:AA");
+    nm_clear_g_free(&key_a);
+
+    /* the QPN and the subnet prefix don't matter for InfiniBand... */
+    key_a = nm_utils_hwaddr_match_key(
+        "80:00:02:08:FE:80:00:00:00:00:00:00:00:02:C9:03:00:01:2F:4B");
+    key_b = nm_utils_hwaddr_match_key(
+        "80:00:00:48:fe:80:00:00:00:00:00:01:00:02:c9:03:00:01:2f:4b");
+    g_assert(key_a);
+    g_assert_cmpstr(key_a, ==, key_b);
+    nm_clear_g_free(&key_b);
+
+    /* ...but the address is still different from an 8 byte address. */
+    key_b = nm_utils_hwaddr_match_key("00:02:C9:03:00:01:2F:4B");
+    g_assert(key_b);
+    g_assert_cmpstr(key_a, !=, key_b);
+    nm_clear_g_free(&key_a);
+    nm_clear_g_free(&key_b);
+
+    for (i = 0; i < 2000; i++) {
+        gs_free char *addr_a = NULL;
+        gs_free char *addr_b = NULL;
+        const guint8 *base;
+        gsize         len_a;
+        gsize         len_b;
+
+        switch (nmtst_get_rand_uint32() % 3) {
+        case 0:
+            len_a = ETH_ALEN;
+            base  = base_eth;
+            break;
+        case 1:
+            len_a = 8;
+            base  = &base_ib[INFINIBAND_ALEN - 8];
+            break;
+        default:
+            len_a = INFINIBAND_ALEN;
+            base  = base_ib;
+            break;
+        }
+        len_b = nmtst_get_rand_uint32() % 5 == 0 ? ETH_ALEN : len_a;
+
+        addr_a = _hwaddr_rand(len_a, nmtst_get_rand_bool() ? base : NULL);
+        addr_b = _hwaddr_rand(len_b, len_a == len_b && nmtst_get_rand_bool() ? base : NULL);
+
+        key_a = nm_utils_hwaddr_match_key(addr_a);
+        key_b = nm_utils_hwaddr_match_key(addr_b);
+        g_assert(key_a);
+        g_assert(key_b);
+
+        g_assert_cmpint(nm_streq(key_a, key_b),
+                        ==,
+                        nm_utils_hwaddr_matches(addr_a, -1, addr_b, -1));
+
+        nm_clear_g_free(&key_a);
+        nm_clear_g_free(&key_b);
+    }
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -2629,7 +3265,10 @@ main(int argc, char **argv)
                     test_connection_sort_autoconnect_priority);
 
     g_test_add_func("/general/match-spec/device", test_match_spec_device);
+    g_test_add_func("/general/match-spec/device-matcher", test_match_spec_device_matcher);
+    g_test_add_func("/general/match-spec/device-benchmark", test_match_spec_device_benchmark);
     g_test_add_func("/general/match-spec/config", test_match_spec_config);
+    g_test_add_func("/general/match-spec/ignored-links", test_ignored_links);
     g_test_add_func("/general/duplicate_decl_specifier", test_duplicate_decl_specifier);
 
     g_test_add_func("/general/reverse_dns/ip4", test_reverse_dns_ip4);
@@ -2654,6 +3293,10 @@ main(int argc, char **argv)
     g_test_add_func("/core/general/test_connectivity_state_cmp", test_connectivity_state_cmp);
     g_test_add_func("/core/general/test_kernel_cmdline_match_check",
                     test_kernel_cmdline_match_check);
+    g_test_add_func("/core/general/test_key_idx_scale", test_key_idx_scale);
+    g_test_add_func("/core/general/test_variant_array_diff", test_variant_array_diff);
+    g_test_add_func("/core/general/test_hwaddr_get_relevant_part", test_hwaddr_get_relevant_part);
+    g_test_add_func("/core/general/test_hwaddr_match_key", test_hwaddr_match_key);
 
     return g_test_run();
 }
@@ -0,0 +1,217 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "src/core/nm-default-daemon.h"
+
+#include "nm-dbus-manager.h"
+#include "nm-dbus-object.h"
+
+#include "nm-test-utils-core.h"
+
+/*****************************************************************************/
+
+#define NMTST_TYPE_DBUS_OBJECT (nmtst_dbus_object_get_type())
+#define NMTST_DBUS_OBJECT(obj) \
+    (G_TYPE_CHECK_INSTANCE_CAST((obj), NMTST_TYPE_DBUS_OBJECT, NMTstDBusObject))
+
+#define NMTST_DBUS_INTERFACE_OBJECT "org.freedesktop.NetworkManager.TstObject"
+
+typedef struct {
+    NMDBusObject parent;
+    guint        value;
+} NMTstDBusObject;
+
+typedef struct {
+    NMDBusObjectClass parent;
+} NMTstDBusObjectClass;
+
+NM_GOBJECT_PROPERTIES_DEFINE_BASE(PROP_VALUE, );
+
+GType nmtst_dbus_object_get_type(void);
+
+G_DEFINE_TYPE(NMTstDBusObject, nmtst_dbus_object, NM_TYPE_DBUS_OBJECT)
+
+static const GDBusSignalInfo signal_info_ping = NM_DEFINE_GDBUS_SIGNAL_INFO_INIT("Ping", );
+
+static const NMDBusInterfaceInfoExtended interface_info_tst_object = {
+    .parent = NM_DEFINE_GDBUS_INTERFACE_INFO_INIT(
+        NMTST_DBUS_INTERFACE_OBJECT,
+        .signals    = NM_DEFINE_GDBUS_SIGNAL_INFOS(&signal_info_ping, ),
+        .properties = NM_DEFINE_GDBUS_PROPERTY_INFOS(
+            NM_DEFINE_DBUS_PROPERTY_INFO_EXTENDED_READABLE("Value", "u", "value"), ), ),
+};
+
+static void
+get_property(GObject *object, guint prop_id, GValue *value, GParamSpec *pspec)
+{
+    NMTstDBusObject *self = NMTST_DBUS_OBJECT(object);
+
+    switch (prop_id) {
+    case PROP_VALUE:
+        g_value_set_uint(value, self->value);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
+        break;
+    }
+}
+
+static void
+set_property(GObject *object, guint prop_id, const GValue *value, GParamSpec *pspec)
+{
+    NMTstDBusObject *self = NMTST_DBUS_OBJECT(object);
+
+    switch (prop_id) {
+    case PROP_VALUE:
+        self->value = g_value_get_uint(value);
+        break;
+    default:
+        G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
+        break;
+    }
+}
+
+static void
+nmtst_dbus_object_init(NMTstDBusObject *self)
+{}
+
+static void
+nmtst_dbus_object_class_init(NMTstDBusObjectClass *klass)
+{
+    GObjectClass      *object_class      = G_OBJECT_CLASS(klass);
+    NMDBusObjectClass *dbus_object_class = NM_DBUS_OBJECT_CLASS(klass);
+
+    object_class->get_property = get_property;
+    object_class->set_property = set_property;
+
+    dbus_object_class->export_path     = NM_DBUS_EXPORT_PATH_NUMBERED(NM_DBUS_PATH "/TstObject");
+    dbus_object_class->interface_infos = NM_DBUS_INTERFACE_INFOS(&interface_info_tst_object);
+
+    obj_properties[PROP_VALUE] = g_param_spec_uint("value",
+                                                   "",
+                                                   "",
+                                                   0,
+                                                   G_MAXUINT32,
+                                                   0,
+                                                   G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+    g_object_class_install_properties(object_class, _PROPERTY_ENUMS_LAST, obj_properties);
+}
+
+/*****************************************************************************/
+
+static void
+_signal_cb(GDBusConnection *connection,
+           const char      *sender_name,
+           const char      *object_path,
+           const char      *interface_name,
+           const char      *signal_name,
+           GVariant        *parameters,
+           gpointer         user_data)
+{
+    GPtrArray  *events = user_data;
+    const char *path   = object_path;
+
+    if (NM_IN_STRSET(signal_name, "InterfacesAdded", "InterfacesRemoved"))
+        g_variant_get_child(parameters, 0, "&o", &path);
+
+    g_ptr_array_add(events, g_strdup_printf("%s %s", signal_name, path));
+}
+
+static void
+test_properties_changed_order(void)
+{
+    gs_unref_object GDBusConnection *server   = NULL;
+    gs_unref_object GDBusConnection *client   = NULL;
+    gs_unref_ptrarray GPtrArray     *events   = g_ptr_array_new_with_free_func(g_free);
+    gs_unref_ptrarray GPtrArray     *expected = g_ptr_array_new_with_free_func(g_free);
+    gs_unref_object NMTstDBusObject *obj_a    = NULL;
+    gs_unref_object NMTstDBusObject *obj_b    = NULL;
+    gs_unref_object NMTstDBusObject *obj_c    = NULL;
+    NMDBusManager                   *manager;
+    gs_free char                    *path_a   = NULL;
+    gs_free char                    *path_b   = NULL;
+    gs_free char                    *path_c   = NULL;
+    guint                            subscription_id;
+    guint                            i;
+
+    nmtst_dbus_peer_connections_new(&server, &client);
+
+    subscription_id = g_dbus_connection_signal_subscribe(client,
+                                                         NULL,
+                                                         NULL,
+                                                         NULL,
+                                                         NULL,
+                                                         NULL,
+                                                         G_DBUS_SIGNAL_FLAGS_NONE,
+                                                         _signal_cb,
+                                                         events,
+                                                         NULL);
+
+    manager = nm_dbus_manager_get();
+    g_assert(_nm_dbus_manager_set_connection_for_testing(manager, server));
+
+    /* long enough that no delayed signal is sent by the timer during the test. */
+    nm_dbus_manager_set_properties_changed_interval(manager, 600000);
+    nm_dbus_manager_start(manager, NULL, NULL);
+
+    obj_a  = g_object_new(NMTST_TYPE_DBUS_OBJECT, NULL);
+    obj_b  = g_object_new(NMTST_TYPE_DBUS_OBJECT, NULL);
+    obj_c  = g_object_new(NMTST_TYPE_DBUS_OBJECT, NULL);
+    path_a = g_strdup(nm_dbus_object_export(obj_a));
+    path_b = g_strdup(nm_dbus_object_export(obj_b));
+    g_ptr_array_add(expected, g_strdup_printf("InterfacesAdded %s", path_a));
+    g_ptr_array_add(expected, g_strdup_printf("InterfacesAdded %s", path_b));
+
+    /* The first change is sent right away, the second one is delayed... */
+    g_object_set(obj_a, "value", 1u, NULL);
+    g_object_set(obj_a, "value", 2u, NULL);
+    g_ptr_array_add(expected, g_strdup_printf("PropertiesChanged %s", path_a));
+
+    /* ...until another object emits a signal. */
+    nm_dbus_object_emit_signal(NM_DBUS_OBJECT(obj_b),
+                               &interface_info_tst_object,
+                               &signal_info_ping,
+                               "()");
+    g_ptr_array_add(expected, g_strdup_printf("PropertiesChanged %s", path_a));
+    g_ptr_array_add(expected, g_strdup_printf("Ping %s", path_b));
+
+    /* The delayed change must not be overtaken by InterfacesRemoved... */
+    g_object_set(obj_a, "value", 3u, NULL);
+    nm_dbus_object_unexport(obj_b);
+    g_ptr_array_add(expected, g_strdup_printf("PropertiesChanged %s", path_a));
+    g_ptr_array_add(expected, g_strdup_printf("InterfacesRemoved %s", path_b));
+
+    /* ...nor by InterfacesAdded. */
+    g_object_set(obj_a, "value", 4u, NULL);
+    path_c = g_strdup(nm_dbus_object_export(obj_c));
+    g_ptr_array_add(expected, g_strdup_printf("PropertiesChanged %s", path_a));
+    g_ptr_array_add(expected, g_strdup_printf("InterfacesAdded %s", path_c));
+
+    nmtst_main_context_iterate_until_assert(NULL, 5000, events->len >= expected->len);
+    nmtst_main_context_iterate_until(NULL, 50, FALSE);
+
+    for (i = 0; i < expected->len; i++) {
+        g_assert_cmpint(i, <, events->len);
+        g_assert_cmpstr(events->pdata[i], ==, expected->pdata[i]);
+    }
+    g_assert_cmpint(events->len, ==, expected->len);
+
+    nm_dbus_object_unexport(obj_a);
+    nm_dbus_object_unexport(obj_c);
+
+    g_dbus_connection_signal_unsubscribe(client, subscription_id);
+}
+
+/*****************************************************************************/
+
+NMTST_DEFINE();
+
+int
+main(int argc, char **argv)
+{
+    nmtst_init_with_logging(&argc, &argv, NULL, "ALL");
+
+    g_test_add_func("/dbus-manager/properties-changed-order", test_properties_changed_order);
+
+    return g_test_run();
+}
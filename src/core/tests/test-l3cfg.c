@@ -5,6 +5,8 @@
 #include <linux/if_addr.h>
 
 #include "nm-l3cfg.h"
+#include "nm-dbus-manager.h"
+#include "nm-ip-config.h"
 #include "nm-l3-ipv4ll.h"
 #include "nm-l3-ipv6ll.h"
 #include "nm-netns.h"
@@ -1069,6 +1071,291 @@ test_l3_ipv6ll(gconstpointer test_data)
 
 /*****************************************************************************/
 
+typedef struct {
+    GDBusConnection *client;
+    const char      *path;
+    GPtrArray       *routes;
+    guint64          generation;
+    guint            n_signals;
+} TestIPConfigRoutesData;
+
+static void
+_test_ip_config_routes_call_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    GVariant            **p_ret = user_data;
+    gs_free_error GError *error = NULL;
+
+    *p_ret = g_dbus_connection_call_finish(G_DBUS_CONNECTION(source), result, &error);
+    g_assert_no_error(error);
+    g_assert(*p_ret);
+}
+
+static GVariant *
+_test_ip_config_routes_call(TestIPConfigRoutesData *tdata,
+                            const char             *interface_name,
+                            const char             *method_name,
+                            GVariant               *parameters,
+                            const GVariantType     *reply_type)
+{
+    GVariant *ret = NULL;
+
+    /* the server side runs in our main context, so we cannot block. */
+    g_dbus_connection_call(tdata->client,
+                           NULL,
+                           tdata->path,
+                           interface_name,
+                           method_name,
+                           parameters,
+                           reply_type,
+                           G_DBUS_CALL_FLAGS_NONE,
+                           5000,
+                           NULL,
+                           _test_ip_config_routes_call_cb,
+                           &ret);
+    nmtst_main_context_iterate_until_assert(NULL, 5000, ret);
+    return ret;
+}
+
+static char **
+_test_ip_config_routes_to_strv(GVariant *const *routes, guint len)
+{
+    char **strv = g_new(char *, len + 1u);
+    guint  i;
+
+    for (i = 0; i < len; i++)
+        strv[i] = g_variant_print(routes[i], FALSE);
+    strv[len] = NULL;
+    qsort(strv, len, sizeof(char *), nm_strcmp_p);
+    return strv;
+}
+
+/* Page through GetRoutes() and check the result against RouteData. */
+static GPtrArray *
+_test_ip_config_routes_get_all(TestIPConfigRoutesData *tdata, guint page_size)
+{
+    gs_unref_variant GVariant *v_prop     = NULL;
+    gs_unref_variant GVariant *v_data     = NULL;
+    gs_strfreev char         **strv_pages = NULL;
+    gs_strfreev char         **strv_data  = NULL;
+    GPtrArray                 *routes;
+    guint64                    generation = 0;
+    guint32                    total      = 0;
+    guint                      n_pages    = 0;
+    gsize                      i;
+
+    routes = g_ptr_array_new_with_free_func((GDestroyNotify) g_variant_unref);
+
+    while (TRUE) {
+        gs_unref_variant GVariant *ret      = NULL;
+        gs_unref_variant GVariant *v_routes = NULL;
+        guint64                    gen;
+        guint32                    tot;
+
+        ret = _test_ip_config_routes_call(tdata,
+                                          NM_DBUS_INTERFACE_IP_CONFIG_ROUTES,
+                                          "GetRoutes",
+                                          g_variant_new("(uu)", routes->len, page_size),
+                                          G_VARIANT_TYPE("(tuaa{sv})"));
+        g_variant_get(ret, "(tu@aa{sv})", &gen, &tot, &v_routes);
+
+        if (n_pages++ == 0) {
+            generation = gen;
+            total      = tot;
+        } else {
+            /* nothing changes while we page. */
+            g_assert_cmpint(gen, ==, generation);
+            g_assert_cmpint(tot, ==, total);
+        }
+
+        g_assert_cmpint(g_variant_n_children(v_routes), <=, page_size);
+        for (i = 0; i < g_variant_n_children(v_routes); i++)
+            g_ptr_array_add(routes, g_variant_get_child_value(v_routes, i));
+
+        if (g_variant_n_children(v_routes) < page_size)
+            break;
+    }
+    g_assert_cmpint(routes->len, ==, total);
+    g_assert_cmpint(n_pages, ==, total / page_size + 1u);
+    g_assert_cmpint(generation, ==, tdata->generation);
+
+    v_prop = _test_ip_config_routes_call(
+        tdata,
+        DBUS_INTERFACE_PROPERTIES,
+        "Get",
+        g_variant_new("(ss)", NM_DBUS_INTERFACE_IP4_CONFIG, "RouteData"),
+        G_VARIANT_TYPE("(v)"));
+    g_variant_get(v_prop, "(v)", &v_data);
+    g_assert_cmpint(g_variant_n_children(v_data), ==, total);
+    for (i = 0; i < total; i++) {
+        gs_unref_variant GVariant *v_route = g_variant_get_child_value(v_data, i);
+
+        /* the pages are in the same order as RouteData. */
+        g_assert(g_variant_equal(v_route, routes->pdata[i]));
+    }
+
+    strv_pages = _test_ip_config_routes_to_strv((GVariant *const *) routes->pdata, routes->len);
+    strv_data  = _test_ip_config_routes_to_strv((GVariant *const *) tdata->routes->pdata,
+                                               tdata->routes->len);
+    g_assert(nm_strv_equal(strv_pages, strv_data));
+
+    return routes;
+}
+
+static void
+_test_ip_config_routes_changed_cb(GDBusConnection *connection,
+                                  const char      *sender_name,
+                                  const char      *object_path,
+                                  const char      *interface_name,
+                                  const char      *signal_name,
+                                  GVariant        *parameters,
+                                  gpointer         user_data)
+{
+    TestIPConfigRoutesData    *tdata     = user_data;
+    gs_unref_variant GVariant *v_added   = NULL;
+    gs_unref_variant GVariant *v_removed = NULL;
+    guint64                    generation;
+    gsize                      i;
+    guint                      j;
+
+    g_assert_cmpstr(object_path, ==, tdata->path);
+    g_assert_cmpstr(signal_name, ==, "RoutesChanged");
+
+    g_variant_get(parameters, "(t@aa{sv}@aa{sv})", &generation, &v_added, &v_removed);
+
+    g_assert_cmpint(generation, ==, tdata->generation + 1u);
+    tdata->generation = generation;
+    tdata->n_signals++;
+
+    /* apply the change to our copy, like a client would. */
+    for (i = 0; i < g_variant_n_children(v_removed); i++) {
+        gs_unref_variant GVariant *v_route = g_variant_get_child_value(v_removed, i);
+
+        for (j = 0; j < tdata->routes->len; j++) {
+            if (g_variant_equal(tdata->routes->pdata[j], v_route))
+                break;
+        }
+        g_assert_cmpint(j, <, tdata->routes->len);
+        g_ptr_array_remove_index(tdata->routes, j);
+    }
+    for (i = 0; i < g_variant_n_children(v_added); i++)
+        g_ptr_array_add(tdata->routes, g_variant_get_child_value(v_added, i));
+}
+
+static void
+test_ip_config_routes(void)
+{
+    const guint                                    N_ROUTES     = 20;
+    const guint                                    PAGE_SIZE    = 7;
+    nm_auto(_test_fixture_1_teardown) TestFixture1 test_fixture = {};
+    const TestFixture1                            *f;
+    gs_unref_object GDBusConnection               *server    = NULL;
+    gs_unref_object GDBusConnection               *client    = NULL;
+    gs_unref_object NML3Cfg                       *l3cfg     = NULL;
+    gs_unref_object NMIPConfig                    *ip_config = NULL;
+    gs_unref_ptrarray GPtrArray                   *routes    = NULL;
+    TestIPConfigRoutesData                         tdata     = {};
+    NMDBusManager                                 *manager;
+    guint                                          subscription_id;
+    guint                                          n_routes_0;
+    guint                                          i;
+
+    f = _test_fixture_1_setup(&test_fixture, 5);
+
+    nmtst_dbus_peer_connections_new(&server, &client);
+    manager = nm_dbus_manager_get();
+    g_assert(_nm_dbus_manager_set_connection_for_testing(manager, server));
+    nm_dbus_manager_start(manager, NULL, NULL);
+
+    l3cfg     = _netns_access_l3cfg(f->netns, f->ifindex0);
+    ip_config = nm_ip_config_new(AF_INET, l3cfg);
+    g_assert(nm_dbus_object_is_exported(NM_DBUS_OBJECT(ip_config)));
+
+    tdata.client = client;
+    tdata.path   = nm_dbus_object_get_path(NM_DBUS_OBJECT(ip_config));
+
+    subscription_id = g_dbus_connection_signal_subscribe(client,
+                                                         NULL,
+                                                         NM_DBUS_INTERFACE_IP_CONFIG_ROUTES,
+                                                         "RoutesChanged",
+                                                         tdata.path,
+                                                         NULL,
+                                                         G_DBUS_SIGNAL_FLAGS_NONE,
+                                                         _test_ip_config_routes_changed_cb,
+                                                         &tdata,
+                                                         NULL);
+
+    /* let pending platform changes settle, and start with the full table. */
+    nmtst_main_context_iterate_until(NULL, 100, FALSE);
+    {
+        gs_unref_variant GVariant *ret   = NULL;
+        gs_unref_variant GVariant *v_gen = NULL;
+
+        ret = _test_ip_config_routes_call(
+            &tdata,
+            DBUS_INTERFACE_PROPERTIES,
+            "Get",
+            g_variant_new("(ss)", NM_DBUS_INTERFACE_IP_CONFIG_ROUTES, "Generation"),
+            G_VARIANT_TYPE("(v)"));
+        g_variant_get(ret, "(v)", &v_gen);
+        tdata.generation = g_variant_get_uint64(v_gen);
+    }
+    tdata.routes = g_ptr_array_new_with_free_func((GDestroyNotify) g_variant_unref);
+    routes       = _test_ip_config_routes_get_all(&tdata, 1000);
+    g_ptr_array_set_size(tdata.routes, 0);
+    for (i = 0; i < routes->len; i++)
+        g_ptr_array_add(tdata.routes, g_variant_ref(routes->pdata[i]));
+    g_clear_pointer(&routes, g_ptr_array_unref);
+    n_routes_0 = tdata.routes->len;
+
+    for (i = 0; i < N_ROUTES; i++) {
+        nmtstp_ip4_route_add(f->platform,
+                             f->ifindex0,
+                             NM_IP_CONFIG_SOURCE_USER,
+                             nmtst_inet4_from_string(nm_sprintf_bufa(100, "10.5.%u.0", i)),
+                             24,
+                             INADDR_ANY,
+                             0,
+                             100,
+                             0);
+    }
+
+    /* follow the changes via RoutesChanged, then check them against GetRoutes(). */
+    nmtst_main_context_iterate_until_assert(NULL,
+                                            5000,
+                                            tdata.routes->len == n_routes_0 + N_ROUTES);
+    g_assert_cmpint(tdata.n_signals, >, 0);
+    routes = _test_ip_config_routes_get_all(&tdata, PAGE_SIZE);
+    g_clear_pointer(&routes, g_ptr_array_unref);
+
+    for (i = 0; i < N_ROUTES; i += 2) {
+        g_assert(nmtstp_platform_ip4_route_delete(
+            f->platform,
+            f->ifindex0,
+            nmtst_inet4_from_string(nm_sprintf_bufa(100, "10.5.%u.0", i)),
+            24,
+            100));
+    }
+
+    nmtst_main_context_iterate_until_assert(NULL,
+                                            5000,
+                                            tdata.routes->len == n_routes_0 + N_ROUTES / 2);
+    routes = _test_ip_config_routes_get_all(&tdata, PAGE_SIZE);
+    g_clear_pointer(&routes, g_ptr_array_unref);
+
+    /* with a page size of one, the last call starts at the end and gets an
+     * empty page. */
+    routes = _test_ip_config_routes_get_all(&tdata, 1);
+    g_clear_pointer(&routes, g_ptr_array_unref);
+
+    g_dbus_connection_signal_unsubscribe(client, subscription_id);
+    nm_dbus_object_unexport(NM_DBUS_OBJECT(ip_config));
+    g_clear_object(&ip_config);
+    g_clear_object(&l3cfg);
+    g_ptr_array_unref(tdata.routes);
+}
+
+/*****************************************************************************/
+
 NMTstpSetupFunc const _nmtstp_setup_platform_func = nm_linux_platform_setup;
 
 void
@@ -1090,4 +1377,5 @@ _nmtstp_setup_tests(void)
     g_test_add_data_func("/l3-ipv6ll/2", GINT_TO_POINTER(2), test_l3_ipv6ll);
     g_test_add_data_func("/l3-ipv6ll/3", GINT_TO_POINTER(3), test_l3_ipv6ll);
     g_test_add_data_func("/l3-ipv6ll/4", GINT_TO_POINTER(4), test_l3_ipv6ll);
+    g_test_add_func("/l3cfg/ip-config-routes", test_ip_config_routes);
 }
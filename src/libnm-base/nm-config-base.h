@@ -29,11 +29,14 @@
 #define NM_CONFIG_KEYFILE_KEY_MAIN_FIREWALL_BACKEND            "firewall-backend"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_HOSTNAME_MODE               "hostname-mode"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_CARRIER              "ignore-carrier"
+#define NM_CONFIG_KEYFILE_KEY_MAIN_IGNORE_DEVICES              "ignore-devices"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_IWD_CONFIG_PATH             "iwd-config-path"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_MONITOR_CONNECTION_FILES    "monitor-connection-files"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_NO_AUTO_DEFAULT             "no-auto-default"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_PLUGINS                     "plugins"
+#define NM_CONFIG_KEYFILE_KEY_MAIN_PROPERTIES_CHANGED_INTERVAL "properties-changed-interval"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_RC_MANAGER                  "rc-manager"
+#define NM_CONFIG_KEYFILE_KEY_MAIN_SECRET_AGENTS_PARALLEL      "secret-agents-parallel"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_SLAVES_ORDER                "slaves-order"
 #define NM_CONFIG_KEYFILE_KEY_MAIN_SYSTEMD_RESOLVED            "systemd-resolved"
 
@@ -47,9 +50,10 @@
 #define NM_CONFIG_KEYFILE_KEY_CONNECTIVITY_RESPONSE "response"
 #define NM_CONFIG_KEYFILE_KEY_CONNECTIVITY_URI      "uri"
 
-#define NM_CONFIG_KEYFILE_KEY_KEYFILE_PATH              "path"
-#define NM_CONFIG_KEYFILE_KEY_KEYFILE_UNMANAGED_DEVICES "unmanaged-devices"
-#define NM_CONFIG_KEYFILE_KEY_KEYFILE_HOSTNAME          "hostname"
+#define NM_CONFIG_KEYFILE_KEY_KEYFILE_PATH               "path"
+#define NM_CONFIG_KEYFILE_KEY_KEYFILE_UNMANAGED_DEVICES  "unmanaged-devices"
+#define NM_CONFIG_KEYFILE_KEY_KEYFILE_HOSTNAME           "hostname"
+#define NM_CONFIG_KEYFILE_KEY_KEYFILE_INCREMENTAL_RELOAD "incremental-reload"
 
 #define NM_CONFIG_KEYFILE_KEY_IFUPDOWN_MANAGED "managed"
 
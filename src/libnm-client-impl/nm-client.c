@@ -287,7 +287,7 @@ typedef struct {
     guint dbsid_nm_vpn_connection_state_changed;
     guint dbsid_nm_check_permissions;
 
-    NMClientInstanceFlags instance_flags : 3;
+    NMClientInstanceFlags instance_flags : 5;
 
     NMTernary permissions_state : 3;
 
@@ -2396,6 +2396,43 @@ _nml_dbus_notify_update_prop_o(NMClient               *self,
 
 /*****************************************************************************/
 
+/* Whether objects of type @gtype are not tracked, because the user
+ * opted out via the NM_CLIENT_INSTANCE_FLAGS_SKIP_* flags. */
+static gboolean
+_instance_flags_skip_gtype(NMClient *self, GType gtype)
+{
+    NMClientInstanceFlags instance_flags = NM_CLIENT_GET_PRIVATE(self)->instance_flags;
+
+    if (NM_FLAGS_HAS(instance_flags, NM_CLIENT_INSTANCE_FLAGS_SKIP_ACCESS_POINTS)
+        && g_type_is_a(gtype, NM_TYPE_ACCESS_POINT))
+        return TRUE;
+    if (NM_FLAGS_HAS(instance_flags, NM_CLIENT_INSTANCE_FLAGS_SKIP_IP_CONFIGS)
+        && (g_type_is_a(gtype, NM_TYPE_IP_CONFIG) || g_type_is_a(gtype, NM_TYPE_DHCP_CONFIG)))
+        return TRUE;
+    if (NM_FLAGS_HAS(instance_flags, NM_CLIENT_INSTANCE_FLAGS_SKIP_CONNECTIONS)
+        && g_type_is_a(gtype, NM_TYPE_REMOTE_CONNECTION))
+        return TRUE;
+    return FALSE;
+}
+
+static gboolean
+_instance_flags_skip_iface(NMClient *self, const char *interface_name)
+{
+    const NMLDBusMetaIface *meta_iface;
+
+    if (!NM_FLAGS_ANY((NMClientInstanceFlags) NM_CLIENT_GET_PRIVATE(self)->instance_flags,
+                      NM_CLIENT_INSTANCE_FLAGS_SKIP_ACCESS_POINTS
+                          | NM_CLIENT_INSTANCE_FLAGS_SKIP_IP_CONFIGS
+                          | NM_CLIENT_INSTANCE_FLAGS_SKIP_CONNECTIONS))
+        return FALSE;
+
+    meta_iface = nml_dbus_meta_iface_get(interface_name);
+    return meta_iface && meta_iface->get_type_fcn
+           && _instance_flags_skip_gtype(self, meta_iface->get_type_fcn());
+}
+
+/*****************************************************************************/
+
 static void
 _obj_handle_dbus_prop_changes(NMClient            *self,
                               NMLDBusObject       *dbobj,
@@ -2423,6 +2460,18 @@ _obj_handle_dbus_prop_changes(NMClient            *self,
         value = NULL;
     }
 
+    if (value && !meta_property->notify_update_prop) {
+        GType (*get_o_type_fcn)(void) = NULL;
+
+        /* References to objects that we don't track are treated as unset. */
+        if (nm_streq((const char *) meta_property->dbus_type, "o"))
+            get_o_type_fcn = meta_property->extra.property_vtable_o->get_o_type_fcn;
+        else if (nm_streq((const char *) meta_property->dbus_type, "ao"))
+            get_o_type_fcn = meta_property->extra.property_vtable_ao->get_o_type_fcn;
+        if (get_o_type_fcn && _instance_flags_skip_gtype(self, get_o_type_fcn()))
+            value = NULL;
+    }
+
     if (meta_property->notify_update_prop) {
         notify_update_prop_flags =
             meta_property->notify_update_prop(self, dbobj, meta_iface, dbus_property_idx, value);
@@ -2954,6 +3003,9 @@ _dbus_handle_properties_changed(NMClient       *self,
     nm_assert(!changed_properties
               || g_variant_is_of_type(changed_properties, G_VARIANT_TYPE("a{sv}")));
 
+    if (_instance_flags_skip_iface(self, interface_name))
+        return FALSE;
+
     {
         gs_free char *ss = NULL;
 
@@ -3108,6 +3160,8 @@ _dbus_handle_interface_removed(NMClient          *self,
     } else {
         dbobj = _dbobjs_dbobj_get_s(self, object_path);
         if (!dbobj) {
+            if (removed_interfaces[0] && _instance_flags_skip_iface(self, removed_interfaces[0]))
+                return FALSE;
             NML_NMCLIENT_LOG_E(self,
                                "%s: [%s]: receive interface removed event for non existing object",
                                log_context,
@@ -3121,6 +3175,9 @@ _dbus_handle_interface_removed(NMClient          *self,
         NMLDBusObjIfaceData *db_iface_data;
         const char          *interface_name = removed_interfaces[i];
 
+        if (_instance_flags_skip_iface(self, interface_name))
+            continue;
+
         db_iface_data = nml_dbus_object_iface_data_get(dbobj, interface_name, FALSE);
         if (!db_iface_data) {
             NML_NMCLIENT_LOG_E(
@@ -3880,6 +3937,20 @@ _request_wait_start(GTask      *task_take,
 
     self = g_task_get_source_object(task);
 
+    if (_instance_flags_skip_gtype(self, gtype)) {
+        NML_NMCLIENT_LOG_D(self,
+                           "%s() succeeded with %s but the object is not tracked",
+                           op_name,
+                           dbus_path);
+        g_task_return_error(task,
+                            g_error_new(NM_CLIENT_ERROR,
+                                        NM_CLIENT_ERROR_FAILED,
+                                        _("operation succeeded but object %s is not tracked "
+                                          "due to the instance flags"),
+                                        dbus_path));
+        return;
+    }
+
     dbobj = _dbobjs_get_nmobj(self, dbus_path, gtype);
 
     if (!dbobj) {
@@ -5877,6 +5948,123 @@ nm_client_add_connection2_finish(NMClient     *client,
         _request_wait_finish(client, result, nm_client_add_connection2, out_result, error));
 }
 
+/**
+ * nm_client_add_connections_async:
+ * @client: the %NMClient
+ * @connections: (element-type NMConnection): the connections to add. Note
+ *   that the settings of these objects will be added, not the objects
+ *   themselves.
+ * @flags: the %NMSettingsAddConnection2Flags argument, applied to all
+ *   connections.
+ * @args: (allow-none): the "a{sv}" #GVariant with extra argument or %NULL
+ *   for no extra arguments.
+ * @cancellable: a #GCancellable, or %NULL
+ * @callback: (scope async): callback to be called when the add operation completes
+ * @user_data: (closure): caller-specific data passed to @callback
+ *
+ * Call the AddConnections() D-Bus API asynchronously. This adds all
+ * @connections with a single request, which is authorized only once.
+ * The flags and arguments have the same meaning as for
+ * nm_client_add_connection2().
+ *
+ * The request is rejected as a whole if any of the connections is invalid.
+ *
+ * Since: 1.40
+ **/
+void
+nm_client_add_connections_async(NMClient                     *client,
+                                const GPtrArray              *connections,
+                                NMSettingsAddConnection2Flags flags,
+                                GVariant                     *args,
+                                GCancellable                 *cancellable,
+                                GAsyncReadyCallback           callback,
+                                gpointer                      user_data)
+{
+    GVariantBuilder builder;
+    guint           i;
+
+    g_return_if_fail(NM_IS_CLIENT(client));
+    g_return_if_fail(connections);
+    g_return_if_fail(!args || g_variant_is_of_type(args, G_VARIANT_TYPE("a{sv}")));
+    g_return_if_fail(!cancellable || G_IS_CANCELLABLE(cancellable));
+
+    /* Validate everything before starting the builder, so that a failed
+     * check does not leak it. */
+    for (i = 0; i < connections->len; i++)
+        g_return_if_fail(NM_IS_CONNECTION(connections->pdata[i]));
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("aa{sa{sv}}"));
+    for (i = 0; i < connections->len; i++) {
+        g_variant_builder_add_value(
+            &builder,
+            nm_connection_to_dbus(connections->pdata[i], NM_CONNECTION_SERIALIZE_ALL));
+    }
+
+    NML_NMCLIENT_LOG_D(client, "AddConnections() started for %u connections...", connections->len);
+
+    _nm_client_dbus_call(client,
+                         client,
+                         nm_client_add_connections_async,
+                         cancellable,
+                         callback,
+                         user_data,
+                         NM_DBUS_PATH_SETTINGS,
+                         NM_DBUS_INTERFACE_SETTINGS,
+                         "AddConnections",
+                         g_variant_new("(aa{sa{sv}}u@a{sv})",
+                                       &builder,
+                                       (guint32) flags,
+                                       args ?: nm_g_variant_singleton_aLsvI()),
+                         G_VARIANT_TYPE("(aoa{sv})"),
+                         G_DBUS_CALL_FLAGS_NONE,
+                         NM_DBUS_DEFAULT_TIMEOUT_MSEC,
+                         nm_dbus_connection_call_finish_variant_strip_dbus_error_cb);
+}
+
+/**
+ * nm_client_add_connections_finish:
+ * @client: the #NMClient
+ * @result: the #GAsyncResult
+ * @out_result: (allow-none) (transfer full) (out): the output #GVariant
+ *   from AddConnections().
+ * @error: (allow-none): the error argument.
+ *
+ * Gets the result of a call to nm_client_add_connections_async().
+ *
+ * Note that the added connections might not yet be visible in @client's
+ * connections array when the function returns. Use
+ * nm_client_get_connection_by_path() once they appear.
+ *
+ * Returns: (transfer full) (array zero-terminated=1): on success, a
+ *   %NULL-terminated array with the D-Bus paths of the added connections,
+ *   in the order they were passed to nm_client_add_connections_async().
+ *   On failure, %NULL.
+ *
+ * Since: 1.40
+ **/
+char **
+nm_client_add_connections_finish(NMClient     *client,
+                                 GAsyncResult *result,
+                                 GVariant    **out_result,
+                                 GError      **error)
+{
+    gs_unref_variant GVariant *ret = NULL;
+    char                     **paths;
+
+    g_return_val_if_fail(NM_IS_CLIENT(client), NULL);
+    g_return_val_if_fail(nm_g_task_is_valid(result, client, nm_client_add_connections_async),
+                         NULL);
+
+    ret = g_task_propagate_pointer(G_TASK(result), error);
+    if (!ret) {
+        NM_SET_OUT(out_result, NULL);
+        return NULL;
+    }
+
+    g_variant_get(ret, "(^ao@a{sv})", &paths, out_result);
+    return paths;
+}
+
 /*****************************************************************************/
 
 /**
@@ -6901,17 +7089,19 @@ _init_fetch_all(NMClient *self)
                                                                self,
                                                                NULL);
 
-    priv->dbsid_nm_settings_connection_updated =
-        g_dbus_connection_signal_subscribe(priv->dbus_connection,
-                                           priv->name_owner,
-                                           NM_DBUS_INTERFACE_SETTINGS_CONNECTION,
-                                           "Updated",
-                                           NULL,
-                                           NULL,
-                                           G_DBUS_SIGNAL_FLAGS_NONE,
-                                           _dbus_settings_updated_cb,
-                                           self,
-                                           NULL);
+    if (!NM_FLAGS_HAS((NMClientInstanceFlags) priv->instance_flags,
+                      NM_CLIENT_INSTANCE_FLAGS_SKIP_CONNECTIONS))
+        priv->dbsid_nm_settings_connection_updated =
+            g_dbus_connection_signal_subscribe(priv->dbus_connection,
+                                               priv->name_owner,
+                                               NM_DBUS_INTERFACE_SETTINGS_CONNECTION,
+                                               "Updated",
+                                               NULL,
+                                               NULL,
+                                               G_DBUS_SIGNAL_FLAGS_NONE,
+                                               _dbus_settings_updated_cb,
+                                               self,
+                                               NULL);
 
     priv->dbsid_nm_connection_active_state_changed =
         g_dbus_connection_signal_subscribe(priv->dbus_connection,
@@ -502,6 +502,21 @@ const NMLDBusMetaIface _nml_dbus_meta_iface_nm_device_statistics = NML_DBUS_META
                                         NML_DBUS_META_PROPERTY_INIT_TODO("RxBytes", "t"),
                                         NML_DBUS_META_PROPERTY_INIT_TODO("TxBytes", "t"), ), );
 
+/* TODO: link statistics interface not yet implemented. */
+const NMLDBusMetaIface _nml_dbus_meta_iface_nm_device_linkstatistics = NML_DBUS_META_IFACE_INIT(
+    NM_DBUS_INTERFACE_DEVICE_LINK_STATS,
+    NULL,
+    NML_DBUS_META_INTERFACE_PRIO_NONE,
+    NML_DBUS_META_IFACE_DBUS_PROPERTIES(NML_DBUS_META_PROPERTY_INIT_TODO("Collisions", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("Multicast", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("RxDropped", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("RxErrors", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("RxNoHandler", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("RxPackets", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("TxDropped", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("TxErrors", "t"),
+                                        NML_DBUS_META_PROPERTY_INIT_TODO("TxPackets", "t"), ), );
+
 const NMLDBusMetaIface _nml_dbus_meta_iface_nm_device = NML_DBUS_META_IFACE_INIT_PROP(
     NM_DBUS_INTERFACE_DEVICE,
     nm_device_get_type,
@@ -31,6 +31,8 @@ NM_GOBJECT_PROPERTIES_DEFINE(NMIPConfig,
 typedef struct _NMIPConfigPrivate {
     GPtrArray *addresses;
     GPtrArray *routes;
+    GVariant  *addresses_lazy;
+    GVariant  *routes_lazy;
     char     **nameservers;
     char     **domains;
     char     **searches;
@@ -50,6 +52,13 @@ G_DEFINE_ABSTRACT_TYPE(NMIPConfig, nm_ip_config, NM_TYPE_OBJECT)
 
 /*****************************************************************************/
 
+static gboolean
+_lazy_properties_enabled(NMClient *client)
+{
+    return NM_FLAGS_HAS(nm_client_get_instance_flags(client),
+                        NM_CLIENT_INSTANCE_FLAGS_LAZY_PROPERTIES);
+}
+
 static NMLDBusNotifyUpdatePropFlags
 _notify_update_prop_addresses(NMClient               *client,
                               NMLDBusObject          *dbobj,
@@ -73,6 +82,15 @@ _notify_update_prop_addresses(NMClient               *client,
     } else
         priv->addresses_new_style = new_style;
 
+    nm_clear_pointer(&priv->addresses_lazy, g_variant_unref);
+
+    if (value && new_style && _lazy_properties_enabled(client)) {
+        /* Only remember the value. nm_ip_config_get_addresses() converts it
+         * when it's needed. */
+        priv->addresses_lazy = g_variant_ref(value);
+        return NML_DBUS_NOTIFY_UPDATE_PROP_FLAGS_NOTIFY;
+    }
+
     if (value) {
         if (new_style)
             addresses_new = nm_utils_ip_addresses_from_variant(value, addr_family);
@@ -113,6 +131,13 @@ _notify_update_prop_routes(NMClient               *client,
     } else
         priv->routes_new_style = new_style;
 
+    nm_clear_pointer(&priv->routes_lazy, g_variant_unref);
+
+    if (value && new_style && _lazy_properties_enabled(client)) {
+        priv->routes_lazy = g_variant_ref(value);
+        return NML_DBUS_NOTIFY_UPDATE_PROP_FLAGS_NOTIFY;
+    }
+
     if (value) {
         if (new_style)
             routes_new = nm_utils_ip_routes_from_variant(value, addr_family);
@@ -304,6 +329,8 @@ finalize(GObject *object)
 
     g_ptr_array_unref(priv->routes);
     g_ptr_array_unref(priv->addresses);
+    nm_g_variant_unref(priv->routes_lazy);
+    nm_g_variant_unref(priv->addresses_lazy);
 
     g_strfreev(priv->nameservers);
     g_strfreev(priv->domains);
@@ -551,9 +578,21 @@ nm_ip_config_get_gateway(NMIPConfig *config)
 GPtrArray *
 nm_ip_config_get_addresses(NMIPConfig *config)
 {
+    NMIPConfigPrivate *priv;
+
     g_return_val_if_fail(NM_IS_IP_CONFIG(config), NULL);
 
-    return NM_IP_CONFIG_GET_PRIVATE(config)->addresses;
+    priv = NM_IP_CONFIG_GET_PRIVATE(config);
+
+    if (G_UNLIKELY(priv->addresses_lazy)) {
+        gs_unref_variant GVariant *value = g_steal_pointer(&priv->addresses_lazy);
+
+        g_ptr_array_unref(priv->addresses);
+        priv->addresses =
+            nm_utils_ip_addresses_from_variant(value, nm_ip_config_get_family(config));
+    }
+
+    return priv->addresses;
 }
 
 /**
@@ -638,7 +677,18 @@ nm_ip_config_get_wins_servers(NMIPConfig *config)
 GPtrArray *
 nm_ip_config_get_routes(NMIPConfig *config)
 {
+    NMIPConfigPrivate *priv;
+
     g_return_val_if_fail(NM_IS_IP_CONFIG(config), NULL);
 
-    return NM_IP_CONFIG_GET_PRIVATE(config)->routes;
+    priv = NM_IP_CONFIG_GET_PRIVATE(config);
+
+    if (G_UNLIKELY(priv->routes_lazy)) {
+        gs_unref_variant GVariant *value = g_steal_pointer(&priv->routes_lazy);
+
+        g_ptr_array_unref(priv->routes);
+        priv->routes = nm_utils_ip_routes_from_variant(value, nm_ip_config_get_family(config));
+    }
+
+    return priv->routes;
 }
@@ -2941,6 +2941,7 @@ test_nml_dbus_meta(void)
             if (!NM_IN_STRSET(mif->dbus_iface_name,
                               NM_DBUS_INTERFACE_AGENT_MANAGER,
                               NM_DBUS_INTERFACE_DEVICE_STATISTICS,
+                              NM_DBUS_INTERFACE_DEVICE_LINK_STATS,
                               NM_DBUS_INTERFACE_DEVICE_VETH))
                 g_error("D-Bus interface \"%s\" is unexpectedly empty", mif->dbus_iface_name);
             if (mif->n_dbus_properties == 0)
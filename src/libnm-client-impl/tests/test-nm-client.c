@@ -6,6 +6,7 @@
 #include "libnm-client-impl/nm-default-libnm.h"
 
 #include <sys/types.h>
+#include <sys/resource.h>
 #include <signal.h>
 
 #include "libnm-client-test/nm-test-libnm-utils.h"
@@ -1349,6 +1350,368 @@ test_connection_invalid(void)
 
 /*****************************************************************************/
 
+static void
+test_lazy_properties(void)
+{
+    nmtstc_auto_service_cleanup NMTstcServiceInfo *sinfo       = NULL;
+    gs_unref_object NMClient                      *client      = NULL;
+    gs_unref_object NMClient                      *client_lazy = NULL;
+    NMDevice                                      *device;
+    NMDevice                                      *device_lazy;
+    int                                            IS_IPv4;
+
+    sinfo = nmtstc_service_init();
+    if (!nmtstc_service_available(sinfo))
+        return;
+
+    client = nmtstc_client_new(TRUE);
+    nmtstc_service_add_device(sinfo, client, "AddWiredDevice", "eth0");
+
+    /* Create new instances, so that both see the complete device right
+     * from the start. */
+    g_clear_object(&client);
+    client = nmtstc_client_new(TRUE);
+
+    device = nm_client_get_device_by_iface(client, "eth0");
+    g_assert(NM_IS_DEVICE_ETHERNET(device));
+
+    client_lazy = nmtstc_context_object_new(NM_TYPE_CLIENT,
+                                            TRUE,
+                                            NM_CLIENT_INSTANCE_FLAGS,
+                                            (guint) NM_CLIENT_INSTANCE_FLAGS_LAZY_PROPERTIES,
+                                            NULL);
+    g_assert_cmpint(nm_client_get_instance_flags(client_lazy),
+                    ==,
+                    NM_CLIENT_INSTANCE_FLAGS_LAZY_PROPERTIES);
+
+    device_lazy = nm_client_get_device_by_iface(client_lazy, "eth0");
+    g_assert(NM_IS_DEVICE_ETHERNET(device_lazy));
+
+    for (IS_IPv4 = 1; IS_IPv4 >= 0; IS_IPv4--) {
+        NMIPConfig *config;
+        NMIPConfig *config_lazy;
+        GPtrArray  *arr;
+        GPtrArray  *arr_lazy;
+        guint       i;
+
+        config      = IS_IPv4 ? nm_device_get_ip4_config(device) : nm_device_get_ip6_config(device);
+        config_lazy = IS_IPv4 ? nm_device_get_ip4_config(device_lazy)
+                              : nm_device_get_ip6_config(device_lazy);
+        g_assert(NM_IS_IP_CONFIG(config));
+        g_assert(NM_IS_IP_CONFIG(config_lazy));
+
+        arr      = nm_ip_config_get_addresses(config);
+        arr_lazy = nm_ip_config_get_addresses(config_lazy);
+        g_assert_cmpint(arr->len, ==, arr_lazy->len);
+        for (i = 0; i < arr->len; i++)
+            g_assert(nm_ip_address_equal(arr->pdata[i], arr_lazy->pdata[i]));
+
+        /* The converted value is kept. */
+        g_assert(arr_lazy == nm_ip_config_get_addresses(config_lazy));
+
+        arr      = nm_ip_config_get_routes(config);
+        arr_lazy = nm_ip_config_get_routes(config_lazy);
+        g_assert_cmpint(arr->len, ==, arr_lazy->len);
+        for (i = 0; i < arr->len; i++)
+            g_assert(nm_ip_route_equal(arr->pdata[i], arr_lazy->pdata[i]));
+        g_assert(arr_lazy == nm_ip_config_get_routes(config_lazy));
+    }
+}
+
+/*****************************************************************************/
+
+static void
+test_skip_objects(void)
+{
+    nmtstc_auto_service_cleanup NMTstcServiceInfo *sinfo       = NULL;
+    gs_unref_object NMClient                      *client      = NULL;
+    gs_unref_object NMClient                      *client_skip = NULL;
+    gs_unref_object NMConnection                  *connection  = NULL;
+    NMDevice                                      *device;
+    NMDevice                                      *device_skip;
+
+    sinfo = nmtstc_service_init();
+    if (!nmtstc_service_available(sinfo))
+        return;
+
+    client = nmtstc_client_new(TRUE);
+    nmtstc_service_add_device(sinfo, client, "AddWiredDevice", "eth0");
+
+    connection = nmtst_create_minimal_connection("test-skip-objects",
+                                                 NULL,
+                                                 NM_SETTING_WIRED_SETTING_NAME,
+                                                 NULL);
+    nmtst_connection_normalize(connection);
+    nmtstc_service_add_connection(sinfo, connection, TRUE, NULL);
+
+    g_clear_object(&client);
+    client = nmtstc_client_new(TRUE);
+
+    client_skip = nmtstc_context_object_new(NM_TYPE_CLIENT,
+                                            TRUE,
+                                            NM_CLIENT_INSTANCE_FLAGS,
+                                            (guint) (NM_CLIENT_INSTANCE_FLAGS_SKIP_IP_CONFIGS
+                                                     | NM_CLIENT_INSTANCE_FLAGS_SKIP_CONNECTIONS),
+                                            NULL);
+
+    device      = nm_client_get_device_by_iface(client, "eth0");
+    device_skip = nm_client_get_device_by_iface(client_skip, "eth0");
+    g_assert(NM_IS_DEVICE_ETHERNET(device));
+    g_assert(NM_IS_DEVICE_ETHERNET(device_skip));
+
+    g_assert(NM_IS_IP_CONFIG(nm_device_get_ip4_config(device)));
+    g_assert(NM_IS_IP_CONFIG(nm_device_get_ip6_config(device)));
+    g_assert(!nm_device_get_ip4_config(device_skip));
+    g_assert(!nm_device_get_ip6_config(device_skip));
+    g_assert(!nm_device_get_dhcp4_config(device_skip));
+    g_assert(!nm_device_get_dhcp6_config(device_skip));
+
+    g_assert_cmpint(nm_client_get_connections(client)->len, ==, 1);
+    g_assert_cmpint(nm_client_get_connections(client_skip)->len, ==, 0);
+}
+
+/*****************************************************************************/
+
+typedef struct {
+    GMainLoop *loop;
+    NMClient  *client;
+    guint      n_notify;
+    guint      n_notify_expected;
+} BenchData;
+
+static guint
+_bench_getenv_uint(const char *name, guint default_value)
+{
+    return _nm_utils_ascii_str_to_int64(g_getenv(name), 10, 0, G_MAXUINT32, default_value);
+}
+
+static void
+_bench_call(NMTstcServiceInfo *sinfo, const char *method, GVariant *parameters)
+{
+    gs_unref_variant GVariant *result = NULL;
+    gs_free_error GError      *error  = NULL;
+
+    result = g_dbus_proxy_call_sync(sinfo->proxy,
+                                    method,
+                                    parameters,
+                                    G_DBUS_CALL_FLAGS_NO_AUTO_START,
+                                    30000,
+                                    NULL,
+                                    &error);
+    g_assert_no_error(error);
+}
+
+static void
+_bench_add_set_property(GVariantBuilder *builder,
+                        const char      *path,
+                        const char      *interface_name,
+                        const char      *property_name,
+                        GVariant        *value)
+{
+    GVariantBuilder builder_props;
+    GVariantBuilder builder_ifaces;
+
+    g_variant_builder_init(&builder_props, G_VARIANT_TYPE("a(sv)"));
+    g_variant_builder_add(&builder_props, "(sv)", property_name, value);
+    g_variant_builder_init(&builder_ifaces, G_VARIANT_TYPE("a(sa(sv))"));
+    g_variant_builder_add(&builder_ifaces, "(sa(sv))", interface_name, &builder_props);
+    g_variant_builder_add(builder, "(oa(sa(sv)))", path, &builder_ifaces);
+}
+
+static GVariant *
+_bench_route_data(guint n_routes)
+{
+    GVariantBuilder builder;
+    guint           i;
+
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("aa{sv}"));
+    for (i = 0; i < n_routes; i++) {
+        GVariantBuilder route_builder;
+        char            sbuf[NM_UTILS_INET_ADDRSTRLEN];
+
+        g_variant_builder_init(&route_builder, G_VARIANT_TYPE("a{sv}"));
+        g_variant_builder_add(
+            &route_builder,
+            "{sv}",
+            "dest",
+            g_variant_new_string(_nm_utils_inet4_ntop(htonl(0x0A000000u | ((i & 0xFFFFu) << 8)),
+                                                      sbuf)));
+        g_variant_builder_add(&route_builder, "{sv}", "prefix", g_variant_new_uint32(24));
+        g_variant_builder_add(&route_builder, "{sv}", "metric", g_variant_new_uint32(100 + i));
+        g_variant_builder_add(&builder, "a{sv}", &route_builder);
+    }
+    return g_variant_builder_end(&builder);
+}
+
+static void
+_bench_client_new_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    BenchData            *bench = user_data;
+    gs_free_error GError *error = NULL;
+
+    bench->client = nm_client_new_finish(result, &error);
+    g_assert_no_error(error);
+    g_main_loop_quit(bench->loop);
+}
+
+static void
+_bench_notify_cb(GObject *object, GParamSpec *pspec, gpointer user_data)
+{
+    BenchData *bench = user_data;
+
+    if (++bench->n_notify == bench->n_notify_expected)
+        g_main_loop_quit(bench->loop);
+}
+
+static void
+test_client_new_performance(void)
+{
+    nmtstc_auto_service_cleanup NMTstcServiceInfo *sinfo  = NULL;
+    gs_unref_object NMClient                      *client = NULL;
+    BenchData                                      bench  = {};
+    const guint     n_devices     = _bench_getenv_uint("NMTST_BENCH_DEVICES", 20);
+    const guint     n_aps         = _bench_getenv_uint("NMTST_BENCH_APS", 50);
+    const guint     n_connections = _bench_getenv_uint("NMTST_BENCH_CONNECTIONS", 200);
+    const guint     n_routes      = _bench_getenv_uint("NMTST_BENCH_ROUTES", 500);
+    const GPtrArray *devices;
+    GVariantBuilder  builder;
+    struct rusage    ru_before;
+    struct rusage    ru_after;
+    gint64           start_time;
+    guint            i;
+    guint            j;
+
+    if (nmtst_test_skip_slow())
+        return;
+
+    sinfo = nmtstc_service_init();
+    if (!nmtstc_service_available(sinfo))
+        return;
+
+    /* Populate the stub service. @n_aps and @n_routes are per device. */
+    client = nmtstc_client_new(TRUE);
+    for (i = 0; i < n_devices; i++) {
+        char ifname[32];
+
+        nm_sprintf_buf(ifname, "wlan%u", i);
+        nmtstc_service_add_device(sinfo, client, "AddWifiDevice", ifname);
+        for (j = 0; j < n_aps; j++) {
+            char ssid[64];
+            char bssid[sizeof("00:00:00:00:00:00")];
+
+            nm_sprintf_buf(ssid, "bench-%u-%u", i, j);
+            nm_sprintf_buf(bssid, "02:00:%02X:%02X:%02X:%02X", i >> 8, i & 0xFF, j >> 8, j & 0xFF);
+            _bench_call(sinfo, "AddWifiAp", g_variant_new("(sss)", ifname, ssid, bssid));
+        }
+    }
+    for (i = 0; i < n_connections; i++) {
+        gs_unref_object NMConnection *connection = NULL;
+        char                          id[64];
+
+        connection = nmtst_create_minimal_connection(nm_sprintf_buf(id, "bench-%u", i),
+                                                     NULL,
+                                                     NM_SETTING_WIRED_SETTING_NAME,
+                                                     NULL);
+        nmtst_connection_normalize(connection);
+        nmtstc_service_add_connection(sinfo, connection, TRUE, NULL);
+    }
+    g_clear_object(&client);
+
+    client  = nmtstc_client_new(TRUE);
+    devices = nm_client_get_devices(client);
+    g_assert_cmpint(devices->len, ==, n_devices);
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a(oa(sa(sv)))"));
+    for (i = 0; i < devices->len; i++) {
+        NMIPConfig *config = nm_device_get_ip4_config(devices->pdata[i]);
+
+        g_assert(NM_IS_IP_CONFIG(config));
+        _bench_add_set_property(&builder,
+                                nm_object_get_path(NM_OBJECT(config)),
+                                NM_DBUS_INTERFACE_IP4_CONFIG,
+                                "RouteData",
+                                _bench_route_data(n_routes));
+    }
+    _bench_call(sinfo,
+                "SetProperties",
+                g_variant_new("(@a(oa(sa(sv))))", g_variant_builder_end(&builder)));
+    g_clear_object(&client);
+
+    /* Measure the time until a new instance is ready. */
+    bench.loop = g_main_loop_new(NULL, FALSE);
+    getrusage(RUSAGE_SELF, &ru_before);
+    start_time = nmtst_benchmark_start();
+    nm_client_new_async(NULL, _bench_client_new_cb, &bench);
+    nmtst_main_loop_run_assert(bench.loop, 60000);
+    getrusage(RUSAGE_SELF, &ru_after);
+    nmtst_benchmark_report(start_time,
+                           0,
+                           NULL,
+                           "nm_client_new_async() with %u devices, %u access points, %u profiles "
+                           "and %u routes (peak RSS %ld KiB, %+ld KiB) ready",
+                           n_devices,
+                           n_devices * n_aps,
+                           n_connections,
+                           n_devices * n_routes,
+                           (long) ru_after.ru_maxrss,
+                           (long) (ru_after.ru_maxrss - ru_before.ru_maxrss));
+
+    g_assert(NM_IS_CLIENT(bench.client));
+    g_assert_cmpint(nm_client_get_devices(bench.client)->len, ==, n_devices);
+    g_assert_cmpint(nm_client_get_connections(bench.client)->len, ==, n_connections);
+
+    /* Measure how fast PropertiesChanged signals are processed. Change the
+     * strength of every access point in one go and wait until the client
+     * has seen all of them. */
+    devices = nm_client_get_devices(bench.client);
+    g_variant_builder_init(&builder, G_VARIANT_TYPE("a(oa(sa(sv)))"));
+    for (i = 0; i < devices->len; i++) {
+        const GPtrArray *aps = nm_device_wifi_get_access_points(devices->pdata[i]);
+
+        g_assert_cmpint(aps->len, ==, n_aps);
+        for (j = 0; j < aps->len; j++) {
+            NMAccessPoint *ap = aps->pdata[j];
+
+            g_signal_connect(ap,
+                             "notify::" NM_ACCESS_POINT_STRENGTH,
+                             G_CALLBACK(_bench_notify_cb),
+                             &bench);
+            _bench_add_set_property(
+                &builder,
+                nm_object_get_path(NM_OBJECT(ap)),
+                NM_DBUS_INTERFACE_ACCESS_POINT,
+                "Strength",
+                g_variant_new_byte((nm_access_point_get_strength(ap) + 1) % 100));
+            bench.n_notify_expected++;
+        }
+    }
+
+    if (bench.n_notify_expected > 0) {
+        start_time = nmtst_benchmark_start();
+        _bench_call(sinfo,
+                    "SetProperties",
+                    g_variant_new("(@a(oa(sa(sv))))", g_variant_builder_end(&builder)));
+        nmtst_main_loop_run_assert(bench.loop, 60000);
+        nmtst_benchmark_report(start_time,
+                               bench.n_notify_expected,
+                               "signals",
+                               "processed %u PropertiesChanged signals",
+                               bench.n_notify_expected);
+    } else
+        g_variant_builder_clear(&builder);
+
+    for (i = 0; i < devices->len; i++) {
+        const GPtrArray *aps = nm_device_wifi_get_access_points(devices->pdata[i]);
+
+        for (j = 0; j < aps->len; j++)
+            g_signal_handlers_disconnect_by_func(aps->pdata[j], _bench_notify_cb, &bench);
+    }
+
+    g_clear_object(&bench.client);
+    g_main_loop_unref(bench.loop);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -1369,6 +1732,9 @@ main(int argc, char **argv)
     g_test_add_func("/libnm/activate-virtual", test_activate_virtual);
     g_test_add_func("/libnm/device-connection-compatibility", test_device_connection_compatibility);
     g_test_add_func("/libnm/connection/invalid", test_connection_invalid);
+    g_test_add_func("/libnm/lazy-properties", test_lazy_properties);
+    g_test_add_func("/libnm/skip-objects", test_skip_objects);
+    g_test_add_func("/libnm/client-new-performance", test_client_new_performance);
 
     return g_test_run();
 }
@@ -69,6 +69,63 @@ test_add_connection(void)
 
 /*****************************************************************************/
 
+static void
+add_connections_cb(GObject *s, GAsyncResult *result, gpointer user_data)
+{
+    char ***out_paths = user_data;
+    GError *error     = NULL;
+
+    *out_paths = nm_client_add_connections_finish(gl.client, result, NULL, &error);
+    nmtst_assert_success(*out_paths, error);
+}
+
+static void
+test_add_connections(void)
+{
+    gs_unref_ptrarray GPtrArray *connections = NULL;
+    gs_strfreev char           **paths       = NULL;
+    guint                        i;
+
+    if (!nmtstc_service_available(gl.sinfo))
+        return;
+
+    connections = g_ptr_array_new_with_free_func(g_object_unref);
+    for (i = 0; i < 3; i++) {
+        gs_free char *id = g_strdup_printf("add-connections-%u", i);
+
+        g_ptr_array_add(
+            connections,
+            nmtst_create_minimal_connection(id, NULL, NM_SETTING_WIRED_SETTING_NAME, NULL));
+    }
+
+    nm_client_add_connections_async(gl.client,
+                                    connections,
+                                    NM_SETTINGS_ADD_CONNECTION2_FLAG_TO_DISK,
+                                    NULL,
+                                    NULL,
+                                    add_connections_cb,
+                                    &paths);
+
+    nmtst_main_context_iterate_until_assert(NULL, 5000, paths);
+
+    g_assert_cmpint(NM_PTRARRAY_LEN(paths), ==, connections->len);
+
+    for (i = 0; i < connections->len; i++) {
+        NMRemoteConnection *remote;
+
+        nmtst_main_context_iterate_until_assert(
+            NULL,
+            5000,
+            (remote = nm_client_get_connection_by_path(gl.client, paths[i])));
+
+        g_assert_cmpstr(nm_connection_get_uuid(NM_CONNECTION(remote)),
+                        ==,
+                        nm_connection_get_uuid(connections->pdata[i]));
+    }
+}
+
+/*****************************************************************************/
+
 static void
 set_visible_cb(GObject *proxy, GAsyncResult *result, gpointer user_data)
 {
@@ -487,6 +544,7 @@ main(int argc, char **argv)
     g_test_add_func("/client/add_remove_connection", test_add_remove_connection);
     g_test_add_func("/client/add_bad_connection", test_add_bad_connection);
     g_test_add_func("/client/save_hostname", test_save_hostname);
+    g_test_add_func("/client/add_connections", test_add_connections);
 
     ret = g_test_run();
 
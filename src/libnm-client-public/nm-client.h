@@ -22,12 +22,35 @@ G_BEGIN_DECLS
  *   can be disabled. You can toggle this flag to enable and disable automatic
  *   fetching of the permissions. Watch also nm_client_get_permissions_state()
  *   to know whether the permissions are up to date.
+ * @NM_CLIENT_INSTANCE_FLAGS_LAZY_PROPERTIES: by default, NMClient converts
+ *   all property values right when it receives them from D-Bus. With this
+ *   flag, NMClient keeps the received value of expensive properties, like
+ *   the addresses and routes of #NMIPConfig, and only converts it when the
+ *   property is accessed for the first time. This is useful for clients that
+ *   only look at a few properties. The flag can only be set when constructing
+ *   the instance. Since 1.40.
+ * @NM_CLIENT_INSTANCE_FLAGS_SKIP_ACCESS_POINTS: don't track Wi-Fi access
+ *   points. nm_device_wifi_get_access_points() returns an empty list and
+ *   nm_device_wifi_get_active_access_point() returns %NULL. The flag can
+ *   only be set when constructing the instance. Since 1.40.
+ * @NM_CLIENT_INSTANCE_FLAGS_SKIP_IP_CONFIGS: don't track IP and DHCP
+ *   configuration objects. The functions that return a #NMIPConfig or
+ *   #NMDhcpConfig of a device or active connection return %NULL. The flag can
+ *   only be set when constructing the instance. Since 1.40.
+ * @NM_CLIENT_INSTANCE_FLAGS_SKIP_CONNECTIONS: don't track connection profiles.
+ *   nm_client_get_connections() returns an empty list and properties of other
+ *   objects that refer to a #NMRemoteConnection are %NULL or empty. The flag can
+ *   only be set when constructing the instance. Since 1.40.
  *
  * Since: 1.24
  */
 typedef enum /*< flags >*/ {
     NM_CLIENT_INSTANCE_FLAGS_NONE                      = 0,
     NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS = 1,
+    NM_CLIENT_INSTANCE_FLAGS_LAZY_PROPERTIES           = 2,
+    NM_CLIENT_INSTANCE_FLAGS_SKIP_ACCESS_POINTS        = 4,
+    NM_CLIENT_INSTANCE_FLAGS_SKIP_IP_CONFIGS           = 8,
+    NM_CLIENT_INSTANCE_FLAGS_SKIP_CONNECTIONS          = 16,
 } NMClientInstanceFlags;
 
 #define NM_TYPE_CLIENT            (nm_client_get_type())
@@ -368,6 +391,21 @@ NMRemoteConnection *nm_client_add_connection2_finish(NMClient     *client,
                                                      GVariant    **out_result,
                                                      GError      **error);
 
+NM_AVAILABLE_IN_1_40
+void nm_client_add_connections_async(NMClient                     *client,
+                                     const GPtrArray              *connections,
+                                     NMSettingsAddConnection2Flags flags,
+                                     GVariant                     *args,
+                                     GCancellable                 *cancellable,
+                                     GAsyncReadyCallback           callback,
+                                     gpointer                      user_data);
+
+NM_AVAILABLE_IN_1_40
+char **nm_client_add_connections_finish(NMClient     *client,
+                                        GAsyncResult *result,
+                                        GVariant    **out_result,
+                                        GError      **error);
+
 _NM_DEPRECATED_SYNC_METHOD
 gboolean nm_client_load_connections(NMClient     *client,
                                     char        **filenames,
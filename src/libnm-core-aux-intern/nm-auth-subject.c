@@ -151,6 +151,14 @@ nm_auth_subject_get_unix_process_uid(NMAuthSubject *subject)
     return priv->unix_process.uid;
 }
 
+guint64
+nm_auth_subject_get_unix_process_start_time(NMAuthSubject *subject)
+{
+    CHECK_SUBJECT_TYPED(subject, NM_AUTH_SUBJECT_TYPE_UNIX_PROCESS, 0);
+
+    return priv->unix_process.start_time;
+}
+
 const char *
 nm_auth_subject_get_unix_process_dbus_sender(NMAuthSubject *subject)
 {
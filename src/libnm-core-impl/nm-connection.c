@@ -141,21 +141,54 @@ _nm_connection_get_private_from_qdata(NMConnection *connection)
 
 /*****************************************************************************/
 
+static struct {
+    int hits;
+    int misses;
+} _verify_cache_stats;
+
+static void
+_verify_cache_invalidate(NMConnection *self)
+{
+    NM_CONNECTION_GET_PRIVATE(self)->verify_success_cached = FALSE;
+}
+
+/**
+ * _nm_connection_verify_cache_get_stats:
+ * @out_hits: (out) (allow-none): the number of times _nm_connection_verify()
+ *   could return a cached result.
+ * @out_misses: (out) (allow-none): the number of times _nm_connection_verify()
+ *   had to verify the settings.
+ *
+ * The counters are process wide. They are only meant for debugging and
+ * statistics.
+ */
+void
+_nm_connection_verify_cache_get_stats(guint *out_hits, guint *out_misses)
+{
+    NM_SET_OUT(out_hits, (guint) g_atomic_int_get(&_verify_cache_stats.hits));
+    NM_SET_OUT(out_misses, (guint) g_atomic_int_get(&_verify_cache_stats.misses));
+}
+
+/*****************************************************************************/
+
 static void
 _signal_emit_changed(NMConnection *self)
 {
+    _verify_cache_invalidate(self);
     g_signal_emit(self, signals[CHANGED], 0);
 }
 
 static void
 _signal_emit_secrets_updated(NMConnection *self, const char *setting_name)
 {
+    _verify_cache_invalidate(self);
     g_signal_emit(self, signals[SECRETS_UPDATED], 0, setting_name);
 }
 
 static void
 _signal_emit_secrets_cleared(NMConnection *self)
 {
+    _verify_cache_invalidate(self);
     g_signal_emit(self, signals[SECRETS_CLEARED], 0);
 }
 
@@ -184,6 +217,8 @@ _setting_notify_disconnect(NMConnection *connection, NMSetting *setting)
 static void
 _setting_notify_block(NMConnection *connection, NMSetting *setting)
 {
+    /* the setting is about to be modified without notifying us. */
+    _verify_cache_invalidate(connection);
     g_signal_handlers_block_by_func(setting, G_CALLBACK(_setting_notify_changed_cb), connection);
 }
 
@@ -201,6 +236,8 @@ _nm_connection_clear_settings(NMConnection *connection, NMConnectionPrivate *pri
     gboolean changed = FALSE;
     int      i;
 
+    priv->verify_success_cached = FALSE;
+
     for (i = 0; i < (int) _NM_META_SETTING_TYPE_NUM; i++) {
         if (priv->settings[i]) {
             _setting_notify_disconnect(connection, priv->settings[i]);
@@ -232,6 +269,7 @@ _nm_connection_add_setting(NMConnection *connection, NMSetting *setting)
         return;
 
     priv->settings[setting_info->meta_type] = setting;
+    priv->verify_success_cached             = FALSE;
 
     _setting_notify_connect(connection, setting);
 
@@ -688,8 +726,16 @@ nm_connection_replace_settings_from_connection(NMConnection *connection,
         }
     }
 
-    if (changed)
-        _signal_emit_changed(connection);
+    if (changed) {
+        /* The settings are now deep copies of those in @new_connection. If that one
+         * is known to verify, so is @connection. That way, clones of a verified
+         * connection (nm_simple_connection_new_clone()) don't need to be verified
+         * anew. Should a "changed" handler modify @connection, that invalidates
+         * the cache again. */
+        priv->verify_success_cached = new_priv->verify_success_cached;
+        priv->verify_success_hash   = new_priv->verify_success_hash;
+        g_signal_emit(connection, signals[CHANGED], 0);
+    }
 }
 
 /**
@@ -1782,10 +1828,9 @@ nm_connection_verify(NMConnection *connection, GError **error)
     return result == NM_SETTING_VERIFY_SUCCESS || result == NM_SETTING_VERIFY_NORMALIZABLE;
 }
 
-NMSettingVerifyResult
-_nm_connection_verify(NMConnection *connection, GError **error)
+static NMSettingVerifyResult
+_connection_verify(NMConnection *connection, NMConnectionPrivate *priv, GError **error)
 {
-    NMConnectionPrivate  *priv;
     NMSettingIPConfig    *s_ip4;
     NMSettingIPConfig    *s_ip6;
     NMSettingProxy       *s_proxy;
@@ -1793,11 +1838,6 @@ _nm_connection_verify(NMConnection *connection, GError **error)
     NMSettingVerifyResult normalizable_error_type = NM_SETTING_VERIFY_SUCCESS;
     int                   i;
 
-    g_return_val_if_fail(NM_IS_CONNECTION(connection), NM_SETTING_VERIFY_ERROR);
-    g_return_val_if_fail(!error || !*error, NM_SETTING_VERIFY_ERROR);
-
-    priv = NM_CONNECTION_GET_PRIVATE(connection);
-
     if (!_connection_get_setting_by_meta_type(priv, NM_META_SETTING_TYPE_CONNECTION)) {
         g_set_error_literal(error,
                             NM_CONNECTION_ERROR,
@@ -1936,6 +1976,56 @@ _nm_connection_verify(NMConnection *connection, GError **error)
     return NM_SETTING_VERIFY_SUCCESS;
 }
 
+static guint64
+_connection_hash_content(NMConnection *connection)
+{
+    gs_unref_variant GVariant *variant = NULL;
+
+    variant = nm_connection_to_dbus(connection, NM_CONNECTION_SERIALIZE_ALL);
+    if (!variant)
+        return 0;
+
+    g_variant_ref_sink(variant);
+    return nm_hash_siphash42(1320158941u, g_variant_get_data(variant), g_variant_get_size(variant));
+}
+
+NMSettingVerifyResult
+_nm_connection_verify(NMConnection *connection, GError **error)
+{
+    NMConnectionPrivate  *priv;
+    NMSettingVerifyResult result;
+
+    g_return_val_if_fail(NM_IS_CONNECTION(connection), NM_SETTING_VERIFY_ERROR);
+    g_return_val_if_fail(!error || !*error, NM_SETTING_VERIFY_ERROR);
+
+    priv = NM_CONNECTION_GET_PRIVATE(connection);
+
+    /* Profiles get verified over and over (on load, on update, and for each
+     * clone that is made along the way). Remember a successful result, keyed
+     * by a hash of the content. Boxed values like NMIPRoute or NMSriovVF can
+     * be modified in place without the connection noticing, so the "changed"
+     * signal alone is not enough. Only success is cached, because then there
+     * is no error to return. */
+    if (priv->verify_success_cached
+        && priv->verify_success_hash == _connection_hash_content(connection)) {
+        g_atomic_int_inc(&_verify_cache_stats.hits);
+#if NM_MORE_ASSERTS > 10
+        nm_assert(_connection_verify(connection, priv, NULL) == NM_SETTING_VERIFY_SUCCESS);
+#endif
+        return NM_SETTING_VERIFY_SUCCESS;
+    }
+
+    g_atomic_int_inc(&_verify_cache_stats.misses);
+
+    result = _connection_verify(connection, priv, error);
+    if (result == NM_SETTING_VERIFY_SUCCESS) {
+        priv->verify_success_hash   = _connection_hash_content(connection);
+        priv->verify_success_cached = TRUE;
+    } else
+        priv->verify_success_cached = FALSE;
+    return result;
+}
+
 /**
  * nm_connection_verify_secrets:
  * @connection: the #NMConnection to verify in
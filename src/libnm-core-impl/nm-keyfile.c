@@ -3202,6 +3202,68 @@ _parse_info_find(NMSetting                *setting,
     NM_SET_OUT(out_parse_info_property, pip);
 }
 
+/* Like _parse_info_find(), but for a @property_info from the setting's
+ * NMSettInfoSetting.property_infos array. The reader and the writer call this
+ * for every property of every setting, so instead of binary searching the
+ * parse_infos by name each time, we lazily create (once per setting type) a
+ * table that is indexed by the property's position in property_infos. */
+static void
+_parse_info_find_for_property(NMSetting                *setting,
+                              const NMSettInfoProperty *property_info,
+                              const NMMetaSettingInfo **out_setting_info,
+                              const ParseInfoProperty **out_parse_info_property)
+{
+    static gpointer           pips_by_idx[_NM_META_SETTING_TYPE_NUM];
+    const NMSettInfoSetting  *sett_info;
+    const NMMetaSettingInfo  *setting_info;
+    const ParseInfoProperty **pips;
+    gsize                     idx;
+
+    if (!NM_IS_SETTING(setting) || !(setting_info = NM_SETTING_GET_CLASS(setting)->setting_info)) {
+        /* handle invalid setting objects gracefully. */
+        NM_SET_OUT(out_setting_info, NULL);
+        NM_SET_OUT(out_parse_info_property, NULL);
+        return;
+    }
+
+    nm_assert(_NM_INT_NOT_NEGATIVE(setting_info->meta_type));
+    nm_assert(setting_info->meta_type < G_N_ELEMENTS(pips_by_idx));
+
+    sett_info = _nm_setting_class_get_sett_info(NM_SETTING_GET_CLASS(setting));
+
+    nm_assert(property_info >= sett_info->property_infos);
+    nm_assert(property_info < &sett_info->property_infos[sett_info->property_infos_len]);
+
+    idx = property_info - sett_info->property_infos;
+
+again:
+    pips = g_atomic_pointer_get(&pips_by_idx[setting_info->meta_type]);
+    if (G_UNLIKELY(!pips)) {
+        guint16 i;
+
+        pips = g_new0(const ParseInfoProperty *, NM_MAX(sett_info->property_infos_len, 1u));
+        for (i = 0; i < sett_info->property_infos_len; i++)
+            _parse_info_find(setting, sett_info->property_infos[i].name, NULL, NULL, &pips[i]);
+
+        if (!g_atomic_pointer_compare_and_exchange(&pips_by_idx[setting_info->meta_type],
+                                                   NULL,
+                                                   (gpointer) pips)) {
+            g_free(pips);
+            goto again;
+        }
+    }
+
+    nm_assert(({
+        const ParseInfoProperty *_pip;
+
+        _parse_info_find(setting, property_info->name, NULL, NULL, &_pip);
+        _pip == pips[idx];
+    }));
+
+    NM_SET_OUT(out_setting_info, setting_info);
+    NM_SET_OUT(out_parse_info_property, pips[idx]);
+}
+
 /*****************************************************************************/
 
 static void
@@ -3225,7 +3287,7 @@ read_one_setting_value(KeyfileReaderInfo        *info,
 
     key = property_info->name;
 
-    _parse_info_find(setting, key, &setting_info, NULL, &pip);
+    _parse_info_find_for_property(setting, property_info, &setting_info, &pip);
 
     nm_assert(setting_info);
 
@@ -3931,7 +3993,7 @@ write_setting_value(KeyfileWriterInfo        *info,
 
     key = property_info->name;
 
-    _parse_info_find(setting, key, &setting_info, NULL, &pip);
+    _parse_info_find_for_property(setting, property_info, &setting_info, &pip);
 
     if (pip && pip->has_writer_full) {
         pip->writer_full(info, setting_info, property_info, pip, setting);
@@ -26,6 +26,12 @@ typedef struct {
 
     /* D-Bus path of the connection, if any */
     char *path;
+
+    /* The content hash of the connection when _nm_connection_verify() last
+     * found it valid. Only meaningful if @verify_success_cached is set, which
+     * gets cleared whenever the connection notifies about a change. */
+    guint64 verify_success_hash;
+    bool    verify_success_cached : 1;
 } NMConnectionPrivate;
 
 extern GTypeClass *_nm_simple_connection_class_instance;
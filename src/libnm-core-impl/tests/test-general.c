@@ -6071,6 +6071,89 @@ test_connection_normalize_type(void)
     }
 }
 
+static void
+test_connection_verify_cache(void)
+{
+    gs_unref_object NMConnection *con   = NULL;
+    gs_unref_object NMConnection *clone = NULL;
+    gs_free_error GError         *error = NULL;
+    NMSettingConnection          *s_con;
+    NMSettingIPConfig            *s_ip4;
+    NMIPRoute                    *route;
+    guint                         hits;
+    guint                         misses;
+    guint                         hits2;
+    guint                         misses2;
+
+    con = nmtst_create_minimal_connection("test-verify-cache",
+                                          NULL,
+                                          NM_SETTING_WIRED_SETTING_NAME,
+                                          &s_con);
+    nmtst_connection_normalize(con);
+
+    /* the first verification is a miss, the following ones are cached. */
+    _nm_connection_verify_cache_get_stats(&hits, &misses);
+    g_assert_cmpint(_nm_connection_verify(con, NULL), ==, NM_SETTING_VERIFY_SUCCESS);
+    g_assert_cmpint(_nm_connection_verify(con, NULL), ==, NM_SETTING_VERIFY_SUCCESS);
+    g_assert(nm_connection_verify(con, NULL));
+    _nm_connection_verify_cache_get_stats(&hits2, &misses2);
+    g_assert_cmpint(misses2, ==, misses + 1);
+    g_assert_cmpint(hits2, ==, hits + 2);
+
+    /* a clone of a verified connection is known to verify too. */
+    clone = nm_simple_connection_new_clone(con);
+    g_assert(nm_connection_verify(clone, NULL));
+    _nm_connection_verify_cache_get_stats(&hits, &misses);
+    g_assert_cmpint(misses, ==, misses2);
+    g_assert_cmpint(hits, ==, hits2 + 1);
+
+    /* modifying the connection invalidates the cached result. */
+    g_object_set(s_con, NM_SETTING_CONNECTION_ID, NULL, NULL);
+    g_assert(!nm_connection_verify(con, &error));
+    g_assert_error(error, NM_CONNECTION_ERROR, NM_CONNECTION_ERROR_MISSING_PROPERTY);
+    g_clear_error(&error);
+    g_assert(!nm_connection_verify(con, NULL));
+    _nm_connection_verify_cache_get_stats(&hits2, &misses2);
+    g_assert_cmpint(misses2, ==, misses + 2);
+    g_assert_cmpint(hits2, ==, hits);
+
+    /* ... without affecting the clone. */
+    g_assert(nm_connection_verify(clone, NULL));
+
+    g_object_set(s_con, NM_SETTING_CONNECTION_ID, "test-verify-cache", NULL);
+    g_assert(nm_connection_verify(con, NULL));
+    g_assert(nm_connection_verify(con, NULL));
+    _nm_connection_verify_cache_get_stats(&hits, &misses);
+    g_assert_cmpint(misses, ==, misses2 + 1);
+    g_assert_cmpint(hits, ==, hits2 + 2);
+
+    /* routes can be modified in place, without the connection noticing. The
+     * cache must not hide that. */
+    s_ip4 = NM_SETTING_IP_CONFIG(nm_setting_ip4_config_new());
+    g_object_set(s_ip4, NM_SETTING_IP_CONFIG_METHOD, NM_SETTING_IP4_CONFIG_METHOD_AUTO, NULL);
+    route = nm_ip_route_new(AF_INET, "192.168.5.0", 24, NULL, -1, &error);
+    nmtst_assert_success(route, error);
+    nm_setting_ip_config_add_route(s_ip4, route);
+    nm_ip_route_unref(route);
+    nm_connection_add_setting(con, NM_SETTING(s_ip4));
+
+    g_assert(nm_connection_verify(con, NULL));
+    g_assert(nm_connection_verify(con, NULL));
+    _nm_connection_verify_cache_get_stats(&hits2, &misses2);
+    g_assert_cmpint(misses2, ==, misses + 1);
+    g_assert_cmpint(hits2, ==, hits + 1);
+
+    route = nm_setting_ip_config_get_route(s_ip4, 0);
+    nm_ip_route_set_attribute(route, NM_IP_ROUTE_ATTRIBUTE_TABLE, g_variant_new_string("x"));
+    g_assert(!nm_connection_verify(con, NULL));
+    _nm_connection_verify_cache_get_stats(&hits, &misses);
+    g_assert_cmpint(misses, ==, misses2 + 1);
+    g_assert_cmpint(hits, ==, hits2);
+
+    nm_ip_route_set_attribute(route, NM_IP_ROUTE_ATTRIBUTE_TABLE, NULL);
+    g_assert(nm_connection_verify(con, NULL));
+}
+
 static void
 test_connection_normalize_slave_type_1(void)
 {
@@ -11074,6 +11157,7 @@ main(int argc, char **argv)
                     test_connection_normalize_virtual_iface_name);
     g_test_add_func("/core/general/test_connection_normalize_uuid", test_connection_normalize_uuid);
     g_test_add_func("/core/general/test_connection_normalize_type", test_connection_normalize_type);
+    g_test_add_func("/core/general/test_connection_verify_cache", test_connection_verify_cache);
     g_test_add_func("/core/general/test_connection_normalize_slave_type_1",
                     test_connection_normalize_slave_type_1);
     g_test_add_func("/core/general/test_connection_normalize_slave_type_2",
@@ -983,6 +983,44 @@ test_invalid_option(void)
 
 /*****************************************************************************/
 
+static void
+test_read_performance(void)
+{
+    const guint                     N_PROFILES = 10000;
+    gs_unref_object NMConnection   *con        = NULL;
+    nm_auto_unref_keyfile GKeyFile *kf         = NULL;
+    gint64                          start_time;
+    guint                           i;
+
+    if (nmtst_test_skip_slow())
+        return;
+
+    con = nmtst_create_minimal_connection("test read performance",
+                                          NULL,
+                                          NM_SETTING_WIRED_SETTING_NAME,
+                                          NULL);
+    nmtst_connection_normalize(con);
+
+    kf = nm_keyfile_write(con, NM_KEYFILE_HANDLER_FLAGS_NONE, NULL, NULL, NULL);
+    g_assert(kf);
+
+    start_time = nmtst_benchmark_start();
+    for (i = 0; i < N_PROFILES; i++) {
+        gs_unref_object NMConnection *con2  = NULL;
+        gs_free_error GError         *error = NULL;
+
+        con2 = nm_keyfile_read(kf, "/", NM_KEYFILE_HANDLER_FLAGS_NONE, NULL, NULL, &error);
+        nmtst_assert_success(con2, error);
+    }
+    nmtst_benchmark_report(start_time,
+                           N_PROFILES,
+                           "profiles",
+                           "read %u keyfile profiles",
+                           N_PROFILES);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -1001,6 +1039,7 @@ main(int argc, char **argv)
     g_test_add_func("/core/keyfile/bridge/vlans", test_bridge_vlans);
     g_test_add_func("/core/keyfile/bridge-port/vlans", test_bridge_port_vlans);
     g_test_add_func("/core/keyfile/invalid-option", test_invalid_option);
+    g_test_add_func("/core/keyfile/read-performance", test_read_performance);
 
     return g_test_run();
 }
@@ -262,6 +262,8 @@ typedef enum {
 
 NMSettingVerifyResult _nm_connection_verify(NMConnection *connection, GError **error);
 
+void _nm_connection_verify_cache_get_stats(guint *out_hits, guint *out_misses);
+
 gboolean _nm_connection_ensure_normalized(NMConnection  *connection,
                                           gboolean       allow_modify,
                                           const char    *expected_uuid,
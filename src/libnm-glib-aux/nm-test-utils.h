@@ -721,6 +721,47 @@ nmtst_test_skip_slow(void)
     return TRUE;
 }
 
+/*****************************************************************************/
+
+/* Benchmarks take the start time with nmtst_benchmark_start() and then call
+ * nmtst_benchmark_report(), which logs the elapsed time via g_test_message().
+ * If @n_items is positive, the rate of @items per second is logged too. */
+
+static inline gint64
+nmtst_benchmark_start(void)
+{
+    return g_get_monotonic_time();
+}
+
+_nm_printf(4, 5) static inline void nmtst_benchmark_report(gint64      start_usec,
+                                                           guint       n_items,
+                                                           const char *items,
+                                                           const char *fmt,
+                                                           ...)
+{
+    gint64        duration = NM_MAX(g_get_monotonic_time() - start_usec, 1);
+    gs_free char *what     = NULL;
+    va_list       ap;
+
+    va_start(ap, fmt);
+    what = g_strdup_vprintf(fmt, ap);
+    va_end(ap);
+
+    if (n_items > 0) {
+        g_test_message("%s in %" G_GINT64_FORMAT ".%06d seconds (%.0f %s/second)",
+                       what,
+                       duration / G_USEC_PER_SEC,
+                       (int) (duration % G_USEC_PER_SEC),
+                       ((double) n_items) * G_USEC_PER_SEC / duration,
+                       items);
+    } else {
+        g_test_message("%s in %" G_GINT64_FORMAT ".%06d seconds",
+                       what,
+                       duration / G_USEC_PER_SEC,
+                       (int) (duration % G_USEC_PER_SEC));
+    }
+}
+
 #if GLIB_CHECK_VERSION(2, 34, 0)
 #undef g_test_expect_message
 #define g_test_expect_message(...)                                                   \
@@ -315,6 +315,7 @@ struct _ifla_vf_vlan_info {
 
 typedef struct {
     guint16 family_id;
+    guint32 mcast_group_id;
 } GenlFamilyData;
 
 /*****************************************************************************/
@@ -480,6 +481,10 @@ typedef struct {
 typedef struct {
     struct nl_sock *sk_genl_sync;
 
+    /* blocking route netlink socket for requests whose replies should not
+     * go through the cache, like RTM_GETSTATS. */
+    struct nl_sock *sk_rtnl_sync;
+
     union {
         struct {
             struct nl_sock *sk_genl;
@@ -5899,7 +5904,8 @@ sysctl_set_async(NMPlatform             *platform,
     task = g_task_new(platform, cancellable, sysctl_async_cb, NULL);
     g_task_set_task_data(task, info, (GDestroyNotify) sysctl_async_info_free);
     g_task_set_return_on_cancel(task, FALSE);
-    g_task_run_in_thread(task, sysctl_async_thread_fn);
+    /* the only user writes "sriov_numvfs", which blocks while the driver creates the VFs. */
+    nmp_utils_worker_run_task(task, NMP_UTILS_WORKER_POOL_SRIOV, sysctl_async_thread_fn);
     g_object_unref(task);
 }
 
@@ -6868,6 +6874,9 @@ cache_on_change(NMPlatform      *platform,
                 ifindex = obj_new->link.ifindex;
 
             if (ifindex > 0) {
+                nm_platform_ethtool_cache_invalidate(platform,
+                                                     ifindex,
+                                                     NM_PLATFORM_ETHTOOL_CACHE_TYPE_ALL);
                 delayed_action_schedule(
                     platform,
                     DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_IP4_ADDRESSES
@@ -8065,6 +8074,44 @@ link_refresh(NMPlatform *platform, int ifindex)
     return !!nm_platform_link_get_obj(platform, ifindex, TRUE);
 }
 
+static void
+refresh_all(NMPlatform *platform, NMPObjectType obj_type)
+{
+    DelayedActionType action_type;
+
+    switch (obj_type) {
+    case NMP_OBJECT_TYPE_LINK:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_LINKS;
+        break;
+    case NMP_OBJECT_TYPE_IP4_ADDRESS:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_IP4_ADDRESSES;
+        break;
+    case NMP_OBJECT_TYPE_IP6_ADDRESS:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_IP6_ADDRESSES;
+        break;
+    case NMP_OBJECT_TYPE_IP4_ROUTE:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_IP4_ROUTES;
+        break;
+    case NMP_OBJECT_TYPE_IP6_ROUTE:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_IP6_ROUTES;
+        break;
+    case NMP_OBJECT_TYPE_ROUTING_RULE:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_ROUTING_RULES_ALL;
+        break;
+    case NMP_OBJECT_TYPE_QDISC:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_QDISCS;
+        break;
+    case NMP_OBJECT_TYPE_TFILTER:
+        action_type = DELAYED_ACTION_TYPE_REFRESH_ALL_RTNL_TFILTERS;
+        break;
+    default:
+        g_return_if_reached();
+    }
+
+    do_request_all_no_delayed_actions(platform, action_type);
+    delayed_action_handle_all(platform);
+}
+
 static gboolean
 link_set_netns(NMPlatform *platform, int ifindex, int netns_fd)
 {
@@ -8405,23 +8452,38 @@ out_idle:
     }
 }
 
-static gboolean
-link_set_sriov_vfs(NMPlatform *platform, int ifindex, const NMPlatformVF *const *vfs)
+/* The VFs are split over several messages. That keeps each message below
+ * the page size that nlmsg_alloc_simple() allocates, and limits how long the
+ * kernel holds the RTNL lock for one request. */
+#define SRIOV_VFS_PER_NLMSG 16
+
+static GPtrArray *
+_nl_msgs_new_sriov_vfs(NMPlatform *platform, int ifindex, const NMPlatformVF *const *vfs)
 {
-    nm_auto_nlmsg struct nl_msg *nlmsg = NULL;
-    struct nlattr               *list, *info, *vlan_list;
+    gs_unref_ptrarray GPtrArray *msgs  = NULL;
+    struct nl_msg               *nlmsg = NULL;
+    struct nlattr               *list  = NULL;
+    struct nlattr               *info, *vlan_list;
     guint                        i;
 
-    nlmsg = _nl_msg_new_link(RTM_NEWLINK, 0, ifindex, NULL);
-    if (!nlmsg)
-        g_return_val_if_reached(-NME_BUG);
-
-    if (!(list = nla_nest_start(nlmsg, IFLA_VFINFO_LIST)))
-        goto nla_put_failure;
+    msgs = g_ptr_array_new_with_free_func((GDestroyNotify) nlmsg_free);
 
     for (i = 0; vfs[i]; i++) {
         const NMPlatformVF *vf = vfs[i];
 
+        if (i % SRIOV_VFS_PER_NLMSG == 0) {
+            if (i > 0)
+                nla_nest_end(nlmsg, list);
+
+            nlmsg = _nl_msg_new_link(RTM_SETLINK, 0, ifindex, NULL);
+            if (!nlmsg)
+                g_return_val_if_reached(NULL);
+            g_ptr_array_add(msgs, nlmsg);
+
+            if (!(list = nla_nest_start(nlmsg, IFLA_VFINFO_LIST)))
+                goto nla_put_failure;
+        }
+
         if (!(info = nla_nest_start(nlmsg, IFLA_VF_INFO)))
             goto nla_put_failure;
 
@@ -8464,7 +8526,7 @@ link_set_sriov_vfs(NMPlatform *platform, int ifindex, const NMPlatformVF *const
          * with the new API.*/
         if (vf->num_vlans > 1) {
             _LOGW("multiple VLANs per VF are not supported at the moment");
-            return FALSE;
+            return NULL;
         } else {
             struct _ifla_vf_vlan_info ivvi = {0};
 
@@ -8488,11 +8550,192 @@ link_set_sriov_vfs(NMPlatform *platform, int ifindex, const NMPlatformVF *const
         }
         nla_nest_end(nlmsg, info);
     }
-    nla_nest_end(nlmsg, list);
+    if (i > 0)
+        nla_nest_end(nlmsg, list);
 
-    return (do_change_link(platform, CHANGE_LINK_TYPE_UNSPEC, ifindex, nlmsg, NULL) >= 0);
+    return g_steal_pointer(&msgs);
 nla_put_failure:
-    g_return_val_if_reached(FALSE);
+    g_return_val_if_reached(NULL);
+}
+
+typedef struct {
+    NMPlatform             *platform;
+    GPtrArray              *msgs;
+    NMPlatformAsyncCallback callback;
+    gpointer                callback_data;
+    int                     ifindex;
+    guint                   num_vfs;
+} SriovVFsAsyncInfo;
+
+static void
+sriov_vfs_async_info_free(SriovVFsAsyncInfo *info)
+{
+    g_object_unref(info->platform);
+    g_ptr_array_unref(info->msgs);
+    nm_g_slice_free(info);
+}
+
+static void
+sriov_vfs_async_cb(GObject *object, GAsyncResult *res, gpointer user_data)
+{
+    GTask                *task     = G_TASK(res);
+    SriovVFsAsyncInfo    *info     = g_task_get_task_data(task);
+    NMPlatform           *platform = info->platform;
+    gs_free_error GError *error    = NULL;
+
+    if (g_task_propagate_boolean(task, &error)) {
+        _LOGD("link: successfully set %u VFs on %d with %u messages",
+              info->num_vfs,
+              info->ifindex,
+              info->msgs->len);
+    } else if (!nm_utils_error_is_cancelled(error))
+        _LOGW("link: failure setting VFs on %d: %s", info->ifindex, error->message);
+
+    if (!nm_utils_error_is_cancelled(error)) {
+        /* like do_change_link(), refetch the link after changing it. */
+        delayed_action_schedule(platform,
+                                DELAYED_ACTION_TYPE_REFRESH_LINK,
+                                GINT_TO_POINTER(info->ifindex));
+        delayed_action_handle_all(platform);
+    }
+
+    if (info->callback)
+        info->callback(error, info->callback_data);
+}
+
+static void
+sriov_vfs_async_thread_fn(GTask        *task,
+                          gpointer      source_object,
+                          gpointer      task_data,
+                          GCancellable *cancellable)
+{
+    nm_auto_pop_netns NMPNetns    *netns    = NULL;
+    nm_auto_nlsock struct nl_sock *sk       = NULL;
+    SriovVFsAsyncInfo             *info     = task_data;
+    NMPlatform                    *platform = info->platform;
+    int                            r;
+    int                            r_first = 0;
+    guint                          i_first = 0;
+    guint                          n_sent;
+    guint                          i;
+
+    if (g_task_return_error_if_cancelled(task))
+        return;
+
+    if (!nm_platform_netns_push(platform, &netns)) {
+        g_task_return_new_error(task,
+                                NM_UTILS_ERROR,
+                                NM_UTILS_ERROR_UNKNOWN,
+                                "failed changing namespace");
+        return;
+    }
+
+    /* A private blocking socket. The platform's sockets belong to the main
+     * thread. */
+    r = nl_socket_new(&sk, NETLINK_ROUTE, NL_SOCKET_FLAGS_NONE, 0, 0);
+    if (r < 0) {
+        g_task_return_new_error(task,
+                                NM_UTILS_ERROR,
+                                NM_UTILS_ERROR_UNKNOWN,
+                                "failed creating netlink socket: %s",
+                                nm_strerror(r));
+        return;
+    }
+
+    /* Send all requests before reading the first acknowledgement. The kernel
+     * handles them in order and queues one ACK per request. */
+    for (n_sent = 0; n_sent < info->msgs->len; n_sent++) {
+        if (g_cancellable_is_cancelled(cancellable))
+            break;
+        r = nl_send_auto(sk, info->msgs->pdata[n_sent]);
+        if (r < 0) {
+            r_first = r;
+            i_first = n_sent;
+            break;
+        }
+    }
+
+    for (i = 0; i < n_sent; i++) {
+        do {
+            r = nl_recvmsgs(sk, NULL);
+        } while (r == -EAGAIN);
+        if (r < 0 && r_first == 0) {
+            r_first = r;
+            i_first = i;
+        }
+        _LOGT("link: VFs %u-%u on %d: %s",
+              i * SRIOV_VFS_PER_NLMSG,
+              NM_MIN((i + 1) * SRIOV_VFS_PER_NLMSG, info->num_vfs) - 1,
+              info->ifindex,
+              r < 0 ? nm_strerror(r) : "done");
+    }
+
+    if (r_first < 0) {
+        g_task_return_new_error(task,
+                                NM_UTILS_ERROR,
+                                NM_UTILS_ERROR_UNKNOWN,
+                                "failed to configure VFs %u-%u: %s",
+                                i_first * SRIOV_VFS_PER_NLMSG,
+                                NM_MIN((i_first + 1) * SRIOV_VFS_PER_NLMSG, info->num_vfs) - 1,
+                                nm_strerror(r_first));
+        return;
+    }
+
+    if (g_task_return_error_if_cancelled(task))
+        return;
+
+    g_task_return_boolean(task, TRUE);
+}
+
+static void
+link_set_sriov_vfs_async(NMPlatform                *platform,
+                         int                        ifindex,
+                         const NMPlatformVF *const *vfs,
+                         NMPlatformAsyncCallback    callback,
+                         gpointer                   callback_data,
+                         GCancellable              *cancellable)
+{
+    gs_unref_ptrarray GPtrArray *msgs = NULL;
+    SriovVFsAsyncInfo           *info;
+    GTask                       *task;
+
+    g_return_if_fail(cancellable);
+    g_return_if_fail(callback || !callback_data);
+
+    msgs = _nl_msgs_new_sriov_vfs(platform, ifindex, vfs);
+    if (!msgs) {
+        if (callback) {
+            gs_free_error GError *error = NULL;
+
+            g_set_error_literal(&error,
+                                NM_UTILS_ERROR,
+                                NM_UTILS_ERROR_UNKNOWN,
+                                "invalid VF configuration");
+            nm_utils_invoke_on_idle(cancellable,
+                                    sriov_idle_cb,
+                                    nm_utils_user_data_pack(g_object_ref(platform),
+                                                            g_steal_pointer(&error),
+                                                            callback,
+                                                            callback_data));
+        }
+        return;
+    }
+
+    info  = g_slice_new(SriovVFsAsyncInfo);
+    *info = (SriovVFsAsyncInfo){
+        .platform      = g_object_ref(platform),
+        .msgs          = g_steal_pointer(&msgs),
+        .callback      = callback,
+        .callback_data = callback_data,
+        .ifindex       = ifindex,
+        .num_vfs       = NM_PTRARRAY_LEN(vfs),
+    };
+
+    task = g_task_new(platform, cancellable, sriov_vfs_async_cb, NULL);
+    g_task_set_task_data(task, info, (GDestroyNotify) sriov_vfs_async_info_free);
+    g_task_set_return_on_cancel(task, FALSE);
+    nmp_utils_worker_run_task(task, NMP_UTILS_WORKER_POOL_SRIOV, sriov_vfs_async_thread_fn);
+    g_object_unref(task);
 }
 
 static gboolean
@@ -9640,6 +9883,65 @@ _genl_family_id_update(NMPlatform *platform, NMPGenlFamilyType family_type, guin
     return TRUE;
 }
 
+static guint32
+_genl_parse_mcast_group_id(const struct nlattr *attr, const char *group_name)
+{
+    static const struct nla_policy policy[] = {
+        [CTRL_ATTR_MCAST_GRP_NAME] = {.type = NLA_STRING, .maxlen = GENL_NAMSIZ},
+        [CTRL_ATTR_MCAST_GRP_ID]   = {.type = NLA_U32},
+    };
+    struct nlattr *nla;
+    int            rem;
+
+    if (!attr)
+        return 0;
+
+    nla_for_each_nested (nla, attr, rem) {
+        struct nlattr *tb[G_N_ELEMENTS(policy)];
+
+        if (nla_parse_nested_arr(tb, nla, policy) < 0)
+            continue;
+        if (tb[CTRL_ATTR_MCAST_GRP_NAME] && tb[CTRL_ATTR_MCAST_GRP_ID]
+            && nm_streq(nla_get_string(tb[CTRL_ATTR_MCAST_GRP_NAME]), group_name))
+            return nla_get_u32(tb[CTRL_ATTR_MCAST_GRP_ID]);
+    }
+    return 0;
+}
+
+static void
+_genl_mcast_group_update(NMPlatform *platform, NMPGenlFamilyType family_type, guint32 group_id)
+{
+    NMLinuxPlatformPrivate *priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+    int                     r;
+
+    if (priv->genl_family_data[family_type].mcast_group_id == group_id)
+        return;
+
+    /* When the family goes away, kernel drops the membership. */
+    if (group_id != 0) {
+        r = nl_socket_add_memberships(priv->sk_genl, group_id, 0);
+        if (r < 0) {
+            _LOGW("genl:ctrl: failure to join multicast group %s/%s: %s",
+                  nmp_genl_family_infos[family_type].name,
+                  nmp_genl_family_infos[family_type].mcast_group,
+                  nm_strerror(r));
+            group_id = 0;
+        } else {
+            _LOGD("genl:ctrl: joined multicast group %s/%s (0x%x)",
+                  nmp_genl_family_infos[family_type].name,
+                  nmp_genl_family_infos[family_type].mcast_group,
+                  group_id);
+        }
+    }
+    priv->genl_family_data[family_type].mcast_group_id = group_id;
+
+    if (family_type == NMP_GENL_FAMILY_TYPE_ETHTOOL) {
+        /* With the monitor group we get notified about all ethtool changes
+         * and can serve the ethtool getters from the cache. */
+        nm_platform_ethtool_cache_set_enabled(platform, group_id != 0);
+    }
+}
+
 static void
 _genl_handle_msg_ctrl(NMPlatform *platform, const struct nlmsghdr *hdr)
 {
@@ -9667,20 +9969,96 @@ _genl_handle_msg_ctrl(NMPlatform *platform, const struct nlmsghdr *hdr)
             family_id = nla_get_u16(tb[CTRL_ATTR_FAMILY_ID]);
 
         _genl_family_id_update(platform, family_type, family_id);
+
+        if (nmp_genl_family_infos[family_type].mcast_group) {
+            _genl_mcast_group_update(
+                platform,
+                family_type,
+                family_id != 0
+                    ? _genl_parse_mcast_group_id(tb[CTRL_ATTR_MCAST_GROUPS],
+                                                 nmp_genl_family_infos[family_type].mcast_group)
+                    : 0u);
+        }
     }
     }
 }
 
+static void
+_genl_handle_msg_ethtool(NMPlatform *platform, const struct nlmsghdr *hdr)
+{
+    static const struct nla_policy policy[] = {
+        [ETHTOOL_A_FEATURES_HEADER] = {.type = NLA_NESTED},
+    };
+    static const struct nla_policy policy_header[] = {
+        [ETHTOOL_A_HEADER_DEV_INDEX] = {.type = NLA_U32},
+    };
+    const struct genlmsghdr   *ghdr = nlmsg_data(hdr);
+    struct nlattr             *tb[G_N_ELEMENTS(policy)];
+    struct nlattr             *tb_header[G_N_ELEMENTS(policy_header)];
+    NMPlatformEthtoolCacheType type;
+    int                        ifindex;
+
+    switch (ghdr->cmd) {
+    case ETHTOOL_MSG_FEATURES_NTF:
+        type = NM_PLATFORM_ETHTOOL_CACHE_TYPE_FEATURES;
+        break;
+    case ETHTOOL_MSG_COALESCE_NTF:
+        type = NM_PLATFORM_ETHTOOL_CACHE_TYPE_COALESCE;
+        break;
+    case ETHTOOL_MSG_RINGS_NTF:
+        type = NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING;
+        break;
+    case ETHTOOL_MSG_PAUSE_NTF:
+        type = NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE;
+        break;
+    default:
+        return;
+    }
+
+    /* All these notifications start with the common request header. */
+    G_STATIC_ASSERT_EXPR(ETHTOOL_A_FEATURES_HEADER == ETHTOOL_A_COALESCE_HEADER);
+    G_STATIC_ASSERT_EXPR(ETHTOOL_A_FEATURES_HEADER == ETHTOOL_A_RINGS_HEADER);
+    G_STATIC_ASSERT_EXPR(ETHTOOL_A_FEATURES_HEADER == ETHTOOL_A_PAUSE_HEADER);
+
+    if (genlmsg_parse_arr(hdr, 0, tb, policy) < 0 || !tb[ETHTOOL_A_FEATURES_HEADER])
+        return;
+    if (nla_parse_nested_arr(tb_header, tb[ETHTOOL_A_FEATURES_HEADER], policy_header) < 0
+        || !tb_header[ETHTOOL_A_HEADER_DEV_INDEX])
+        return;
+
+    ifindex = nla_get_u32(tb_header[ETHTOOL_A_HEADER_DEV_INDEX]);
+    if (ifindex <= 0)
+        return;
+
+    _LOGT("genl:ethtool: ifindex %d: change notification (cmd %u)", ifindex, ghdr->cmd);
+    nm_platform_ethtool_cache_invalidate(platform, ifindex, type);
+}
+
+void
+_nm_linux_platform_genl_handle_ethtool_msg_for_testing(NMPlatform            *platform,
+                                                       const struct nlmsghdr *hdr)
+{
+    g_return_if_fail(NM_IS_LINUX_PLATFORM(platform));
+
+    _genl_handle_msg_ethtool(platform, hdr);
+}
+
 static void
 _genl_handle_msg(NMPlatform *platform, guint32 pktinfo_group, const struct nl_msg_lite *msg)
 {
-    const struct nlmsghdr *hdr = msg->nm_nlh;
+    NMLinuxPlatformPrivate *priv = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+    const struct nlmsghdr  *hdr  = msg->nm_nlh;
+    guint16                 ethtool_family_id;
 
     if (!genlmsg_valid_hdr(hdr, 0))
         return;
 
+    ethtool_family_id = priv->genl_family_data[NMP_GENL_FAMILY_TYPE_ETHTOOL].family_id;
+
     if (hdr->nlmsg_type == GENL_ID_CTRL)
         _genl_handle_msg_ctrl(platform, hdr);
+    else if (ethtool_family_id != 0 && hdr->nlmsg_type == ethtool_family_id)
+        _genl_handle_msg_ethtool(platform, hdr);
 }
 
 /*****************************************************************************/
@@ -9987,6 +10365,10 @@ event_handler_read_netlink(NMPlatform        *platform,
                               _reason;
                           }));
                     _netlink_recv_handle(platform, netlink_protocol, FALSE);
+                    if (netlink_protocol == NMP_NETLINK_GENERIC) {
+                        /* ethtool notifications may be lost too. */
+                        nm_platform_ethtool_cache_flush(platform);
+                    }
                     delayed_action_wait_for_nl_response_complete_all(
                         platform,
                         netlink_protocol,
@@ -10399,6 +10781,99 @@ mptcp_addrs_dump(NMPlatform *platform)
 
 /*****************************************************************************/
 
+static int
+_link_stats_dump_parse_cb(const struct nl_msg *msg, void *arg)
+{
+    static const struct nla_policy policy[] = {
+        [IFLA_STATS_LINK_64] = {.minlen = nm_offsetofend(struct rtnl_link_stats64, rx_nohandler)},
+    };
+    struct nlattr             *tb[G_N_ELEMENTS(policy)];
+    GArray                    *stats_arr = arg;
+    const struct if_stats_msg *ifsm;
+    const char                *s64;
+
+    if (nlmsg_parse_arr(nlmsg_hdr(msg), sizeof(struct if_stats_msg), tb, policy) < 0)
+        return NL_SKIP;
+
+    if (!tb[IFLA_STATS_LINK_64])
+        return NL_OK;
+
+    ifsm = nlmsg_data(nlmsg_hdr(msg));
+    if (ifsm->ifindex <= 0)
+        return NL_OK;
+
+    s64 = nla_data(tb[IFLA_STATS_LINK_64]);
+
+#define _S64(field) unaligned_read_ne64(&s64[G_STRUCT_OFFSET(struct rtnl_link_stats64, field)])
+
+    *nm_g_array_append_new(stats_arr, NMPlatformLinkStats) = (NMPlatformLinkStats){
+        .ifindex      = ifsm->ifindex,
+        .rx_packets   = _S64(rx_packets),
+        .tx_packets   = _S64(tx_packets),
+        .rx_bytes     = _S64(rx_bytes),
+        .tx_bytes     = _S64(tx_bytes),
+        .rx_errors    = _S64(rx_errors),
+        .tx_errors    = _S64(tx_errors),
+        .rx_dropped   = _S64(rx_dropped),
+        .tx_dropped   = _S64(tx_dropped),
+        .multicast    = _S64(multicast),
+        .collisions   = _S64(collisions),
+        .rx_nohandler = _S64(rx_nohandler),
+    };
+
+#undef _S64
+
+    return NL_OK;
+}
+
+static GArray *
+link_stats_dump(NMPlatform *platform)
+{
+    NMLinuxPlatformPrivate      *priv      = NM_LINUX_PLATFORM_GET_PRIVATE(platform);
+    gs_unref_array GArray       *stats_arr = NULL;
+    nm_auto_nlmsg struct nl_msg *nlmsg     = NULL;
+    struct if_stats_msg          ifsm;
+    int                          r;
+
+    /* RTM_GETSTATS only returns the requested counter groups, which is much
+     * cheaper than dumping all links via RTM_GETLINK and keeps the link cache
+     * (and its change notifications) out of the picture. */
+
+    ifsm = (struct if_stats_msg){
+        .family      = AF_UNSPEC,
+        .filter_mask = IFLA_STATS_FILTER_BIT(IFLA_STATS_LINK_64),
+    };
+
+    nlmsg = nlmsg_alloc_simple(RTM_GETSTATS, NLM_F_DUMP);
+    if (nlmsg_append_struct(nlmsg, &ifsm) < 0)
+        g_return_val_if_reached(NULL);
+
+    r = nl_send_auto(priv->sk_rtnl_sync, nlmsg);
+    if (r < 0) {
+        _LOGT("link-stats: failed to send dump request: %s", nm_strerror(r));
+        return NULL;
+    }
+
+    stats_arr = g_array_new(FALSE, FALSE, sizeof(NMPlatformLinkStats));
+
+    r = nl_recvmsgs(priv->sk_rtnl_sync,
+                    &((const struct nl_cb){
+                        .valid_cb  = _link_stats_dump_parse_cb,
+                        .valid_arg = stats_arr,
+                    }));
+    if (r < 0) {
+        _LOGT("link-stats: dump failed: %s", nm_strerror(r));
+        return NULL;
+    }
+
+    g_array_sort(stats_arr, nm_platform_link_stats_cmp_ifindex);
+
+    _LOGT("link-stats: %u links dumped", stats_arr->len);
+    return g_steal_pointer(&stats_arr);
+}
+
+/*****************************************************************************/
+
 static void
 cache_update_link_udev(NMPlatform *platform, int ifindex, struct udev_device *udevice)
 {
@@ -10584,6 +11059,18 @@ constructed(GObject *_object)
 
     /*************************************************************************/
 
+    /* like all sockets, this one must be created here, while we are in the
+     * platform's netns. A netlink socket is bound to the netns it was created
+     * in, and we don't switch netns when we use it. */
+    nle = nl_socket_new(&priv->sk_rtnl_sync, NETLINK_ROUTE, NL_SOCKET_FLAGS_NONE, 0, 0);
+    g_assert(!nle);
+
+    _LOGD("rtnl: rtnetlink socket for sync operations created: port=%u, fd=%d",
+          nl_socket_get_local_port(priv->sk_rtnl_sync),
+          nl_socket_get_fd(priv->sk_rtnl_sync));
+
+    /*************************************************************************/
+
     /* disable MSG_PEEK, we will handle lost messages ourselves. */
     nle = nl_socket_new(&priv->sk_genl,
                         NETLINK_GENERIC,
@@ -10766,6 +11253,7 @@ finalize(GObject *object)
     nm_clear_g_source_inst(&priv->event_source_rtnl);
 
     nl_socket_free(priv->sk_genl_sync);
+    nm_clear_pointer(&priv->sk_rtnl_sync, nl_socket_free);
     nl_socket_free(priv->sk_genl);
     nl_socket_free(priv->sk_rtnl);
 
@@ -10807,6 +11295,7 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
     platform_class->link_delete = link_delete;
 
     platform_class->link_refresh = link_refresh;
+    platform_class->refresh_all  = refresh_all;
 
     platform_class->link_set_netns = link_set_netns;
 
@@ -10820,7 +11309,7 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
     platform_class->link_set_mtu                       = link_set_mtu;
     platform_class->link_set_name                      = link_set_name;
     platform_class->link_set_sriov_params_async        = link_set_sriov_params_async;
-    platform_class->link_set_sriov_vfs                 = link_set_sriov_vfs;
+    platform_class->link_set_sriov_vfs_async           = link_set_sriov_vfs_async;
     platform_class->link_set_bridge_vlans              = link_set_bridge_vlans;
 
     platform_class->link_get_physical_port_id = link_get_physical_port_id;
@@ -10889,4 +11378,5 @@ nm_linux_platform_class_init(NMLinuxPlatformClass *klass)
     platform_class->genl_get_family_id = genl_get_family_id;
     platform_class->mptcp_addr_update  = mptcp_addr_update;
     platform_class->mptcp_addrs_dump   = mptcp_addrs_dump;
+    platform_class->link_stats_dump    = link_stats_dump;
 }
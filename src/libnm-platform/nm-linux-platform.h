@@ -25,4 +25,9 @@ GType nm_linux_platform_get_type(void);
 
 NMPlatform *nm_linux_platform_new(gboolean log_with_ptr, gboolean netns_support, gboolean cache_tc);
 
+struct nlmsghdr;
+
+void _nm_linux_platform_genl_handle_ethtool_msg_for_testing(NMPlatform            *platform,
+                                                            const struct nlmsghdr *hdr);
+
 #endif /* __NETWORKMANAGER_LINUX_PLATFORM_H__ */
@@ -11,6 +11,33 @@
 
 NMPCache *nm_platform_get_cache(NMPlatform *self);
 
+typedef enum {
+    NM_PLATFORM_ETHTOOL_CACHE_TYPE_FEATURES,
+    NM_PLATFORM_ETHTOOL_CACHE_TYPE_COALESCE,
+    NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING,
+    NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE,
+    _NM_PLATFORM_ETHTOOL_CACHE_TYPE_NUM,
+
+    /* for nm_platform_ethtool_cache_invalidate(), drops all types. */
+    NM_PLATFORM_ETHTOOL_CACHE_TYPE_ALL = _NM_PLATFORM_ETHTOOL_CACHE_TYPE_NUM,
+} NMPlatformEthtoolCacheType;
+
+void nm_platform_ethtool_cache_set_enabled(NMPlatform *self, gboolean enabled);
+void nm_platform_ethtool_cache_invalidate(NMPlatform                *self,
+                                          int                        ifindex,
+                                          NMPlatformEthtoolCacheType type);
+void nm_platform_ethtool_cache_flush(NMPlatform *self);
+
+gpointer _nm_platform_ethtool_cache_lookup_for_testing(NMPlatform                *self,
+                                                       int                        ifindex,
+                                                       NMPlatformEthtoolCacheType type,
+                                                       guint                     *out_gen);
+void     _nm_platform_ethtool_cache_add_for_testing(NMPlatform                *self,
+                                                    int                        ifindex,
+                                                    NMPlatformEthtoolCacheType type,
+                                                    gconstpointer              data,
+                                                    guint                      gen);
+
 #define NMTST_ASSERT_PLATFORM_NETNS_CURRENT(platform)                                          \
     G_STMT_START                                                                               \
     {                                                                                          \
@@ -523,6 +523,14 @@ static const NMEthtoolFeatureInfo _ethtool_feature_infos[_NM_ETHTOOL_ID_FEATURE_
  * for multiple kernel-names. */
 #define N_ETHTOOL_KERNEL_FEATURES (((guint) _NM_ETHTOOL_ID_FEATURE_NUM) + 8u)
 
+#define N_ETHTOOL_FEATURE_STATE_PTRS \
+    (N_ETHTOOL_KERNEL_FEATURES + G_N_ELEMENTS(_ethtool_feature_infos))
+
+#define ETHTOOL_FEATURE_STATES_SIZE                                      \
+    (sizeof(NMEthtoolFeatureStates)                                      \
+     + (N_ETHTOOL_KERNEL_FEATURES * sizeof(NMEthtoolFeatureState))       \
+     + (N_ETHTOOL_FEATURE_STATE_PTRS * sizeof(NMEthtoolFeatureState *)))
+
 static void
 _ASSERT_ethtool_feature_infos(void)
 {
@@ -619,11 +627,7 @@ ethtool_get_features(SocketHandle *shandle)
                 i_flag  = (guint32) (1u << (((guint) i_feature) % 32u));
 
                 if (!states) {
-                    states = g_malloc0(
-                        sizeof(NMEthtoolFeatureStates)
-                        + (N_ETHTOOL_KERNEL_FEATURES * sizeof(NMEthtoolFeatureState))
-                        + ((N_ETHTOOL_KERNEL_FEATURES + G_N_ELEMENTS(_ethtool_feature_infos))
-                           * sizeof(NMEthtoolFeatureState *)));
+                    states                = g_malloc0(ETHTOOL_FEATURE_STATES_SIZE);
                     states_list0          = &states->states_list[0];
                     states_plist0         = (gpointer) &states_list0[N_ETHTOOL_KERNEL_FEATURES];
                     states->n_ss_features = ss_features->len;
@@ -688,6 +692,35 @@ nmp_utils_ethtool_get_features(int ifindex)
     return features;
 }
 
+NMEthtoolFeatureStates *
+nmp_utils_ethtool_features_dup(const NMEthtoolFeatureStates *features)
+{
+    NMEthtoolFeatureStates             *copy;
+    const NMEthtoolFeatureState       **plist0;
+    const NMEthtoolFeatureState *const *plist0_src;
+    guint                               i;
+
+    g_return_val_if_fail(features, NULL);
+
+    copy = nm_memdup(features, ETHTOOL_FEATURE_STATES_SIZE);
+
+    /* The states reference each other inside the same allocation. Relocate
+     * the pointers into the copy. */
+    plist0     = (gpointer) &copy->states_list[N_ETHTOOL_KERNEL_FEATURES];
+    plist0_src = (gconstpointer) &features->states_list[N_ETHTOOL_KERNEL_FEATURES];
+
+    for (i = 0; i < N_ETHTOOL_FEATURE_STATE_PTRS; i++) {
+        if (plist0[i])
+            plist0[i] = &copy->states_list[plist0_src[i] - features->states_list];
+    }
+    for (i = 0; i < _NM_ETHTOOL_ID_FEATURE_NUM; i++) {
+        if (features->states_indexed[i])
+            copy->states_indexed[i] = &plist0[features->states_indexed[i] - plist0_src];
+    }
+
+    return copy;
+}
+
 static const char *
 _ethtool_feature_state_to_string(char                        *buf,
                                  gsize                        buf_size,
@@ -2258,3 +2291,172 @@ nmp_utils_modprobe(GError **error, gboolean suppress_error_logging, const char *
 
     return exit_status;
 }
+
+/*****************************************************************************/
+
+/* Blocking kernel I/O (sysfs writes, ethtool ioctls) may take a long time
+ * for some drivers. Such work runs on small, bounded pools of threads
+ * instead of on the main thread or on GTask's own pool, which grows while
+ * its threads are blocked. SR-IOV reconfiguration has its own pool, because
+ * creating VFs can block for seconds per device and must not delay the
+ * other work. */
+static const int _worker_max_threads[_NMP_UTILS_WORKER_POOL_NUM] = {
+    [NMP_UTILS_WORKER_POOL_DEFAULT] = 8,
+    [NMP_UTILS_WORKER_POOL_SRIOV]   = 4,
+};
+
+typedef struct {
+    GTask             *task;
+    GTaskThreadFunc    func;
+    NMPUtilsWorkerPool pool;
+    int                key;
+} WorkerData;
+
+static GMutex      _worker_lock;
+static GHashTable *_worker_serialized; /* key -> GQueue of WorkerData waiting for their turn */
+
+static void _worker_thread_fn(gpointer data, gpointer user_data);
+
+static GThreadPool *
+_worker_pool_get(NMPUtilsWorkerPool pool)
+{
+    static GThreadPool *pools[_NMP_UTILS_WORKER_POOL_NUM] = {};
+
+    nm_assert((guint) pool < _NMP_UTILS_WORKER_POOL_NUM);
+
+    if (g_once_init_enter(&pools[pool])) {
+        g_once_init_leave(
+            &pools[pool],
+            g_thread_pool_new(_worker_thread_fn, NULL, _worker_max_threads[pool], FALSE, NULL));
+    }
+    return pools[pool];
+}
+
+static void
+_worker_thread_fn(gpointer data, gpointer user_data)
+{
+    WorkerData *worker_data = data;
+    GTask      *task        = worker_data->task;
+    WorkerData *next        = NULL;
+
+    worker_data->func(task,
+                      g_task_get_source_object(task),
+                      g_task_get_task_data(task),
+                      g_task_get_cancellable(task));
+
+    if (worker_data->key != 0) {
+        GQueue *queue;
+
+        g_mutex_lock(&_worker_lock);
+        queue = g_hash_table_lookup(_worker_serialized, GINT_TO_POINTER(worker_data->key));
+        nm_assert(queue);
+        next = g_queue_pop_head(queue);
+        if (!next)
+            g_hash_table_remove(_worker_serialized, GINT_TO_POINTER(worker_data->key));
+        g_mutex_unlock(&_worker_lock);
+    }
+
+    /* the GTask completes on the main context it was created in. */
+    g_object_unref(task);
+    nm_g_slice_free(worker_data);
+
+    if (next)
+        g_thread_pool_push(_worker_pool_get(next->pool), next, NULL);
+}
+
+static WorkerData *
+_worker_data_new(GTask *task, NMPUtilsWorkerPool pool, GTaskThreadFunc func, int key)
+{
+    WorkerData *worker_data;
+
+    worker_data  = g_slice_new(WorkerData);
+    *worker_data = (WorkerData){
+        .task = g_object_ref(task),
+        .func = func,
+        .pool = pool,
+        .key  = key,
+    };
+    return worker_data;
+}
+
+/**
+ * nmp_utils_worker_run_task:
+ * @task: the #GTask to run
+ * @pool: the worker pool to run the task on
+ * @func: the function to run in a worker thread
+ *
+ * Like g_task_run_in_thread(), but the task runs on @pool, which has a
+ * bounded number of threads. Tasks of a pool are started in the order they
+ * are queued. @func must return a result for @task, which then completes on
+ * the #GMainContext where it was created.
+ */
+void
+nmp_utils_worker_run_task(GTask *task, NMPUtilsWorkerPool pool, GTaskThreadFunc func)
+{
+    g_return_if_fail(G_IS_TASK(task));
+    g_return_if_fail((guint) pool < _NMP_UTILS_WORKER_POOL_NUM);
+    g_return_if_fail(func);
+
+    g_thread_pool_push(_worker_pool_get(pool), _worker_data_new(task, pool, func, 0), NULL);
+}
+
+/**
+ * nmp_utils_worker_run_task_serialized:
+ * @task: the #GTask to run
+ * @pool: the worker pool to run the task on
+ * @func: the function to run in a worker thread
+ * @key: a non-zero key, like an ifindex
+ *
+ * Like nmp_utils_worker_run_task(), but tasks with the same @key never run
+ * concurrently. They run one after the other, in the order they were queued.
+ */
+void
+nmp_utils_worker_run_task_serialized(GTask             *task,
+                                     NMPUtilsWorkerPool pool,
+                                     GTaskThreadFunc    func,
+                                     int                key)
+{
+    WorkerData *worker_data;
+    GQueue     *queue;
+
+    g_return_if_fail(G_IS_TASK(task));
+    g_return_if_fail((guint) pool < _NMP_UTILS_WORKER_POOL_NUM);
+    g_return_if_fail(func);
+    g_return_if_fail(key != 0);
+
+    worker_data = _worker_data_new(task, pool, func, key);
+
+    g_mutex_lock(&_worker_lock);
+    if (G_UNLIKELY(!_worker_serialized)) {
+        _worker_serialized =
+            g_hash_table_new_full(g_direct_hash, NULL, NULL, (GDestroyNotify) g_queue_free);
+    }
+    queue = g_hash_table_lookup(_worker_serialized, GINT_TO_POINTER(key));
+    if (queue) {
+        /* another task with the same key is running. It starts us when done. */
+        g_queue_push_tail(queue, g_steal_pointer(&worker_data));
+    } else
+        g_hash_table_insert(_worker_serialized, GINT_TO_POINTER(key), g_queue_new());
+    g_mutex_unlock(&_worker_lock);
+
+    if (worker_data)
+        g_thread_pool_push(_worker_pool_get(pool), worker_data, NULL);
+}
+
+/**
+ * _nmp_utils_worker_set_max_threads_for_testing:
+ * @pool: the worker pool
+ * @max_threads: the new limit, or -1 to restore the default
+ *
+ * Only for unit tests.
+ */
+void
+_nmp_utils_worker_set_max_threads_for_testing(NMPUtilsWorkerPool pool, int max_threads)
+{
+    g_return_if_fail((guint) pool < _NMP_UTILS_WORKER_POOL_NUM);
+
+    if (max_threads < 0)
+        max_threads = _worker_max_threads[pool];
+
+    g_thread_pool_set_max_threads(_worker_pool_get(pool), max_threads, NULL);
+}
@@ -40,6 +40,8 @@ gboolean nmp_utils_ethtool_get_driver_info(int ifindex, NMPUtilsEthtoolDriverInf
 
 NMEthtoolFeatureStates *nmp_utils_ethtool_get_features(int ifindex);
 
+NMEthtoolFeatureStates *nmp_utils_ethtool_features_dup(const NMEthtoolFeatureStates *features);
+
 gboolean nmp_utils_ethtool_set_features(
     int                           ifindex,
     const NMEthtoolFeatureStates *features,
@@ -92,4 +94,18 @@ guint32 nmp_utils_lifetime_get(guint32  timestamp,
 int nmp_utils_modprobe(GError **error, gboolean suppress_error_logging, const char *arg1, ...)
     G_GNUC_NULL_TERMINATED;
 
+typedef enum {
+    NMP_UTILS_WORKER_POOL_DEFAULT,
+    NMP_UTILS_WORKER_POOL_SRIOV,
+    _NMP_UTILS_WORKER_POOL_NUM,
+} NMPUtilsWorkerPool;
+
+void nmp_utils_worker_run_task(GTask *task, NMPUtilsWorkerPool pool, GTaskThreadFunc func);
+void nmp_utils_worker_run_task_serialized(GTask             *task,
+                                          NMPUtilsWorkerPool pool,
+                                          GTaskThreadFunc    func,
+                                          int                key);
+
+void _nmp_utils_worker_set_max_threads_for_testing(NMPUtilsWorkerPool pool, int max_threads);
+
 #endif /* __NM_PLATFORM_UTILS_H__ */
@@ -197,6 +197,13 @@ typedef struct _NMPlatformPrivate {
     GHashTable        *ip4_dev_route_blacklist_hash;
     NMDedupMultiIndex *multi_idx;
     NMPCache          *cache;
+
+    /* The ethtool getters may be called from worker threads, so this cache has
+     * its own lock. It is only enabled while a subclass gets notified about
+     * ethtool changes (see nm_platform_ethtool_cache_set_enabled()). */
+    GMutex      ethtool_cache_lock;
+    GHashTable *ethtool_cache;
+    guint       ethtool_cache_gen;
 } NMPlatformPrivate;
 
 G_DEFINE_TYPE(NMPlatform, nm_platform, G_TYPE_OBJECT)
@@ -405,7 +412,8 @@ _nm_platform_kernel_support_init(NMPlatformKernelSupportType type, int value)
 const NMPGenlFamilyInfo nmp_genl_family_infos[_NMP_GENL_FAMILY_TYPE_NUM] = {
     [NMP_GENL_FAMILY_TYPE_ETHTOOL] =
         {
-            .name = "ethtool",
+            .name        = ETHTOOL_GENL_NAME,
+            .mcast_group = ETHTOOL_MCGRP_MONITOR_NAME,
         },
     [NMP_GENL_FAMILY_TYPE_MPTCP_PM] =
         {
@@ -489,6 +497,23 @@ nm_platform_process_events(NMPlatform *self)
         klass->process_events(self);
 }
 
+/**
+ * nm_platform_refresh_all:
+ * @self: platform instance
+ * @obj_type: the type of the objects to refresh
+ *
+ * Re-read all objects of @obj_type from the kernel with one dump
+ * request. This is cheaper than refreshing many objects one by one.
+ */
+void
+nm_platform_refresh_all(NMPlatform *self, NMPObjectType obj_type)
+{
+    _CHECK_SELF_VOID(self, klass);
+
+    if (klass->refresh_all)
+        klass->refresh_all(self, obj_type);
+}
+
 const NMPlatformLink *
 nm_platform_process_events_ensure_link(NMPlatform *self, int ifindex, const char *ifname)
 {
@@ -1954,13 +1979,33 @@ nm_platform_link_set_sriov_params_async(NMPlatform             *self,
                                        cancellable);
 }
 
-gboolean
-nm_platform_link_set_sriov_vfs(NMPlatform *self, int ifindex, const NMPlatformVF *const *vfs)
+/**
+ * nm_platform_link_set_sriov_vfs_async:
+ * @self: platform instance
+ * @ifindex: the index of the interface to change
+ * @vfs: the %NULL terminated list of VFs to configure
+ * @callback: called when the operation finishes
+ * @callback_data: data passed to @callback
+ * @cancellable: cancellable to abort the operation
+ *
+ * Configures the VFs asynchronously without blocking the main thread.
+ * The VFs are sent in batches of several VFs per netlink message, all
+ * of them before waiting for the first acknowledgement. The callback
+ * function is always invoked, and asynchronously.
+ */
+void
+nm_platform_link_set_sriov_vfs_async(NMPlatform                *self,
+                                     int                        ifindex,
+                                     const NMPlatformVF *const *vfs,
+                                     NMPlatformAsyncCallback    callback,
+                                     gpointer                   callback_data,
+                                     GCancellable              *cancellable)
 {
     guint i;
-    _CHECK_SELF(self, klass, FALSE);
+    _CHECK_SELF_VOID(self, klass);
 
-    g_return_val_if_fail(ifindex > 0, FALSE);
+    g_return_if_fail(ifindex > 0);
+    g_return_if_fail(vfs);
 
     if (_LOGD_ENABLED()) {
         _LOG3D("link: setting VFs");
@@ -1972,7 +2017,7 @@ nm_platform_link_set_sriov_vfs(NMPlatform *self, int ifindex, const NMPlatformVF
         }
     }
 
-    return klass->link_set_sriov_vfs(self, ifindex, vfs);
+    klass->link_set_sriov_vfs_async(self, ifindex, vfs, callback, callback_data, cancellable);
 }
 
 gboolean
@@ -3397,14 +3442,195 @@ nm_platform_ethtool_get_link_settings(NMPlatform               *self,
 
 /*****************************************************************************/
 
+typedef struct {
+    int      ifindex;
+    gpointer data[_NM_PLATFORM_ETHTOOL_CACHE_TYPE_NUM];
+} EthtoolCacheEntry;
+
+static gpointer
+_ethtool_cache_data_dup(NMPlatformEthtoolCacheType type, gconstpointer data)
+{
+    switch (type) {
+    case NM_PLATFORM_ETHTOOL_CACHE_TYPE_FEATURES:
+        return nmp_utils_ethtool_features_dup(data);
+    case NM_PLATFORM_ETHTOOL_CACHE_TYPE_COALESCE:
+        return nm_memdup(data, sizeof(NMEthtoolCoalesceState));
+    case NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING:
+        return nm_memdup(data, sizeof(NMEthtoolRingState));
+    case NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE:
+        return nm_memdup(data, sizeof(NMEthtoolPauseState));
+    default:
+        break;
+    }
+    return nm_assert_unreachable_val(NULL);
+}
+
+static void
+_ethtool_cache_entry_free(gpointer data)
+{
+    EthtoolCacheEntry *entry = data;
+    guint              i;
+
+    for (i = 0; i < _NM_PLATFORM_ETHTOOL_CACHE_TYPE_NUM; i++)
+        g_free(entry->data[i]);
+    nm_g_slice_free(entry);
+}
+
+/* Returns a copy of the cached value, or %NULL. In the latter case, pass
+ * @out_gen to _ethtool_cache_add() after reading the value from kernel. */
+static gpointer
+_ethtool_cache_lookup(NMPlatform                *self,
+                      int                        ifindex,
+                      NMPlatformEthtoolCacheType type,
+                      guint                     *out_gen)
+{
+    NMPlatformPrivate *priv = NM_PLATFORM_GET_PRIVATE(self);
+    EthtoolCacheEntry *entry;
+    gpointer           data = NULL;
+
+    g_mutex_lock(&priv->ethtool_cache_lock);
+    *out_gen = priv->ethtool_cache_gen;
+    if (priv->ethtool_cache) {
+        entry = g_hash_table_lookup(priv->ethtool_cache, &ifindex);
+        if (entry && entry->data[type])
+            data = _ethtool_cache_data_dup(type, entry->data[type]);
+    }
+    g_mutex_unlock(&priv->ethtool_cache_lock);
+
+    return data;
+}
+
+static void
+_ethtool_cache_add(NMPlatform                *self,
+                   int                        ifindex,
+                   NMPlatformEthtoolCacheType type,
+                   gconstpointer              data,
+                   guint                      gen)
+{
+    NMPlatformPrivate *priv = NM_PLATFORM_GET_PRIVATE(self);
+    EthtoolCacheEntry *entry;
+
+    g_mutex_lock(&priv->ethtool_cache_lock);
+
+    /* If anything got invalidated while we were reading the value, it might
+     * already be outdated. Don't cache it. */
+    if (priv->ethtool_cache && priv->ethtool_cache_gen == gen) {
+        entry = g_hash_table_lookup(priv->ethtool_cache, &ifindex);
+        if (!entry) {
+            entry          = g_slice_new0(EthtoolCacheEntry);
+            entry->ifindex = ifindex;
+            g_hash_table_add(priv->ethtool_cache, entry);
+        }
+        g_free(entry->data[type]);
+        entry->data[type] = _ethtool_cache_data_dup(type, data);
+    }
+
+    g_mutex_unlock(&priv->ethtool_cache_lock);
+}
+
+/**
+ * nm_platform_ethtool_cache_set_enabled:
+ * @self: platform instance
+ * @enabled: whether to cache ethtool settings
+ *
+ * The ethtool settings of a link can only be cached while the platform
+ * learns about changes to them. The subclass enables the cache once it
+ * receives ethtool notifications, and disables (and flushes) it when it
+ * no longer does.
+ */
+void
+nm_platform_ethtool_cache_set_enabled(NMPlatform *self, gboolean enabled)
+{
+    NMPlatformPrivate *priv = NM_PLATFORM_GET_PRIVATE(self);
+
+    g_mutex_lock(&priv->ethtool_cache_lock);
+    priv->ethtool_cache_gen++;
+    if (!enabled)
+        nm_clear_pointer(&priv->ethtool_cache, g_hash_table_unref);
+    else if (!priv->ethtool_cache) {
+        priv->ethtool_cache =
+            g_hash_table_new_full(nm_pint_hash, nm_pint_equal, _ethtool_cache_entry_free, NULL);
+    }
+    g_mutex_unlock(&priv->ethtool_cache_lock);
+}
+
+void
+nm_platform_ethtool_cache_invalidate(NMPlatform                *self,
+                                     int                        ifindex,
+                                     NMPlatformEthtoolCacheType type)
+{
+    NMPlatformPrivate *priv = NM_PLATFORM_GET_PRIVATE(self);
+    EthtoolCacheEntry *entry;
+
+    g_mutex_lock(&priv->ethtool_cache_lock);
+    priv->ethtool_cache_gen++;
+    if (priv->ethtool_cache
+        && (entry = g_hash_table_lookup(priv->ethtool_cache, &ifindex))) {
+        if (type == NM_PLATFORM_ETHTOOL_CACHE_TYPE_ALL)
+            g_hash_table_remove(priv->ethtool_cache, &ifindex);
+        else
+            nm_clear_g_free(&entry->data[type]);
+    }
+    g_mutex_unlock(&priv->ethtool_cache_lock);
+}
+
+/**
+ * nm_platform_ethtool_cache_flush:
+ * @self: platform instance
+ *
+ * Drops the cached ethtool settings of all links. The subclass calls this
+ * when it might have missed notifications, for example because the netlink
+ * socket overflowed.
+ */
+void
+nm_platform_ethtool_cache_flush(NMPlatform *self)
+{
+    NMPlatformPrivate *priv = NM_PLATFORM_GET_PRIVATE(self);
+
+    g_mutex_lock(&priv->ethtool_cache_lock);
+    priv->ethtool_cache_gen++;
+    if (priv->ethtool_cache)
+        g_hash_table_remove_all(priv->ethtool_cache);
+    g_mutex_unlock(&priv->ethtool_cache_lock);
+}
+
+gpointer
+_nm_platform_ethtool_cache_lookup_for_testing(NMPlatform                *self,
+                                              int                        ifindex,
+                                              NMPlatformEthtoolCacheType type,
+                                              guint                     *out_gen)
+{
+    return _ethtool_cache_lookup(self, ifindex, type, out_gen);
+}
+
+void
+_nm_platform_ethtool_cache_add_for_testing(NMPlatform                *self,
+                                           int                        ifindex,
+                                           NMPlatformEthtoolCacheType type,
+                                           gconstpointer              data,
+                                           guint                      gen)
+{
+    _ethtool_cache_add(self, ifindex, type, data, gen);
+}
+
 NMEthtoolFeatureStates *
 nm_platform_ethtool_get_link_features(NMPlatform *self, int ifindex)
 {
+    NMEthtoolFeatureStates *features;
+    guint                   gen;
+
     _CHECK_SELF_NETNS(self, klass, netns, NULL);
 
     g_return_val_if_fail(ifindex > 0, NULL);
 
-    return nmp_utils_ethtool_get_features(ifindex);
+    features = _ethtool_cache_lookup(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_FEATURES, &gen);
+    if (features)
+        return features;
+
+    features = nmp_utils_ethtool_get_features(ifindex);
+    if (features)
+        _ethtool_cache_add(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_FEATURES, features, gen);
+    return features;
 }
 
 gboolean
@@ -3415,11 +3641,15 @@ nm_platform_ethtool_set_features(
     const NMOptionBool *requested /* indexed by NMEthtoolID - _NM_ETHTOOL_ID_FEATURE_FIRST */,
     gboolean            do_set /* or reset */)
 {
+    gboolean success;
+
     _CHECK_SELF_NETNS(self, klass, netns, FALSE);
 
     g_return_val_if_fail(ifindex > 0, FALSE);
 
-    return nmp_utils_ethtool_set_features(ifindex, features, requested, do_set);
+    success = nmp_utils_ethtool_set_features(ifindex, features, requested, do_set);
+    nm_platform_ethtool_cache_invalidate(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_FEATURES);
+    return success;
 }
 
 gboolean
@@ -3427,12 +3657,25 @@ nm_platform_ethtool_get_link_coalesce(NMPlatform             *self,
                                       int                     ifindex,
                                       NMEthtoolCoalesceState *coalesce)
 {
+    gs_free NMEthtoolCoalesceState *cached = NULL;
+    guint                           gen;
+
     _CHECK_SELF_NETNS(self, klass, netns, FALSE);
 
     g_return_val_if_fail(ifindex > 0, FALSE);
     g_return_val_if_fail(coalesce, FALSE);
 
-    return nmp_utils_ethtool_get_coalesce(ifindex, coalesce);
+    cached = _ethtool_cache_lookup(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_COALESCE, &gen);
+    if (cached) {
+        *coalesce = *cached;
+        return TRUE;
+    }
+
+    if (!nmp_utils_ethtool_get_coalesce(ifindex, coalesce))
+        return FALSE;
+
+    _ethtool_cache_add(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_COALESCE, coalesce, gen);
+    return TRUE;
 }
 
 gboolean
@@ -3440,53 +3683,91 @@ nm_platform_ethtool_set_coalesce(NMPlatform                   *self,
                                  int                           ifindex,
                                  const NMEthtoolCoalesceState *coalesce)
 {
+    gboolean success;
+
     _CHECK_SELF_NETNS(self, klass, netns, FALSE);
 
     g_return_val_if_fail(ifindex > 0, FALSE);
 
-    return nmp_utils_ethtool_set_coalesce(ifindex, coalesce);
+    success = nmp_utils_ethtool_set_coalesce(ifindex, coalesce);
+    nm_platform_ethtool_cache_invalidate(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_COALESCE);
+    return success;
 }
 
 gboolean
 nm_platform_ethtool_get_link_ring(NMPlatform *self, int ifindex, NMEthtoolRingState *ring)
 {
+    gs_free NMEthtoolRingState *cached = NULL;
+    guint                       gen;
+
     _CHECK_SELF_NETNS(self, klass, netns, FALSE);
 
     g_return_val_if_fail(ifindex > 0, FALSE);
     g_return_val_if_fail(ring, FALSE);
 
-    return nmp_utils_ethtool_get_ring(ifindex, ring);
+    cached = _ethtool_cache_lookup(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING, &gen);
+    if (cached) {
+        *ring = *cached;
+        return TRUE;
+    }
+
+    if (!nmp_utils_ethtool_get_ring(ifindex, ring))
+        return FALSE;
+
+    _ethtool_cache_add(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING, ring, gen);
+    return TRUE;
 }
 
 gboolean
 nm_platform_ethtool_set_ring(NMPlatform *self, int ifindex, const NMEthtoolRingState *ring)
 {
+    gboolean success;
+
     _CHECK_SELF_NETNS(self, klass, netns, FALSE);
 
     g_return_val_if_fail(ifindex > 0, FALSE);
 
-    return nmp_utils_ethtool_set_ring(ifindex, ring);
+    success = nmp_utils_ethtool_set_ring(ifindex, ring);
+    nm_platform_ethtool_cache_invalidate(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_RING);
+    return success;
 }
 
 gboolean
 nm_platform_ethtool_get_link_pause(NMPlatform *self, int ifindex, NMEthtoolPauseState *pause)
 {
+    gs_free NMEthtoolPauseState *cached = NULL;
+    guint                        gen;
+
     _CHECK_SELF_NETNS(self, klass, netns, FALSE);
 
     g_return_val_if_fail(ifindex > 0, FALSE);
     g_return_val_if_fail(pause, FALSE);
 
-    return nmp_utils_ethtool_get_pause(ifindex, pause);
+    cached = _ethtool_cache_lookup(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE, &gen);
+    if (cached) {
+        *pause = *cached;
+        return TRUE;
+    }
+
+    if (!nmp_utils_ethtool_get_pause(ifindex, pause))
+        return FALSE;
+
+    _ethtool_cache_add(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE, pause, gen);
+    return TRUE;
 }
 
 gboolean
 nm_platform_ethtool_set_pause(NMPlatform *self, int ifindex, const NMEthtoolPauseState *pause)
 {
+    gboolean success;
+
     _CHECK_SELF_NETNS(self, klass, netns, FALSE);
 
     g_return_val_if_fail(ifindex > 0, FALSE);
 
-    return nmp_utils_ethtool_set_pause(ifindex, pause);
+    success = nmp_utils_ethtool_set_pause(ifindex, pause);
+    nm_platform_ethtool_cache_invalidate(self, ifindex, NM_PLATFORM_ETHTOOL_CACHE_TYPE_PAUSE);
+    return success;
 }
 
 /*****************************************************************************/
@@ -9419,6 +9700,44 @@ nm_platform_mptcp_addrs_dump(NMPlatform *self)
     return klass->mptcp_addrs_dump(self);
 }
 
+/**
+ * nm_platform_link_stats_dump:
+ * @self: the #NMPlatform instance
+ *
+ * Fetches the interface counters of all links with a single request,
+ * without refreshing the link cache.
+ *
+ * Returns: (transfer full): an array of #NMPlatformLinkStats sorted
+ *   by ifindex, or %NULL if the statistics are not available.
+ */
+GArray *
+nm_platform_link_stats_dump(NMPlatform *self)
+{
+    _CHECK_SELF(self, klass, NULL);
+
+    if (!klass->link_stats_dump)
+        return NULL;
+
+    return klass->link_stats_dump(self);
+}
+
+/**
+ * nm_platform_link_stats_cmp_ifindex:
+ * @a: a #NMPlatformLinkStats
+ * @b: a #NMPlatformLinkStats
+ *
+ * Orders #NMPlatformLinkStats by ifindex, as returned by
+ * nm_platform_link_stats_dump(). Suitable for g_array_sort() and bsearch().
+ *
+ * Returns: a negative value, zero or a positive value.
+ */
+int
+nm_platform_link_stats_cmp_ifindex(gconstpointer a, gconstpointer b)
+{
+    NM_CMP_FIELD((const NMPlatformLinkStats *) a, (const NMPlatformLinkStats *) b, ifindex);
+    return 0;
+}
+
 /*****************************************************************************/
 
 GHashTable *
@@ -9861,6 +10180,8 @@ static void
 nm_platform_init(NMPlatform *self)
 {
     self->_priv = G_TYPE_INSTANCE_GET_PRIVATE(self, NM_TYPE_PLATFORM, NMPlatformPrivate);
+
+    g_mutex_init(&self->_priv->ethtool_cache_lock);
 }
 
 static GObject *
@@ -9894,6 +10215,8 @@ finalize(GObject *object)
     g_clear_object(&self->_netns);
     nm_dedup_multi_index_unref(priv->multi_idx);
     nmp_cache_free(priv->cache);
+    nm_clear_pointer(&priv->ethtool_cache, g_hash_table_unref);
+    g_mutex_clear(&priv->ethtool_cache_lock);
 
     G_OBJECT_CLASS(nm_platform_parent_class)->finalize(object);
 }
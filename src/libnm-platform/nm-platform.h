@@ -1107,6 +1107,21 @@ typedef struct {
 
 #undef __NMPlatformObjWithIfindex_COMMON
 
+typedef struct {
+    int     ifindex;
+    guint64 rx_packets;
+    guint64 tx_packets;
+    guint64 rx_bytes;
+    guint64 tx_bytes;
+    guint64 rx_errors;
+    guint64 tx_errors;
+    guint64 rx_dropped;
+    guint64 tx_dropped;
+    guint64 multicast;
+    guint64 collisions;
+    guint64 rx_nohandler;
+} NMPlatformLinkStats;
+
 /*****************************************************************************/
 
 typedef struct _NMPlatformCsmeConnInfo {
@@ -1178,6 +1193,9 @@ typedef enum {
 
 typedef struct {
     const char *name;
+
+    /* the multicast group to join, if any. */
+    const char *mcast_group;
 } NMPGenlFamilyInfo;
 
 extern const NMPGenlFamilyInfo nmp_genl_family_infos[_NMP_GENL_FAMILY_TYPE_NUM];
@@ -1251,7 +1269,12 @@ typedef struct {
                                         NMPlatformAsyncCallback callback,
                                         gpointer                callback_data,
                                         GCancellable           *cancellable);
-    gboolean (*link_set_sriov_vfs)(NMPlatform *self, int ifindex, const NMPlatformVF *const *vfs);
+    void (*link_set_sriov_vfs_async)(NMPlatform                *self,
+                                     int                        ifindex,
+                                     const NMPlatformVF *const *vfs,
+                                     NMPlatformAsyncCallback    callback,
+                                     gpointer                   callback_data,
+                                     GCancellable              *cancellable);
     gboolean (*link_set_bridge_vlans)(NMPlatform                        *self,
                                       int                                ifindex,
                                       gboolean                           on_master,
@@ -1398,6 +1421,8 @@ typedef struct {
 
     GPtrArray *(*mptcp_addrs_dump)(NMPlatform *self);
 
+    GArray *(*link_stats_dump)(NMPlatform *self);
+
 } NMPlatformClass;
 
 /* NMPlatform signals
@@ -2045,6 +2070,7 @@ const char *nm_platform_link_get_type_name(NMPlatform *self, int ifindex);
 
 gboolean nm_platform_link_refresh(NMPlatform *self, int ifindex);
 void     nm_platform_process_events(NMPlatform *self);
+void     nm_platform_refresh_all(NMPlatform *self, NMPObjectType obj_type);
 
 const NMPlatformLink *
 nm_platform_process_events_ensure_link(NMPlatform *self, int ifindex, const char *ifname);
@@ -2103,8 +2129,12 @@ void nm_platform_link_set_sriov_params_async(NMPlatform             *self,
                                              gpointer                callback_data,
                                              GCancellable           *cancellable);
 
-gboolean
-nm_platform_link_set_sriov_vfs(NMPlatform *self, int ifindex, const NMPlatformVF *const *vfs);
+void     nm_platform_link_set_sriov_vfs_async(NMPlatform                *self,
+                                              int                        ifindex,
+                                              const NMPlatformVF *const *vfs,
+                                              NMPlatformAsyncCallback    callback,
+                                              gpointer                   callback_data,
+                                              GCancellable              *cancellable);
 gboolean nm_platform_link_set_bridge_vlans(NMPlatform                        *self,
                                            int                                ifindex,
                                            gboolean                           on_master,
@@ -2677,4 +2707,8 @@ nm_platform_mptcp_addr_update(NMPlatform *self, NMOptionBool add, const NMPlatfo
 
 GPtrArray *nm_platform_mptcp_addrs_dump(NMPlatform *self);
 
+GArray *nm_platform_link_stats_dump(NMPlatform *self);
+
+int nm_platform_link_stats_cmp_ifindex(gconstpointer a, gconstpointer b);
+
 #endif /* __NETWORKMANAGER_PLATFORM_H__ */
@@ -141,6 +141,230 @@ test_nmp_link_mode_all_advertised_modes_bits(void)
 
 /*****************************************************************************/
 
+typedef struct {
+    GMutex lock;
+    GCond  cond;
+
+    /* the task indexes in the order the tasks started. */
+    GArray *started;
+
+    /* by key. */
+    guint n_running[3];
+    guint max_running[3];
+    guint n_started[3];
+
+    guint n_completed;
+    bool  blocked;
+    bool  timed_out;
+} WorkerTestData;
+
+typedef struct {
+    WorkerTestData *data;
+    guint           idx;
+    int             key;
+
+    /* wait while data->blocked is set. */
+    bool block;
+
+    /* wait until a task with this key started. */
+    int wait_for_key;
+} WorkerTestTask;
+
+static void
+_worker_test_thread_fn(GTask        *task,
+                       gpointer      source_object,
+                       gpointer      task_data,
+                       GCancellable *cancellable)
+{
+    WorkerTestTask *t    = task_data;
+    WorkerTestData *data = t->data;
+    gint64          end_time;
+
+    end_time = g_get_monotonic_time() + 5 * G_TIME_SPAN_SECOND;
+
+    g_mutex_lock(&data->lock);
+    g_array_append_val(data->started, t->idx);
+    data->n_started[t->key]++;
+    data->n_running[t->key]++;
+    data->max_running[t->key] = NM_MAX(data->max_running[t->key], data->n_running[t->key]);
+    g_cond_broadcast(&data->cond);
+    while ((t->block && data->blocked) || (t->wait_for_key && !data->n_started[t->wait_for_key])) {
+        if (!g_cond_wait_until(&data->cond, &data->lock, end_time)) {
+            data->timed_out = TRUE;
+            break;
+        }
+    }
+    g_mutex_unlock(&data->lock);
+
+    /* give other tasks with the same key a chance to overlap, if they could. */
+    g_usleep(1000);
+
+    g_mutex_lock(&data->lock);
+    data->n_running[t->key]--;
+    g_mutex_unlock(&data->lock);
+
+    g_task_return_boolean(task, TRUE);
+}
+
+static void
+_worker_test_cb(GObject *source, GAsyncResult *result, gpointer user_data)
+{
+    WorkerTestData *data = user_data;
+
+    g_assert(g_task_propagate_boolean(G_TASK(result), NULL));
+    data->n_completed++;
+}
+
+static void
+_worker_test_run(WorkerTestData    *data,
+                 NMPUtilsWorkerPool pool,
+                 guint              idx,
+                 int                key,
+                 gboolean           block,
+                 int                wait_for_key)
+{
+    gs_unref_object GTask *task = NULL;
+    WorkerTestTask        *t;
+
+    t  = g_new(WorkerTestTask, 1);
+    *t = (WorkerTestTask){
+        .data         = data,
+        .idx          = idx,
+        .key          = key,
+        .block        = block,
+        .wait_for_key = wait_for_key,
+    };
+
+    task = g_task_new(NULL, NULL, _worker_test_cb, data);
+    g_task_set_task_data(task, t, g_free);
+    if (key != 0)
+        nmp_utils_worker_run_task_serialized(task, pool, _worker_test_thread_fn, key);
+    else
+        nmp_utils_worker_run_task(task, pool, _worker_test_thread_fn);
+}
+
+static void
+_worker_test_data_init(WorkerTestData *data)
+{
+    *data = (WorkerTestData){
+        .started = g_array_new(FALSE, FALSE, sizeof(guint)),
+    };
+    g_mutex_init(&data->lock);
+    g_cond_init(&data->cond);
+}
+
+static void
+_worker_test_data_clear(WorkerTestData *data)
+{
+    g_assert(!data->timed_out);
+    g_array_unref(data->started);
+    g_mutex_clear(&data->lock);
+    g_cond_clear(&data->cond);
+}
+
+static guint
+_worker_test_get_n_started(WorkerTestData *data)
+{
+    guint n;
+
+    g_mutex_lock(&data->lock);
+    n = data->started->len;
+    g_mutex_unlock(&data->lock);
+    return n;
+}
+
+static void
+test_worker_queue_order(void)
+{
+    WorkerTestData data;
+    guint          i;
+
+    _worker_test_data_init(&data);
+
+    /* with one thread, the start order is observable. */
+    _nmp_utils_worker_set_max_threads_for_testing(NMP_UTILS_WORKER_POOL_DEFAULT, 1);
+
+    for (i = 0; i < 20; i++)
+        _worker_test_run(&data, NMP_UTILS_WORKER_POOL_DEFAULT, i, 0, FALSE, 0);
+
+    nmtst_main_context_iterate_until_assert(NULL, 5000, data.n_completed == 20);
+
+    g_assert_cmpint(data.started->len, ==, 20);
+    for (i = 0; i < 20; i++)
+        g_assert_cmpint(g_array_index(data.started, guint, i), ==, i);
+
+    _nmp_utils_worker_set_max_threads_for_testing(NMP_UTILS_WORKER_POOL_DEFAULT, -1);
+    _worker_test_data_clear(&data);
+}
+
+static void
+test_worker_serialized(void)
+{
+    WorkerTestData data;
+    guint          prev[3] = {};
+    guint          i;
+
+    _worker_test_data_init(&data);
+
+    /* The first task of key 1 only finishes after a task of key 2 started.
+     * So tasks with different keys must run in parallel. */
+    _worker_test_run(&data, NMP_UTILS_WORKER_POOL_DEFAULT, 1, 1, FALSE, 2);
+    for (i = 2; i <= 20; i++)
+        _worker_test_run(&data, NMP_UTILS_WORKER_POOL_DEFAULT, i, (i % 2) + 1, FALSE, 0);
+
+    nmtst_main_context_iterate_until_assert(NULL, 5000, data.n_completed == 20);
+
+    g_assert(!data.timed_out);
+    g_assert_cmpint(data.max_running[1], ==, 1);
+    g_assert_cmpint(data.max_running[2], ==, 1);
+
+    /* tasks with the same key start in the order they were queued. */
+    g_assert_cmpint(data.started->len, ==, 20);
+    for (i = 0; i < data.started->len; i++) {
+        guint idx = g_array_index(data.started, guint, i);
+        int   key = idx == 1 ? 1 : (idx % 2) + 1;
+
+        g_assert_cmpint(prev[key], <, idx);
+        prev[key] = idx;
+    }
+
+    _worker_test_data_clear(&data);
+}
+
+static void
+test_worker_pools(void)
+{
+    WorkerTestData data;
+
+    _worker_test_data_init(&data);
+    _nmp_utils_worker_set_max_threads_for_testing(NMP_UTILS_WORKER_POOL_SRIOV, 1);
+
+    /* occupy the only SR-IOV thread. */
+    data.blocked = TRUE;
+    _worker_test_run(&data, NMP_UTILS_WORKER_POOL_SRIOV, 0, 0, TRUE, 0);
+    nmtst_main_context_iterate_until_assert(NULL, 5000, _worker_test_get_n_started(&data) == 1);
+
+    /* another SR-IOV task waits, but the default pool is not affected. */
+    _worker_test_run(&data, NMP_UTILS_WORKER_POOL_SRIOV, 1, 0, FALSE, 0);
+    _worker_test_run(&data, NMP_UTILS_WORKER_POOL_DEFAULT, 2, 0, FALSE, 0);
+    nmtst_main_context_iterate_until_assert(NULL, 5000, data.n_completed == 1);
+    g_assert_cmpint(_worker_test_get_n_started(&data), ==, 2);
+    g_assert_cmpint(g_array_index(data.started, guint, 1), ==, 2);
+
+    g_mutex_lock(&data.lock);
+    data.blocked = FALSE;
+    g_cond_broadcast(&data.cond);
+    g_mutex_unlock(&data.lock);
+
+    nmtst_main_context_iterate_until_assert(NULL, 5000, data.n_completed == 3);
+    g_assert_cmpint(g_array_index(data.started, guint, 2), ==, 1);
+
+    _nmp_utils_worker_set_max_threads_for_testing(NMP_UTILS_WORKER_POOL_SRIOV, -1);
+    _worker_test_data_clear(&data);
+}
+
+/*****************************************************************************/
+
 NMTST_DEFINE();
 
 int
@@ -151,6 +375,9 @@ main(int argc, char **argv)
     g_test_add_func("/nm-platform/test_use_symbols", test_use_symbols);
     g_test_add_func("/nm-platform/test_nmp_link_mode_all_advertised_modes_bits",
                     test_nmp_link_mode_all_advertised_modes_bits);
+    g_test_add_func("/nm-platform/worker/queue-order", test_worker_queue_order);
+    g_test_add_func("/nm-platform/worker/serialized", test_worker_serialized);
+    g_test_add_func("/nm-platform/worker/pools", test_worker_pools);
 
     return g_test_run();
 }
@@ -20,6 +20,7 @@
 #endif
 
 #include "linux-headers/ethtool.h"
+#include "linux-headers/ethtool_netlink.h"
 #include "linux-headers/nl802154.h"
 #include "linux-headers/nl80211-vnd-intel.h"
 #include "linux-headers/mptcp.h"
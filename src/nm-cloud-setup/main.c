@@ -635,7 +635,9 @@ main(int argc, const char *const *argv)
                             &nmc,
                             &error,
                             NM_CLIENT_INSTANCE_FLAGS,
-                            (guint) NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS,
+                            (guint) (NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS
+                                     | NM_CLIENT_INSTANCE_FLAGS_SKIP_ACCESS_POINTS
+                                     | NM_CLIENT_INSTANCE_FLAGS_SKIP_IP_CONFIGS),
                             NULL);
 
     nmcs_wait_for_objects_register(nmc);
@@ -311,11 +311,16 @@ main(int argc, char *argv[])
 
     data.client_new_timeout_id = g_timeout_add_seconds(30, got_client_timeout, &data);
 
+    /* We only care about the global state, so don't track objects that
+     * we never look at. */
     data.client = nmc_client_new_async(data.client_new_cancellable,
                                        got_client,
                                        &data,
                                        NM_CLIENT_INSTANCE_FLAGS,
-                                       (guint) NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS,
+                                       (guint) (NM_CLIENT_INSTANCE_FLAGS_NO_AUTO_FETCH_PERMISSIONS
+                                                | NM_CLIENT_INSTANCE_FLAGS_SKIP_ACCESS_POINTS
+                                                | NM_CLIENT_INSTANCE_FLAGS_SKIP_IP_CONFIGS
+                                                | NM_CLIENT_INSTANCE_FLAGS_SKIP_CONNECTIONS),
                                        NULL);
 
     g_main_loop_run(data.loop);
@@ -2169,6 +2169,14 @@ class Settings(ExportedObj):
     def AddConnection(self, con_hash):
         return self.add_connection(con_hash)
 
+    @dbus.service.method(
+        dbus_interface=IFACE_SETTINGS,
+        in_signature="aa{sa{sv}}ua{sv}",
+        out_signature="aoa{sv}",
+    )
+    def AddConnections(self, con_hashes, flags, args):
+        return ([self.add_connection(con_hash) for con_hash in con_hashes], [])
+
     @dbus.service.method(
         dbus_interface=IFACE_SETTINGS, in_signature="", out_signature="b"
     )